@@ -50,6 +50,7 @@
 @param [in] _providers Set of callbacks which provide data used during playback.
 @param [in] _userdata Link to the object that will hold the data providers give.
 @return A composition or AE_NULL if failed.
+@note When a provider fails the composition memory is released, deleters are not called for data already provided.
 */
 const aeMovieComposition * ae_create_movie_composition( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _interpolate, const aeMovieCompositionProviders * _providers, ae_userdata_t _userdata );
 
@@ -59,6 +60,32 @@ const aeMovieComposition * ae_create_movie_composition( const aeMovieData * _mov
 */
 ae_void_t ae_delete_movie_composition( const aeMovieComposition * _composition );
 
+/**
+@brief Run every provider independent setup pass of a composition once.
+@param [in] _movieData Resource holding movie data.
+@param [in] _compositionData Resource holding composition data.
+@param [in] _interpolate If TRUE, compositions made from the template will be interpolated.
+@return A template or AE_NULL if failed.
+*/
+const aeMovieCompositionTemplate * ae_create_movie_composition_template( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _interpolate );
+
+/**
+@brief Release a template, compositions made from it stay valid.
+@param [in] _compositionTemplate Template.
+*/
+ae_void_t ae_delete_movie_composition_template( const aeMovieCompositionTemplate * _compositionTemplate );
+
+/**
+@brief Allocate a composition by copying a template, only the providers are called.
+Same result as ae_create_movie_composition with the template data.
+@param [in] _compositionTemplate Template.
+@param [in] _providers Set of callbacks which provide data used during playback.
+@param [in] _userdata Link to the object that will hold the data providers give.
+@return A composition or AE_NULL if failed.
+@note When a provider fails the composition memory is released, deleters are not called for data already provided.
+*/
+const aeMovieComposition * ae_create_movie_composition_from_template( const aeMovieCompositionTemplate * _compositionTemplate, const aeMovieCompositionProviders * _providers, ae_userdata_t _userdata );
+
 /**
 @brief get composition data from composition.
 @param [in] _composition Composition.
@@ -105,6 +132,13 @@ ae_bool_t ae_get_movie_composition_loop( const aeMovieComposition * _composition
 */
 ae_bool_t ae_get_movie_composition_interpolate( const aeMovieComposition * _composition );
 
+/**
+@brief Number of node matrix and color rebuilds skipped because the layer frame and the parent matrix are unchanged, or every transform property of the layer sits in a constant block.
+@param [in] _composition Composition.
+@return Skipped rebuild count since the composition was created.
+*/
+ae_uint32_t ae_get_movie_composition_matrix_skip_count( const aeMovieComposition * _composition );
+
 /**
 @brief Set playback area of a composition in milliseconds.
 @param [in] _composition Composition.
@@ -297,6 +331,53 @@ ae_bool_t ae_get_movie_composition_socket( const aeMovieComposition * _compositi
 */
 ae_bool_t ae_compute_movie_mesh( const aeMovieComposition * _composition, ae_uint32_t * _iterator, aeMovieRenderMesh * _vertices );
 
+/**
+@brief Compute rendering data at the current playback time, writing vertices to caller-provided storage.
+@param [in] _composition Composition.
+@param [in] _iterator Index of the render mesh to update, can start from zero, will increase automatically inside.
+@param [out] _render Render mesh, position and uv point into the storage returned by the sink.
+@param [in] _sink Called with the vertex count once it is known, can be NULL to compute the render state only.
+@param [in] _ud Sink user data.
+@return TRUE if there are still meshes to compute in the next iteration, FALSE if finished.
+*/
+ae_bool_t ae_compute_movie_mesh_ex( const aeMovieComposition * _composition, ae_uint32_t * _iterator, aeMovieRenderMeshEx * _render, ae_movie_render_mesh_sink_t _sink, ae_userdata_t _ud );
+
+/**
+@brief Compute rendering data at the current playback time, writing vertices straight into an interleaved vertex buffer.
+@param [in] _composition Composition.
+@param [in] _iterator Index of the render mesh to update, can start from zero, will increase automatically inside.
+@param [out] _render Render mesh, position and uv stay NULL since the vertices live in the sink buffer.
+@param [in] _layout Vertex layout of the sink buffer.
+@param [in] _sink Called with the vertex count once it is known, can be NULL to compute the render state only.
+@param [in] _ud Sink user data.
+@return TRUE if there are still meshes to compute in the next iteration, FALSE if finished.
+*/
+ae_bool_t ae_compute_movie_mesh_interleaved( const aeMovieComposition * _composition, ae_uint32_t * _iterator, aeMovieRenderMeshEx * _render, const aeMovieRenderVertexLayout * _layout, ae_movie_render_vertex_buffer_sink_t _sink, ae_userdata_t _ud );
+
+/**
+@brief Prepare empty whole-frame buffers.
+@param [in] _instance Instance whose allocator owns the buffers.
+@param [out] _meshes Buffers.
+*/
+ae_void_t ae_initialize_movie_render_meshes( const aeMovieInstance * _instance, aeMovieRenderMeshes * _meshes );
+
+/**
+@brief Release whole-frame buffers.
+@param [in] _meshes Buffers.
+*/
+ae_void_t ae_finalize_movie_render_meshes( aeMovieRenderMeshes * _meshes );
+
+/**
+@brief Compute every render mesh at the current playback time in one pass.
+
+Vertices and indices of all meshes are packed into _meshes, indices rebased onto the packed vertices,
+with one draw record per mesh in the same order ae_compute_movie_mesh() would return them.
+@param [in] _composition Composition.
+@param [in,out] _meshes Buffers, previous contents are replaced.
+@return FALSE if the buffers could not grow.
+*/
+ae_bool_t ae_compute_movie_meshes( const aeMovieComposition * _composition, aeMovieRenderMeshes * _meshes );
+
 /**
 @param [in] _composition Composition.
 @return Number of meshes at the current playback time.
@@ -415,6 +496,59 @@ ae_bool_t ae_set_movie_composition_node_enable_any( const aeMovieComposition * _
 */
 ae_bool_t ae_get_movie_composition_node_enable_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_bool_t * _enable );
 
+/**
+@brief Resolve a node once and access it by handle afterwards.
+The handle stays valid for the lifetime of the composition.
+@param [in] _composition Composition.
+@param [in] _layerName Node name.
+@param [in] _type Node type, AE_MOVIE_LAYER_TYPE_NONE for any type.
+@param [out] _handle Node handle, AE_MOVIE_NODE_HANDLE_INVALID if not found.
+@return TRUE if the node is found.
+@note Handle accessors ignore an out of range handle: setters do nothing, getters return NULL, FALSE or 0.
+*/
+ae_bool_t ae_find_movie_composition_node_handle( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_node_handle_t * _handle );
+
+/**
+@param [in] _composition Composition.
+@param [in] _handle Node handle.
+@return Layer data of the node, NULL for an invalid handle.
+*/
+const aeMovieLayerData * ae_get_movie_composition_node_handle_layer_data( const aeMovieComposition * _composition, ae_node_handle_t _handle );
+
+ae_void_t ae_set_movie_composition_node_handle_enable( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_bool_t _enable );
+ae_bool_t ae_get_movie_composition_node_handle_enable( const aeMovieComposition * _composition, ae_node_handle_t _handle );
+
+ae_void_t ae_set_movie_composition_node_handle_extra_opacity( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_float_t _opacity );
+ae_float_t ae_get_movie_composition_node_handle_extra_opacity( const aeMovieComposition * _composition, ae_node_handle_t _handle );
+
+/**
+@brief Get node active time range in milliseconds.
+@param [in] _composition Composition.
+@param [in] _handle Node handle.
+@param [out] _in Begin time.
+@param [out] _out End time.
+*/
+ae_void_t ae_get_movie_composition_node_handle_in_out_time( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_time_t * _in, ae_time_t * _out );
+
+/**
+@brief Set node active time range in milliseconds, snapped to the layer frames. Takes effect on the next update.
+@note A node covering the whole range of its parent plays incessantly, the flag follows the new range. Layers inside a pre-composition node keep their own range.
+@param [in] _composition Composition.
+@param [in] _handle Node handle.
+@param [in] _in Begin time.
+@param [in] _out End time, not less than the begin time.
+*/
+ae_void_t ae_set_movie_composition_node_handle_in_out_time( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_time_t _in, ae_time_t _out );
+
+/**
+@brief Element user data, the one returned by the node provider or set for a slot.
+@param [in] _composition Composition.
+@param [in] _handle Node handle.
+@param [in] _userdata Data pointer.
+*/
+ae_void_t ae_set_movie_composition_node_handle_userdata( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_userdata_t _userdata );
+ae_userdata_t ae_get_movie_composition_node_handle_userdata( const aeMovieComposition * _composition, ae_node_handle_t _handle );
+
 
 // compositions
 /// @}
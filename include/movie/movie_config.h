@@ -70,4 +70,28 @@
 #   define AE_MOVIE_LAYER_MAX_OPTIONS (8U)
 #endif
 
+#ifndef AE_MOVIE_TIMELINE_SEEK_MIN_BLOCKS
+#   define AE_MOVIE_TIMELINE_SEEK_MIN_BLOCKS (8U)
+#endif
+
+#ifndef AE_MOVIE_TIMELINE_SEEK_STRIDE
+#   define AE_MOVIE_TIMELINE_SEEK_STRIDE (8U)
+#endif
+
+#ifndef AE_MOVIE_TIMELINE_CURSOR_MAX_JUMP
+#   define AE_MOVIE_TIMELINE_CURSOR_MAX_JUMP (16U)
+#endif
+
+#ifndef AE_MOVIE_NO_NODE_INTERVAL_INDEX
+#   define AE_MOVIE_NODE_INTERVAL_INDEX
+#endif
+
+#ifndef AE_MOVIE_TRANSFORMATION_BATCH_SIZE
+#   define AE_MOVIE_TRANSFORMATION_BATCH_SIZE (32U)
+#endif
+
+#ifndef AE_MOVIE_NO_TRANSFORMATION_BATCH
+#   define AE_MOVIE_TRANSFORMATION_BATCH
+#endif
+
 #endif
\ No newline at end of file
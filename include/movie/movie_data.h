@@ -480,4 +480,67 @@ ae_bool_t ae_get_movie_composition_data_bounds( const aeMovieCompositionData * _
 */
 ae_bool_t ae_has_movie_composition_data_layer( const aeMovieInstance * _instance, const aeMovieCompositionData * _compositionData, const ae_char_t * _layerName );
 
+/**
+@brief Expand compressed layer timelines into flat per frame arrays, trading memory for sampling speed.
+Constant runs stay single values, so held segments still skip matrix rebuilds.
+@param [in] _movieData Data.
+@param [in] _layer Layer.
+@param [in] _budget Maximum number of bytes the baked timelines may take.
+@param [in,out] _used Bytes already taken from the budget, increased by the bytes baked.
+@return FALSE if the budget ran out, the rest of the timelines keep the compressed path, or if a composition or template created from this data still exists.
+@note Creating and deleting compositions and templates of this data must not run concurrently with the bake.
+*/
+ae_bool_t ae_bake_movie_layer_data( aeMovieData * _movieData, const aeMovieLayerData * _layer, ae_size_t _budget, ae_size_t * _used );
+
+/**
+@brief Expand compressed camera timelines of a composition into flat per frame arrays.
+@param [in] _movieData Data.
+@param [in] _compositionData Composition.
+@param [in] _budget Maximum number of bytes the baked timelines may take.
+@param [in,out] _used Bytes already taken from the budget, increased by the bytes baked.
+@return FALSE if the budget ran out, the rest of the timelines keep the compressed path, or if a composition or template created from this data still exists.
+@note Creating and deleting compositions and templates of this data must not run concurrently with the bake.
+*/
+ae_bool_t ae_bake_movie_composition_camera_data( aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_size_t _budget, ae_size_t * _used );
+
+/**
+@brief Bake timelines of the composition camera and all composition layers, sub compositions included.
+@param [in] _movieData Data.
+@param [in] _compositionData Composition.
+@param [in] _budget Maximum number of bytes the baked timelines may take.
+@param [in,out] _used Bytes already taken from the budget, increased by the bytes baked.
+@return FALSE if the budget ran out, the rest of the timelines keep the compressed path, or if a composition or template created from this data still exists.
+@note Creating and deleting compositions and templates of this data must not run concurrently with the bake.
+*/
+ae_bool_t ae_bake_movie_composition_data( aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_size_t _budget, ae_size_t * _used );
+
+typedef struct aeMovieCompositionDataMatrixCacheStatistics
+{
+    ae_uint32_t capacity;
+    ae_uint32_t count;
+
+    ae_uint32_t hits;
+    ae_uint32_t misses;
+    ae_uint32_t evictions;
+} aeMovieCompositionDataMatrixCacheStatistics;
+
+/**
+@brief Memoize non interpolated layer matrices per frame, shared by every composition created from this data.
+@param [in] _movieData Data.
+@param [in] _compositionData Composition, sub compositions get their own cache with the same capacity.
+@param [in] _capacity Maximum number of cached matrices, the oldest entry is evicted first.
+@return FALSE if memory allocation failed or capacity is zero, caches enabled before the failure stay enabled.
+@note Layer matrices are cached, a node still multiplies by its parent world matrix.
+@note The cache is written by every update, set time and render query of compositions created from this data. Enabling it, and all compositions sharing it, must stay on one thread.
+*/
+ae_bool_t ae_enable_movie_composition_data_matrix_cache( const aeMovieData * _movieData, aeMovieCompositionData * _compositionData, ae_uint32_t _capacity );
+
+/**
+@brief Get matrix cache counters.
+@param [in] _compositionData Composition.
+@param [out] _statistics Cache capacity, fill and hit, miss, eviction counts.
+@return FALSE if the cache is not enabled for this composition.
+*/
+ae_bool_t ae_get_movie_composition_data_matrix_cache_statistics( const aeMovieCompositionData * _compositionData, aeMovieCompositionDataMatrixCacheStatistics * _statistics );
+
 #endif
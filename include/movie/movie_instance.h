@@ -49,6 +49,11 @@ typedef ae_voidptr_t( *ae_movie_alloc_n_t )(ae_userdata_t _userdata, ae_size_t _
 typedef ae_void_t( *ae_movie_free_t )(ae_userdata_t _userdata, ae_constvoidptr_t _ptr);
 typedef ae_void_t( *ae_movie_free_n_t )(ae_userdata_t _userdata, ae_constvoidptr_t _ptr);
 
+/**
+@brief Compare layer names.
+@note Layer, slot, socket and sub composition name indices hash names byte-wise, which only agrees with the default comparator.
+With a custom comparator (e.g. case-insensitive) every name hashes to the same bucket, so each lookup by name is a linear scan of all layers of the composition, sub compositions included, calling this comparator.
+*/
 typedef ae_int32_t( *ae_movie_strncmp_t )(ae_userdata_t _userdata, const ae_char_t * _src, const ae_char_t * _dst, ae_size_t _count);
 
 typedef enum
@@ -68,6 +73,7 @@ typedef ae_void_t( *ae_movie_logger_t )(ae_userdata_t _userdata, aeMovieErrorCod
 /**
 @brief Create a new instance.
 @param [in] _alloc,_alloc_n,_free,_free_n,_strncmp,_logger User pointers to utility functions.
+@param [in] _strncmp May be NULL for the default comparator, a custom one turns name lookups into linear scans (see ae_movie_strncmp_t).
 @param [in] _data Usually pointer to the creating object.
 */
 const aeMovieInstance * ae_create_movie_instance(
@@ -162,6 +162,9 @@ typedef struct aeMovieNodeUpdateCallbackData
     /// @brief Additional transform, e.g. for slots/sockets.
     ae_matrix34_ptr_t matrix;
 
+    /// @brief TRUE if matrix and color were rebuilt since the previous update of this node.
+    ae_bool_t matrix_changed;
+
     ae_bool_t immutable_color;
 
     /// @brief Value from 0.0 to 1.0.
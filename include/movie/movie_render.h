@@ -131,8 +131,272 @@ typedef struct aeMovieRenderMesh
     Contains data for track matte, slot, socket etc.
     */
     ae_userdata_t element_userdata;
+
+    /**
+    @brief Changes only when position or uv of this layer change.
+
+    Follows the layer matrix, its animated mesh or bezier warp frame and the image it shows,
+    but not color or opacity. Together with the iterator value it identifies the vertices,
+    so a renderer may keep them in a persistent buffer while the revision stays the same.
+    */
+    ae_uint32_t geometry_revision;
 } aeMovieRenderMesh;
 
+/**
+@brief Mesh used in render loop, with vertices written to caller-provided storage.
+
+Carries the same state as #aeMovieRenderMesh, but instead of embedding
+#AE_MOVIE_MAX_VERTICES positions and uvs it points at buffers obtained
+from a \link #ae_movie_render_mesh_sink_t vertex sink\endlink, sized to the actual mesh.
+
+Provided by ae_compute_movie_mesh_ex().
+*/
+typedef struct aeMovieRenderMeshEx
+{
+    aeMovieLayerTypeEnum layer_type;
+    ae_blend_mode_t blend_mode;
+    const aeMovieResource * resource;
+
+    ae_uint32_t vertexCount;
+    ae_uint32_t indexCount;
+
+    /**
+    @brief Vertex positions, NULL if the sink declined the mesh.
+    */
+    ae_vector3_t * position;
+
+    /**
+    @brief Texture coordinates, NULL if the sink declined the mesh.
+    */
+    ae_vector2_t * uv;
+
+    ae_userdata_t uv_cache_userdata;
+
+    const ae_uint16_t * indices;
+
+    ae_color_t color;
+    ae_color_channel_t opacity;
+
+    ae_userdata_t camera_userdata;
+
+    ae_track_matte_mode_t track_matte_mode;
+    ae_userdata_t track_matte_userdata;
+
+    const ae_viewport_t * viewport;
+
+    ae_userdata_t shader_userdata;
+    ae_userdata_t element_userdata;
+
+    /**
+    @brief See aeMovieRenderMesh::geometry_revision, known before the sink is called.
+    */
+    ae_uint32_t geometry_revision;
+} aeMovieRenderMeshEx;
+
+/**
+@brief Vertex sink, called once per mesh that has vertices.
+
+Receives the mesh with every field filled in except position and uv.
+@param [in] _render Mesh being computed, vertexCount is the number of vertices to store.
+@param [out] _position Storage for at least vertexCount positions.
+@param [out] _uv Storage for at least vertexCount texture coordinates.
+@param [in] _ud User data.
+@return FALSE to skip the vertices of this mesh (e.g. culled, or geometry_revision unchanged since the buffer was filled), TRUE if _position and _uv were provided.
+*/
+typedef ae_bool_t( *ae_movie_render_mesh_sink_t )(const aeMovieRenderMeshEx * _render, ae_vector3_t ** _position, ae_vector2_t ** _uv, ae_userdata_t _ud);
+
+/**
+@brief Packed vertex colour written by ae_compute_movie_mesh_interleaved().
+*/
+typedef enum
+{
+    /// Colour is not written.
+    AE_MOVIE_RENDER_COLOR_NONE = 0,
+    /// 0xAARRGGBB.
+    AE_MOVIE_RENDER_COLOR_ARGB = 1,
+    /// 0xAABBGGRR, i.e. RGBA bytes on little-endian targets.
+    AE_MOVIE_RENDER_COLOR_ABGR = 2,
+} aeMovieRenderColorEnum;
+
+/**
+@brief Caller-described interleaved vertex layout.
+
+Position is written as three floats, uv as two floats and colour as one packed 32-bit value,
+each at its byte offset within a vertex of stride bytes. They are stored directly, not byte by byte,
+so stride and the three offsets must be multiples of 4 and the sink buffer must be 4-byte aligned.
+*/
+typedef struct aeMovieRenderVertexLayout
+{
+    ae_uint32_t stride;
+
+    ae_uint32_t position_offset;
+    ae_uint32_t uv_offset;
+    ae_uint32_t color_offset;
+
+    /**
+    @brief Mesh color and opacity, clamped to [0, 1], rounded to the nearest 8-bit value and packed once per mesh.
+    */
+    aeMovieRenderColorEnum color_format;
+
+    /**
+    @brief Multiply rgb by opacity before packing.
+    */
+    ae_bool_t color_premultiplied;
+} aeMovieRenderVertexLayout;
+
+/**
+@brief Interleaved vertex buffer sink, called once per mesh that has vertices.
+@param [in] _render Mesh being computed, vertexCount is the number of vertices to store.
+@param [out] _vertices Storage for at least vertexCount vertices of the layout stride, 4-byte aligned.
+@param [in] _ud User data.
+@return FALSE to skip the vertices of this mesh, TRUE if _vertices was provided.
+*/
+typedef ae_bool_t( *ae_movie_render_vertex_buffer_sink_t )(const aeMovieRenderMeshEx * _render, ae_voidptr_t * _vertices, ae_userdata_t _ud);
+
+/**
+@brief One mesh of a whole-frame batch, see ae_compute_movie_meshes().
+
+Meshes without geometry (slots, sockets, particles etc.) are kept in draw order with zero counts.
+*/
+typedef struct aeMovieRenderDraw
+{
+    aeMovieLayerTypeEnum layer_type;
+    ae_blend_mode_t blend_mode;
+    const aeMovieResource * resource;
+
+    /**
+    @brief First vertex the indices of this draw are relative to.
+
+    Stays zero unless the frame holds more vertices than 16-bit indices can address.
+    */
+    ae_uint32_t vertex_base;
+
+    ae_uint32_t vertex_offset;
+    ae_uint32_t vertex_count;
+
+    ae_uint32_t index_offset;
+    ae_uint32_t index_count;
+
+    ae_userdata_t uv_cache_userdata;
+
+    ae_color_t color;
+    ae_color_channel_t opacity;
+
+    ae_userdata_t camera_userdata;
+
+    ae_track_matte_mode_t track_matte_mode;
+    ae_userdata_t track_matte_userdata;
+
+    const ae_viewport_t * viewport;
+
+    ae_userdata_t shader_userdata;
+    ae_userdata_t element_userdata;
+
+    ae_uint32_t geometry_revision;
+} aeMovieRenderDraw;
+
+/**
+@brief Packed vertex and index buffers of a whole frame.
+
+Owned by the caller, initialized with ae_initialize_movie_render_meshes() and
+released with ae_finalize_movie_render_meshes(). Buffers grow on demand and are
+reused between frames, so a steady composition stops allocating after the first frame.
+*/
+typedef struct aeMovieRenderMeshes
+{
+    const aeMovieInstance * instance;
+
+    ae_vector3_t * positions;
+    ae_vector2_t * uvs;
+    ae_uint32_t vertex_count;
+    ae_uint32_t vertex_capacity;
+
+    ae_uint16_t * indices;
+    ae_uint32_t index_count;
+    ae_uint32_t index_capacity;
+
+    aeMovieRenderDraw * draws;
+    ae_uint32_t draw_count;
+    ae_uint32_t draw_capacity;
+} aeMovieRenderMeshes;
+
+/**
+@brief Run of consecutive draws that share render state and can be issued as one draw call.
+
+Draws of a batch only differ in colour and opacity, hosts merging them are expected to carry colour per vertex.
+*/
+typedef struct aeMovieRenderBatch
+{
+    /**
+    @brief Texture shared by the batch: the atlas of an image, the image itself, or NULL for untextured draws.
+    */
+    const aeMovieResource * texture;
+
+    ae_blend_mode_t blend_mode;
+    ae_userdata_t camera_userdata;
+    ae_userdata_t shader_userdata;
+    ae_userdata_t track_matte_userdata;
+    const ae_viewport_t * viewport;
+
+    ae_uint32_t draw_offset;
+    ae_uint32_t draw_count;
+
+    ae_uint32_t vertex_base;
+
+    ae_uint32_t vertex_offset;
+    ae_uint32_t vertex_count;
+
+    ae_uint32_t index_offset;
+    ae_uint32_t index_count;
+} aeMovieRenderBatch;
+
+/**
+@brief Batches of a whole frame, see ae_batch_movie_render_meshes().
+*/
+typedef struct aeMovieRenderBatches
+{
+    const aeMovieInstance * instance;
+
+    aeMovieRenderBatch * batches;
+    ae_uint32_t batch_count;
+    ae_uint32_t batch_capacity;
+
+    /**
+    @brief Batches with geometry, i.e. draw calls the host has to issue.
+    */
+    ae_uint32_t draw_call_count;
+
+    /**
+    @brief Draws with geometry merged into a preceding batch.
+    */
+    ae_uint32_t draw_call_saved;
+} aeMovieRenderBatches;
+
+/**
+@brief Prepare empty batches.
+@param [in] _instance Instance whose allocator owns the batches.
+@param [out] _batches Batches.
+*/
+ae_void_t ae_initialize_movie_render_batches( const aeMovieInstance * _instance, aeMovieRenderBatches * _batches );
+
+/**
+@brief Release batches.
+@param [in] _batches Batches.
+*/
+ae_void_t ae_finalize_movie_render_batches( aeMovieRenderBatches * _batches );
+
+/**
+@brief Merge runs of consecutive state-compatible draws, preserving draw order.
+
+Draws merge when texture, blend mode, camera, shader, track matte, viewport and vertex base match.
+Draws without geometry (slots, sockets etc.) always stay in a batch of their own, so the host
+can render their content in place.
+@param [in] _meshes Whole-frame meshes computed by ae_compute_movie_meshes().
+@param [in,out] _batches Batches, previous contents are replaced.
+@return FALSE if the batches could not grow.
+*/
+ae_bool_t ae_batch_movie_render_meshes( const aeMovieRenderMeshes * _meshes, aeMovieRenderBatches * _batches );
+
 // render
 /// @}
 
@@ -48,6 +48,7 @@ typedef float ae_float_t;
 typedef float ae_time_t;
 typedef ae_uint32_t ae_option_t;
 typedef ae_uint32_t ae_frame_t;
+typedef ae_uint32_t ae_node_handle_t;
 typedef ae_void_t * ae_voidptr_t;
 typedef ae_voidptr_t * ae_voidptrptr_t;
 typedef const ae_void_t * ae_constvoidptr_t;
@@ -133,6 +134,8 @@ typedef struct aeMovieStream aeMovieStream;
 #   define AE_MOVIE_MAX_VERTICES 1024U
 #endif
 
+#define AE_MOVIE_NODE_HANDLE_INVALID (~0U)
+
 typedef enum
 {
     AE_MOVIE_RESOURCE_NONE = 0,
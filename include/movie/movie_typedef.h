@@ -34,6 +34,7 @@ typedef struct aeMovieInstance aeMovieInstance;
 typedef struct aeMovieCompositionAnimation aeMovieCompositionAnimation;
 typedef struct aeMovieSubComposition aeMovieSubComposition;
 typedef struct aeMovieComposition aeMovieComposition;
+typedef struct aeMovieCompositionTemplate aeMovieCompositionTemplate;
 typedef struct aeMovieCompositionCamera aeMovieCompositionCamera;
 typedef struct aeMovieCompositionData aeMovieCompositionData;
 typedef struct aeMovieData aeMovieData;
@@ -60,18 +60,16 @@ AE_INTERNAL ae_float_t __get_bezier_warp_grid_invf( ae_uint32_t _quality )
     return grid_invf;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __make_bezier_warp_vertices( const aeMovieInstance * _instance, ae_uint32_t _quality, const aeMovieBezierWarp * _bezierWarp, const ae_matrix34_t _matrix, aeMovieRenderMesh * _render )
+AE_INTERNAL ae_void_t __make_bezier_warp_vertices( ae_uint32_t _quality, const aeMovieBezierWarp * _bezierWarp, const ae_matrix34_t _matrix, const aeMovieRenderVertexStream * _stream )
 {
     ae_uint32_t line_count = get_bezier_warp_line_count( _quality );
     ae_float_t grid_invf = __get_bezier_warp_grid_invf( _quality );
 
-    _render->vertexCount = get_bezier_warp_vertex_count( _quality );
-    _render->indexCount = get_bezier_warp_index_count( _quality );
-
     ae_float_t du = 0.f;
     ae_float_t dv = 0.f;
 
-    ae_vector3_t * positions = _render->position;
+    ae_uint8_t * position = _stream->position;
+    ae_uint32_t position_stride = _stream->position_stride;
 
     const ae_vector2_t * corners = _bezierWarp->corners;
     const ae_vector2_t * beziers = _bezierWarp->beziers;
@@ -110,7 +108,9 @@ AE_INTERNAL ae_void_t __make_bezier_warp_vertices( const aeMovieInstance * _inst
             ae_float_t x = __bezier_point( bu0x, bu1x, bu2x, bu3x, &bu );
             ae_float_t y = __bezier_point( bu0y, bu1y, bu2y, bu3y, &bu );
 
-            ae_mul_v3_xy_m34( *positions++, x, y, _matrix );
+            ae_mul_v3_xy_m34( (ae_float_t *)position, x, y, _matrix );
+
+            position += position_stride;
 
             du += grid_invf;
         }
@@ -118,8 +118,6 @@ AE_INTERNAL ae_void_t __make_bezier_warp_vertices( const aeMovieInstance * _inst
         du = 0.f;
         dv += grid_invf;
     }
-
-    _render->indices = _instance->bezier_warp_indices[_quality];
 }
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __setup_bezier_corners( aeMovieBezierWarp * _bezier, const ae_vector2_t * _current, const ae_vector2_t * _next, ae_float_t _t )
@@ -142,13 +140,13 @@ AE_INTERNAL ae_void_t __setup_bezier_beziers( aeMovieBezierWarp * _bezier, const
     ae_linerp_f2( _bezier->beziers[7], _current[7], _next[7], _t );
 }
 //////////////////////////////////////////////////////////////////////////
-ae_void_t make_layer_bezier_warp_vertices( const aeMovieInstance * _instance, const aeMovieLayerExtensionBezierWarp * _layerBezierWarp, ae_uint32_t _frame, ae_bool_t _interpolate, ae_float_t _t, const ae_matrix34_t _matrix, const ae_vector2_t * _uvs, aeMovieRenderMesh * _render )
+ae_void_t make_layer_bezier_warp_vertices( const aeMovieInstance * _instance, const aeMovieLayerExtensionBezierWarp * _layerBezierWarp, ae_uint32_t _frame, ae_bool_t _interpolate, ae_float_t _t, const ae_matrix34_t _matrix, const ae_vector2_t * _uvs, const aeMovieRenderVertexStream * _stream )
 {
     ae_uint32_t bezier_warp_quality = _layerBezierWarp->quality;
 
     if( _layerBezierWarp->immutable == AE_TRUE )
     {
-        __make_bezier_warp_vertices( _instance, bezier_warp_quality, &_layerBezierWarp->immutable_bezier_warp, _matrix, _render );
+        __make_bezier_warp_vertices( bezier_warp_quality, &_layerBezierWarp->immutable_bezier_warp, _matrix, _stream );
     }
     else
     {
@@ -156,7 +154,7 @@ ae_void_t make_layer_bezier_warp_vertices( const aeMovieInstance * _instance, co
         {
             const aeMovieBezierWarp * bezier_warp = _layerBezierWarp->bezier_warps + _frame;
 
-            __make_bezier_warp_vertices( _instance, bezier_warp_quality, bezier_warp, _matrix, _render );
+            __make_bezier_warp_vertices( bezier_warp_quality, bezier_warp, _matrix, _stream );
         }
         else
         {
@@ -173,7 +171,7 @@ ae_void_t make_layer_bezier_warp_vertices( const aeMovieInstance * _instance, co
             const ae_vector2_t * next_beziers = bezier_warp_frame_next->beziers;
             __setup_bezier_beziers( &bezierWarp, current_beziers, next_beziers, _t );
 
-            __make_bezier_warp_vertices( _instance, bezier_warp_quality, &bezierWarp, _matrix, _render );
+            __make_bezier_warp_vertices( bezier_warp_quality, &bezierWarp, _matrix, _stream );
         }
     }
 
@@ -181,12 +179,17 @@ ae_void_t make_layer_bezier_warp_vertices( const aeMovieInstance * _instance, co
 
     const ae_vector2_t * bezier_warp_uvs = _instance->bezier_warp_uvs[bezier_warp_quality];
 
+    ae_uint8_t * uv = _stream->uv;
+    ae_uint32_t uv_stride = _stream->uv_stride;
+
     if( _uvs == AE_NULLPTR )
     {
         ae_uint32_t vertex_index = 0;
         for( ; vertex_index != vertex_count; ++vertex_index )
         {
-            ae_copy_v2( _render->uv[vertex_index], bezier_warp_uvs[vertex_index] );
+            ae_copy_v2( (ae_float_t *)uv, bezier_warp_uvs[vertex_index] );
+
+            uv += uv_stride;
         }
     }
     else
@@ -206,8 +209,12 @@ ae_void_t make_layer_bezier_warp_vertices( const aeMovieInstance * _instance, co
             ae_float_t u = bezier_warp_uvs[vertex_index][0];
             ae_float_t v = bezier_warp_uvs[vertex_index][1];
 
-            _render->uv[vertex_index][0] = bx + ux * u + vx * v;
-            _render->uv[vertex_index][1] = by + uy * u + vy * v;
+            ae_float_t * uv_vertex = (ae_float_t *)uv;
+
+            uv_vertex[0] = bx + ux * u + vx * v;
+            uv_vertex[1] = by + uy * u + vy * v;
+
+            uv += uv_stride;
         }
     }
 }
\ No newline at end of file
@@ -44,25 +44,76 @@
 #define AE_MOVIE_FRAME_EPSILON 0.001f
 #endif
 
+#ifndef AE_MOVIE_NODE_INTERVAL_MARGIN
+#define AE_MOVIE_NODE_INTERVAL_MARGIN 2.f
+#endif
+
+#ifndef AE_MOVIE_COMPOSITION_ARENA_ALIGN
+#define AE_MOVIE_COMPOSITION_ARENA_ALIGN 16U
+#endif
+
+#ifndef AE_MOVIE_RENDER_MESHES_MIN_CAPACITY
+#define AE_MOVIE_RENDER_MESHES_MIN_CAPACITY 256U
+#endif
+
+#ifndef AE_MOVIE_RENDER_MESHES_MAX_INDEXED_VERTICES
+#define AE_MOVIE_RENDER_MESHES_MAX_INDEXED_VERTICES 65536U
+#endif
+
+#define AE_MOVIE_NODE_INTERVAL_NONE (~0U)
+#define AE_MOVIE_NODE_DEEP_NONE (~0U)
+#define AE_MOVIE_NODE_INDEX_NONE (~0U)
+#define AE_MOVIE_RENDER_GEOMETRY_REVISION_NONE (~0U)
+
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __make_mesh_vertices( const ae_mesh_t * _mesh, const ae_matrix34_t _matrix, const ae_vector2_t * _uvs, aeMovieRenderMesh * _render )
+typedef enum aeMovieRenderGeometryTypeEnum
 {
-    _render->vertexCount = _mesh->vertex_count;
-    _render->indexCount = _mesh->index_count;
+    AE_MOVIE_RENDER_GEOMETRY_NONE,
+    AE_MOVIE_RENDER_GEOMETRY_MESH,
+    AE_MOVIE_RENDER_GEOMETRY_SPRITE,
+    AE_MOVIE_RENDER_GEOMETRY_BEZIER_WARP,
+} aeMovieRenderGeometryTypeEnum;
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieRenderGeometry
+{
+    aeMovieRenderGeometryTypeEnum type;
+
+    const ae_mesh_t * mesh;
+    const aeMovieLayerExtensionBezierWarp * bezier_warp;
 
+    ae_float_t offset_x;
+    ae_float_t offset_y;
+    ae_float_t width;
+    ae_float_t height;
+
+    const ae_vector2_t * uvs;
+} aeMovieRenderGeometry;
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __make_mesh_vertices( const ae_mesh_t * _mesh, const ae_matrix34_t _matrix, const ae_vector2_t * _uvs, const aeMovieRenderVertexStream * _stream )
+{
     ae_uint32_t vertex_count = _mesh->vertex_count;
 
+    ae_uint8_t * position = _stream->position;
+    ae_uint32_t position_stride = _stream->position_stride;
+
     ae_uint32_t vertex_index = 0;
     for( ; vertex_index != vertex_count; ++vertex_index )
     {
-        ae_mul_v3_v2_m34( _render->position[vertex_index], _mesh->positions[vertex_index], _matrix );
+        ae_mul_v3_v2_m34( (ae_float_t *)position, _mesh->positions[vertex_index], _matrix );
+
+        position += position_stride;
     }
 
+    ae_uint8_t * uv = _stream->uv;
+    ae_uint32_t uv_stride = _stream->uv_stride;
+
     if( _uvs == AE_NULLPTR )
     {
         for( vertex_index = 0; vertex_index != vertex_count; ++vertex_index )
         {
-            ae_copy_v2( _render->uv[vertex_index], _mesh->uvs[vertex_index] );
+            ae_copy_v2( (ae_float_t *)uv, _mesh->uvs[vertex_index] );
+
+            uv += uv_stride;
         }
     }
     else
@@ -81,15 +132,17 @@ AE_INTERNAL ae_void_t __make_mesh_vertices( const ae_mesh_t * _mesh, const ae_ma
             ae_float_t u = _mesh->uvs[vertex_index][0];
             ae_float_t v = _mesh->uvs[vertex_index][1];
 
-            _render->uv[vertex_index][0] = bx + ux * u + vx * v;
-            _render->uv[vertex_index][1] = by + uy * u + vy * v;
+            ae_float_t * uv_vertex = (ae_float_t *)uv;
+
+            uv_vertex[0] = bx + ux * u + vx * v;
+            uv_vertex[1] = by + uy * u + vy * v;
+
+            uv += uv_stride;
         }
     }
-
-    _render->indices = _mesh->indices;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __make_layer_sprite_vertices( const aeMovieInstance * _instance, ae_float_t _offset_x, ae_float_t _offset_y, ae_float_t _width, ae_float_t _height, const ae_matrix34_t _matrix, const ae_vector2_t * _uv, aeMovieRenderMesh * _render )
+AE_INTERNAL ae_void_t __make_sprite_vertices( ae_float_t _offset_x, ae_float_t _offset_y, ae_float_t _width, ae_float_t _height, const ae_matrix34_t _matrix, const ae_vector2_t * _uvs, const aeMovieRenderVertexStream * _stream )
 {
     ae_vector2_t v_position[4];
 
@@ -104,27 +157,101 @@ AE_INTERNAL ae_void_t __make_layer_sprite_vertices( const aeMovieInstance * _ins
     *v++ = _offset_x + _width * 0.f;
     *v++ = _offset_y + _height * 1.f;
 
-    _render->vertexCount = 4;
-    _render->indexCount = 6;
+    ae_uint8_t * position = _stream->position;
+    ae_uint32_t position_stride = _stream->position_stride;
 
-    ae_mul_v3_v2_m34( _render->position[0], v_position[0], _matrix );
-    ae_mul_v3_v2_m34( _render->position[1], v_position[1], _matrix );
-    ae_mul_v3_v2_m34( _render->position[2], v_position[2], _matrix );
-    ae_mul_v3_v2_m34( _render->position[3], v_position[3], _matrix );
+    ae_mul_v3_v2_m34( (ae_float_t *)(position + position_stride * 0), v_position[0], _matrix );
+    ae_mul_v3_v2_m34( (ae_float_t *)(position + position_stride * 1), v_position[1], _matrix );
+    ae_mul_v3_v2_m34( (ae_float_t *)(position + position_stride * 2), v_position[2], _matrix );
+    ae_mul_v3_v2_m34( (ae_float_t *)(position + position_stride * 3), v_position[3], _matrix );
 
-    ae_copy_v2( _render->uv[0], _uv[0] );
-    ae_copy_v2( _render->uv[1], _uv[1] );
-    ae_copy_v2( _render->uv[2], _uv[2] );
-    ae_copy_v2( _render->uv[3], _uv[3] );
+    ae_uint8_t * uv = _stream->uv;
+    ae_uint32_t uv_stride = _stream->uv_stride;
 
-    _render->indices = _instance->sprite_indices;
+    ae_copy_v2( (ae_float_t *)(uv + uv_stride * 0), _uvs[0] );
+    ae_copy_v2( (ae_float_t *)(uv + uv_stride * 1), _uvs[1] );
+    ae_copy_v2( (ae_float_t *)(uv + uv_stride * 2), _uvs[2] );
+    ae_copy_v2( (ae_float_t *)(uv + uv_stride * 3), _uvs[3] );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __make_movie_render_vertex_stream( aeMovieRenderVertexStream * _stream, ae_vector3_t * _position, ae_vector2_t * _uv )
+{
+    _stream->position = (ae_uint8_t *)_position;
+    _stream->position_stride = sizeof( ae_vector3_t );
+    _stream->uv = (ae_uint8_t *)_uv;
+    _stream->uv_stride = sizeof( ae_vector2_t );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __make_movie_render_vertex_color( const ae_color_t * _color, ae_color_channel_t _opacity, aeMovieRenderColorEnum _format, ae_bool_t _premultiplied )
+{
+    ae_float_t r = ae_minimax_f_f( _color->r, 0.f, 1.f );
+    ae_float_t g = ae_minimax_f_f( _color->g, 0.f, 1.f );
+    ae_float_t b = ae_minimax_f_f( _color->b, 0.f, 1.f );
+    ae_float_t a = ae_minimax_f_f( _opacity, 0.f, 1.f );
+
+    if( _premultiplied == AE_TRUE )
+    {
+        r *= a;
+        g *= a;
+        b *= a;
+    }
+
+    ae_uint32_t r8 = (ae_uint32_t)(r * 255.f + 0.5f);
+    ae_uint32_t g8 = (ae_uint32_t)(g * 255.f + 0.5f);
+    ae_uint32_t b8 = (ae_uint32_t)(b * 255.f + 0.5f);
+    ae_uint32_t a8 = (ae_uint32_t)(a * 255.f + 0.5f);
+
+    if( _format == AE_MOVIE_RENDER_COLOR_ABGR )
+    {
+        return (a8 << 24) | (b8 << 16) | (g8 << 8) | (r8 << 0);
+    }
+
+    return (a8 << 24) | (r8 << 16) | (g8 << 8) | (b8 << 0);
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __set_movie_render_geometry_mesh( aeMovieRenderGeometry * _geometry, aeMovieRenderMeshEx * _render, const ae_mesh_t * _mesh, const ae_vector2_t * _uvs )
+{
+    _geometry->type = AE_MOVIE_RENDER_GEOMETRY_MESH;
+    _geometry->mesh = _mesh;
+    _geometry->uvs = _uvs;
+
+    _render->vertexCount = _mesh->vertex_count;
+    _render->indexCount = _mesh->index_count;
+    _render->indices = _mesh->indices;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __make_layer_mesh_vertices( const aeMovieLayerExtensionMesh * _extensionMesh, ae_uint32_t _frame, const ae_matrix34_t _matrix, const ae_vector2_t * _uvs, aeMovieRenderMesh * _render )
+AE_INTERNAL ae_void_t __set_movie_render_geometry_layer_mesh( aeMovieRenderGeometry * _geometry, aeMovieRenderMeshEx * _render, const aeMovieLayerExtensionMesh * _extensionMesh, ae_uint32_t _frame, const ae_vector2_t * _uvs )
 {
     const ae_mesh_t * mesh = (_extensionMesh->immutable == AE_TRUE) ? &_extensionMesh->immutable_mesh : (_extensionMesh->meshes + _frame);
 
-    __make_mesh_vertices( mesh, _matrix, _uvs, _render );
+    __set_movie_render_geometry_mesh( _geometry, _render, mesh, _uvs );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __set_movie_render_geometry_sprite( aeMovieRenderGeometry * _geometry, aeMovieRenderMeshEx * _render, const aeMovieInstance * _instance, ae_float_t _offset_x, ae_float_t _offset_y, ae_float_t _width, ae_float_t _height, const ae_vector2_t * _uvs )
+{
+    _geometry->type = AE_MOVIE_RENDER_GEOMETRY_SPRITE;
+    _geometry->offset_x = _offset_x;
+    _geometry->offset_y = _offset_y;
+    _geometry->width = _width;
+    _geometry->height = _height;
+    _geometry->uvs = _uvs;
+
+    _render->vertexCount = 4;
+    _render->indexCount = 6;
+    _render->indices = _instance->sprite_indices;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __set_movie_render_geometry_bezier_warp( aeMovieRenderGeometry * _geometry, aeMovieRenderMeshEx * _render, const aeMovieInstance * _instance, const aeMovieLayerExtensionBezierWarp * _bezierWarp, const ae_vector2_t * _uvs )
+{
+    ae_uint32_t quality = _bezierWarp->quality;
+
+    _geometry->type = AE_MOVIE_RENDER_GEOMETRY_BEZIER_WARP;
+    _geometry->bezier_warp = _bezierWarp;
+    _geometry->uvs = _uvs;
+
+    _render->vertexCount = get_bezier_warp_vertex_count( quality );
+    _render->indexCount = get_bezier_warp_index_count( quality );
+    _render->indices = _instance->bezier_warp_indices[quality];
 }
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_float_t __compute_movie_property_value( const struct aeMoviePropertyValue * _property, ae_uint32_t _frame, ae_bool_t _interpolate, ae_float_t _t )
@@ -179,7 +306,141 @@ AE_INTERNAL ae_uint32_t __compute_movie_node_frame( const aeMovieNode * _node, a
     return frame;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _composition, const aeMovieNode * _node, aeMovieRenderMesh * _render, ae_bool_t _interpolate, ae_bool_t _trackmatte )
+AE_INTERNAL aeMovieNodeCold * __get_movie_composition_node_cold( const aeMovieComposition * _composition, const aeMovieNode * _node )
+{
+    ae_uint32_t index = (ae_uint32_t)(_node - _composition->nodes);
+
+    aeMovieNodeCold * node_cold = _composition->node_colds + index;
+
+    return node_cold;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieNodeSampling * __get_movie_composition_node_sampling( const aeMovieComposition * _composition, const aeMovieNode * _node )
+{
+    ae_uint32_t index = (ae_uint32_t)(_node - _composition->nodes);
+
+    aeMovieNodeSampling * node_sampling = _composition->node_samplings + index;
+
+    return node_sampling;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __make_movie_render_geometry_vertices( const aeMovieInstance * _instance, const aeMovieRenderGeometry * _geometry, const aeMovieNode * _node, ae_bool_t _interpolate, const aeMovieRenderVertexStream * _stream )
+{
+    switch( _geometry->type )
+    {
+    case AE_MOVIE_RENDER_GEOMETRY_MESH:
+        {
+            __make_mesh_vertices( _geometry->mesh, _node->matrix, _geometry->uvs, _stream );
+        }break;
+    case AE_MOVIE_RENDER_GEOMETRY_SPRITE:
+        {
+            __make_sprite_vertices( _geometry->offset_x, _geometry->offset_y, _geometry->width, _geometry->height, _node->matrix, _geometry->uvs, _stream );
+        }break;
+    case AE_MOVIE_RENDER_GEOMETRY_BEZIER_WARP:
+        {
+            ae_float_t t_frame = 0.f;
+            ae_uint32_t frame = __compute_movie_node_frame( _node, &t_frame );
+
+            make_layer_bezier_warp_vertices( _instance, _geometry->bezier_warp, frame, _interpolate, t_frame, _node->matrix, _geometry->uvs, _stream );
+        }break;
+    default:
+        {
+        }break;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __equal_movie_render_geometry_matrix( const ae_matrix34_t _a, const ae_matrix34_t _b )
+{
+    ae_uint32_t index = 0;
+    for( ; index != 12; ++index )
+    {
+        if( _a[index] != _b[index] )
+        {
+            return AE_FALSE;
+        }
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieNodeGeometry * __get_movie_composition_node_geometry( const aeMovieComposition * _composition, const aeMovieNode * _node, ae_bool_t _trackmatte )
+{
+    ae_uint32_t index = (ae_uint32_t)(_node - _composition->nodes);
+
+    aeMovieNodeGeometry * node_geometry = _composition->node_geometries + index * 2U + (_trackmatte == AE_TRUE ? 1U : 0U);
+
+    return node_geometry;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __update_movie_render_geometry_revision( const aeMovieComposition * _composition, const aeMovieNode * _node, ae_bool_t _trackmatte, const aeMovieResource * _resource, const aeMovieRenderGeometry * _geometry )
+{
+    aeMovieNodeGeometry * node_geometry = __get_movie_composition_node_geometry( _composition, _node, _trackmatte );
+
+    ae_uint32_t matrix_revision = __get_movie_composition_node_sampling( _composition, _node )->matrix_revision;
+
+    ae_constvoidptr_t source = AE_NULLPTR;
+    ae_uint32_t frame = 0U;
+    ae_float_t t = 0.f;
+
+    switch( _geometry->type )
+    {
+    case AE_MOVIE_RENDER_GEOMETRY_MESH:
+        {
+            //animated layer meshes are stored per frame, the pointer already tells frames apart
+            source = _geometry->mesh;
+        }break;
+    case AE_MOVIE_RENDER_GEOMETRY_BEZIER_WARP:
+        {
+            source = _geometry->bezier_warp;
+
+            if( _geometry->bezier_warp->immutable == AE_FALSE )
+            {
+                frame = __compute_movie_node_frame( _node, &t );
+            }
+        }break;
+    default:
+        {
+        }break;
+    }
+
+    //sprite size and offset come from the resource, so it stands in for them
+    if( node_geometry->type == (ae_uint32_t)_geometry->type
+        && node_geometry->source == source
+        && node_geometry->uvs == _geometry->uvs
+        && node_geometry->resource == _resource
+        && node_geometry->frame == frame
+        && node_geometry->t == t )
+    {
+        if( node_geometry->matrix_revision == matrix_revision )
+        {
+            return node_geometry->revision;
+        }
+
+        //matrix resampled for color or opacity only
+        if( __equal_movie_render_geometry_matrix( node_geometry->matrix, _node->matrix ) == AE_TRUE )
+        {
+            node_geometry->matrix_revision = matrix_revision;
+
+            return node_geometry->revision;
+        }
+    }
+
+    node_geometry->type = (ae_uint32_t)_geometry->type;
+    node_geometry->source = source;
+    node_geometry->uvs = _geometry->uvs;
+    node_geometry->resource = _resource;
+    node_geometry->frame = frame;
+    node_geometry->t = t;
+    node_geometry->matrix_revision = matrix_revision;
+
+    ae_copy_m34( node_geometry->matrix, _node->matrix );
+
+    ++node_geometry->revision;
+
+    return node_geometry->revision;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __compute_movie_render_mesh_state( const aeMovieComposition * _composition, const aeMovieNode * _node, aeMovieRenderMeshEx * _render, ae_bool_t _trackmatte, aeMovieRenderGeometry * _geometry )
 {
     const aeMovieData * movie_data = _composition->movie_data;
     const aeMovieInstance * instance = movie_data->instance;
@@ -191,15 +452,20 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
     _render->layer_type = layer_type;
     _render->blend_mode = _node->blend_mode;
     _render->resource = resource;
-    _render->camera_userdata = _node->camera_userdata;
-    _render->element_userdata = _node->element_userdata;
-    _render->shader_userdata = _node->shader_userdata;
-    _render->viewport = _node->viewport;
+
+    const aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, _node );
+
+    _render->camera_userdata = node_cold->camera_userdata;
+    _render->element_userdata = node_cold->element_userdata;
+    _render->shader_userdata = node_cold->shader_userdata;
+    _render->viewport = node_cold->viewport;
 
     if( _node->track_matte_node != AE_NULLPTR && _node->track_matte_node->active == AE_TRUE )
     {
+        const aeMovieNodeCold * track_matte_cold = __get_movie_composition_node_cold( _composition, _node->track_matte_node );
+
         _render->track_matte_mode = layer->track_matte_mode;
-        _render->track_matte_userdata = _node->track_matte_node->track_matte_userdata;
+        _render->track_matte_userdata = track_matte_cold->track_matte_userdata;
     }
     else
     {
@@ -208,6 +474,10 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
     }
 
     _render->uv_cache_userdata = AE_NULLPTR;
+    _render->position = AE_NULLPTR;
+    _render->uv = AE_NULLPTR;
+
+    _geometry->type = AE_MOVIE_RENDER_GEOMETRY_NONE;
 
     ae_float_t t_frame = 0.f;
     ae_uint32_t frame = __compute_movie_node_frame( _node, &t_frame );
@@ -216,7 +486,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
     {
     case AE_MOVIE_LAYER_TYPE_SHAPE:
         {
-            __make_layer_mesh_vertices( layer->extensions->mesh, frame, _node->matrix, AE_NULLPTR, _render );
+            __set_movie_render_geometry_layer_mesh( _geometry, _render, layer->extensions->mesh, frame, AE_NULLPTR );
 
             _render->color = _node->color;
             _render->opacity = _node->opacity * _node->extra_opacity;
@@ -227,18 +497,18 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
 
             if( layer->extensions->mesh != AE_NULLPTR )
             {
-                __make_layer_mesh_vertices( layer->extensions->mesh, frame, _node->matrix, AE_NULLPTR, _render );
+                __set_movie_render_geometry_layer_mesh( _geometry, _render, layer->extensions->mesh, frame, AE_NULLPTR );
             }
             else if( layer->extensions->bezier_warp != AE_NULLPTR )
             {
-                make_layer_bezier_warp_vertices( instance, layer->extensions->bezier_warp, frame, _interpolate, t_frame, _node->matrix, AE_NULLPTR, _render );
+                __set_movie_render_geometry_bezier_warp( _geometry, _render, instance, layer->extensions->bezier_warp, AE_NULLPTR );
             }
             else
             {
                 ae_float_t width = resource_solid->width;
                 ae_float_t height = resource_solid->height;
 
-                __make_layer_sprite_vertices( instance, 0.f, 0.f, width, height, _node->matrix, instance->sprite_uv, _render );
+                __set_movie_render_geometry_sprite( _geometry, _render, instance, 0.f, 0.f, width, height, instance->sprite_uv );
             }
 
             _render->color.r = _node->color.r * resource_solid->color.r;
@@ -278,7 +548,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
 
             if( layer->extensions->mesh != AE_NULLPTR )
             {
-                __make_layer_mesh_vertices( layer->extensions->mesh, frame, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_layer_mesh( _geometry, _render, layer->extensions->mesh, frame, resource_image->uvs );
 
                 if( layer->cache != AE_NULLPTR )
                 {
@@ -294,7 +564,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
             }
             else if( layer->extensions->bezier_warp != AE_NULLPTR )
             {
-                make_layer_bezier_warp_vertices( instance, layer->extensions->bezier_warp, frame, _interpolate, t_frame, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_bezier_warp( _geometry, _render, instance, layer->extensions->bezier_warp, resource_image->uvs );
 
                 if( resource_image->cache != AE_NULLPTR )
                 {
@@ -303,7 +573,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
             }
             else if( resource_image->mesh != AE_NULLPTR && _trackmatte == AE_FALSE )
             {
-                __make_mesh_vertices( resource_image->mesh, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_mesh( _geometry, _render, resource_image->mesh, resource_image->uvs );
 
                 if( resource_image->cache != AE_NULLPTR )
                 {
@@ -318,7 +588,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
                 ae_float_t width = resource_image->trim_width;
                 ae_float_t height = resource_image->trim_height;
 
-                __make_layer_sprite_vertices( instance, offset_x, offset_y, width, height, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_sprite( _geometry, _render, instance, offset_x, offset_y, width, height, resource_image->uvs );
 
                 if( resource_image->cache != AE_NULLPTR )
                 {
@@ -335,7 +605,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
 
             if( layer->extensions->mesh != AE_NULLPTR )
             {
-                __make_layer_mesh_vertices( layer->extensions->mesh, frame, _node->matrix, AE_NULLPTR, _render );
+                __set_movie_render_geometry_layer_mesh( _geometry, _render, layer->extensions->mesh, frame, AE_NULLPTR );
 
                 if( layer->cache != AE_NULLPTR )
                 {
@@ -351,7 +621,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
             }
             else if( layer->extensions->bezier_warp != AE_NULLPTR )
             {
-                make_layer_bezier_warp_vertices( instance, layer->extensions->bezier_warp, frame, _interpolate, t_frame, _node->matrix, AE_NULLPTR, _render );
+                __set_movie_render_geometry_bezier_warp( _geometry, _render, instance, layer->extensions->bezier_warp, AE_NULLPTR );
 
                 if( resource_video->cache != AE_NULLPTR )
                 {
@@ -366,7 +636,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
                 ae_float_t width = resource_video->trim_width;
                 ae_float_t height = resource_video->trim_height;
 
-                __make_layer_sprite_vertices( instance, offset_x, offset_y, width, height, _node->matrix, instance->sprite_uv, _render );
+                __set_movie_render_geometry_sprite( _geometry, _render, instance, offset_x, offset_y, width, height, instance->sprite_uv );
 
                 if( resource_video->cache != AE_NULLPTR )
                 {
@@ -383,7 +653,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
 
             if( layer->extensions->mesh != AE_NULLPTR )
             {
-                __make_layer_mesh_vertices( layer->extensions->mesh, frame, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_layer_mesh( _geometry, _render, layer->extensions->mesh, frame, resource_image->uvs );
 
                 if( layer->cache != AE_NULLPTR )
                 {
@@ -399,7 +669,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
             }
             else if( layer->extensions->bezier_warp != AE_NULLPTR )
             {
-                make_layer_bezier_warp_vertices( instance, layer->extensions->bezier_warp, frame, _interpolate, t_frame, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_bezier_warp( _geometry, _render, instance, layer->extensions->bezier_warp, resource_image->uvs );
 
                 if( resource_image->cache != AE_NULLPTR )
                 {
@@ -408,7 +678,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
             }
             else if( resource_image->mesh != AE_NULLPTR && _trackmatte == AE_FALSE )
             {
-                __make_mesh_vertices( resource_image->mesh, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_mesh( _geometry, _render, resource_image->mesh, resource_image->uvs );
 
                 if( resource_image->cache != AE_NULLPTR )
                 {
@@ -423,7 +693,7 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
                 ae_float_t width = resource_image->trim_width;
                 ae_float_t height = resource_image->trim_height;
 
-                __make_layer_sprite_vertices( instance, offset_x, offset_y, width, height, _node->matrix, resource_image->uvs, _render );
+                __set_movie_render_geometry_sprite( _geometry, _render, instance, offset_x, offset_y, width, height, resource_image->uvs );
 
                 if( resource_image->cache != AE_NULLPTR )
                 {
@@ -438,49 +708,45 @@ AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _c
         {
             _render->vertexCount = 0;
             _render->indexCount = 0;
+            _render->indices = AE_NULLPTR;
 
             _render->color = _node->color;
             _render->opacity = _node->opacity * _node->extra_opacity;
         }break;
     }
-}
-//////////////////////////////////////////////////////////////////////////
-AE_INTERNAL aeMovieNode * __find_node_by_layer( aeMovieNode * _nodes, ae_uint32_t _begin, ae_uint32_t _end, const aeMovieLayerData * _layer )
-{
-    aeMovieNode * it_node = _nodes + _begin;
-    aeMovieNode * it_node_end = _nodes + _end;
-    for( ; it_node != it_node_end; ++it_node )
-    {
-        aeMovieNode * node = it_node;
-
-        const aeMovieLayerData * node_layer = node->layer_data;
-
-        if( node_layer == _layer )
-        {
-            return node;
-        }
-    }
 
-    return AE_NULLPTR;
+    _render->geometry_revision = __update_movie_render_geometry_revision( _composition, _node, _trackmatte, _render->resource, _geometry );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL const aeMovieLayerData * __find_layer_by_index( const aeMovieCompositionData * _compositionData, ae_uint32_t _index )
+AE_INTERNAL ae_void_t __compute_movie_render_mesh( const aeMovieComposition * _composition, const aeMovieNode * _node, aeMovieRenderMesh * _render, ae_bool_t _interpolate, ae_bool_t _trackmatte )
 {
-    const aeMovieLayerData * it_layer = _compositionData->layers;
-    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
-    for( ; it_layer != it_layer_end; ++it_layer )
-    {
-        const aeMovieLayerData * layer = it_layer;
-
-        ae_uint32_t layer_index = layer->index;
-
-        if( layer_index == _index )
-        {
-            return layer;
-        }
-    }
+    const aeMovieInstance * instance = _composition->movie_data->instance;
 
-    return AE_NULLPTR;
+    aeMovieRenderMeshEx render;
+    aeMovieRenderGeometry geometry;
+    __compute_movie_render_mesh_state( _composition, _node, &render, _trackmatte, &geometry );
+
+    aeMovieRenderVertexStream stream;
+    __make_movie_render_vertex_stream( &stream, _render->position, _render->uv );
+
+    __make_movie_render_geometry_vertices( instance, &geometry, _node, _interpolate, &stream );
+
+    _render->layer_type = render.layer_type;
+    _render->blend_mode = render.blend_mode;
+    _render->resource = render.resource;
+    _render->vertexCount = render.vertexCount;
+    _render->indexCount = render.indexCount;
+    _render->uv_cache_userdata = render.uv_cache_userdata;
+    _render->indices = render.indices;
+    _render->color = render.color;
+    _render->opacity = render.opacity;
+    _render->camera_userdata = render.camera_userdata;
+    _render->track_matte_mode = render.track_matte_mode;
+    _render->track_matte_userdata = render.track_matte_userdata;
+    _render->viewport = render.viewport;
+    _render->shader_userdata = render.shader_userdata;
+    _render->element_userdata = render.element_userdata;
+    _render->geometry_revision = render.geometry_revision;
 }
 //////////////////////////////////////////////////////////////////////////
 #ifdef AE_MOVIE_DEBUG
@@ -545,91 +811,327 @@ AE_INTERNAL ae_uint32_t __get_movie_frame_time( const aeMovieCompositionAnimatio
     return frame_relative;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __update_movie_composition_node_matrix( aeMovieNode * _node, const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, ae_uint32_t _frameId, ae_bool_t _interpolate, ae_float_t _t )
+AE_INTERNAL ae_bool_t __update_movie_composition_node_hold( const aeMovieNode * _node, aeMovieNodeSampling * _sampling, ae_uint32_t _frameId, ae_bool_t _interpolate )
 {
-    AE_UNUSED( _composition );
-    AE_UNUSED( _compositionData );
+    if( _frameId < _sampling->hold_begin || _frameId > _sampling->hold_end )
+    {
+        const aeMovieLayerData * node_layer = _node->layer_data;
 
-    const aeMovieLayerData * node_layer = _node->layer_data;
+        _sampling->hold = ae_movie_get_layer_transformation_hold( node_layer->transformation, &_sampling->cursors, node_layer->threeD, _frameId, &_sampling->hold_begin, &_sampling->hold_end );
+        _sampling->hold_matrix = AE_FALSE;
+    }
 
-#ifdef AE_MOVIE_DEBUG
-    if( __test_error_composition_layer_frame( _composition->movie_data->instance
-        , _compositionData
-        , node_layer
-        , _frameId
-        , "__update_movie_composition_node_matrix frame id out count"
-    ) == AE_FALSE )
+    if( _sampling->hold == AE_FALSE )
     {
-        return;
+        return AE_FALSE;
     }
-#endif
 
-#ifdef AE_MOVIE_SAFE
-    if( _frameId >= node_layer->frame_count )
+    if( _interpolate == AE_TRUE && _frameId >= _sampling->hold_end )
     {
-        return;
+        return AE_FALSE;
     }
-#endif
 
-    const struct aeMovieLayerTransformation * layer_transformation = node_layer->transformation;
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_movie_composition_node_matrix_sampled( const aeMovieNodeSampling * _sampling, ae_uint32_t _frameId, ae_bool_t _interpolate, ae_float_t _t )
+{
+    if( _sampling->matrix_sampled == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
 
-    ae_color_channel_t local_r = ae_movie_make_layer_color_r( layer_transformation, _frameId, _interpolate, _t );
-    ae_color_channel_t local_g = ae_movie_make_layer_color_g( layer_transformation, _frameId, _interpolate, _t );
-    ae_color_channel_t local_b = ae_movie_make_layer_color_b( layer_transformation, _frameId, _interpolate, _t );
+    if( _sampling->matrix_frame != _frameId || _sampling->matrix_interpolate != _interpolate || _sampling->matrix_t != _t )
+    {
+        return AE_FALSE;
+    }
 
-    ae_color_channel_t local_opacity = ae_movie_make_layer_opacity( layer_transformation, _frameId, _interpolate, _t );
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __get_movie_composition_node_relative_revision( const aeMovieComposition * _composition, const aeMovieNode * _node )
+{
+    const aeMovieNode * node_relative = _node->relative_node;
 
-    if( node_layer->extensions->volume != AE_NULLPTR )
+    if( node_relative == AE_NULLPTR )
     {
-        const struct aeMoviePropertyValue * property_volume = node_layer->extensions->volume->property_volume;
+        return 0U;
+    }
 
-        ae_float_t volume = __compute_movie_property_value( property_volume, _frameId, _interpolate, _t );
+    const aeMovieNodeSampling * relative_sampling = __get_movie_composition_node_sampling( _composition, node_relative );
 
-        _node->volume = volume;
+    return relative_sampling->matrix_revision;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_movie_composition_node_matrix_clean( const aeMovieNodeSampling * _sampling, ae_uint32_t _relativeRevision, ae_uint32_t _frameId, ae_bool_t _interpolate, ae_float_t _t )
+{
+    if( __is_movie_composition_node_matrix_sampled( _sampling, _frameId, _interpolate, _t ) == AE_FALSE )
+    {
+        return AE_FALSE;
     }
 
-    aeMovieNode * node_relative = _node->relative_node;
-
-    if( node_relative == AE_NULLPTR )
+    if( _sampling->matrix_relative_revision != _relativeRevision )
     {
-        ae_movie_make_layer_matrix( _node->matrix, layer_transformation, _interpolate, _frameId, _t );
+        return AE_FALSE;
+    }
 
-        if( node_layer->subcomposition_data != AE_NULLPTR )
-        {
-            _node->composition_color.r = local_r;
-            _node->composition_color.g = local_g;
-            _node->composition_color.b = local_b;
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __notify_movie_composition_node_matrix_changed( const aeMovieComposition * _composition, const aeMovieNode * _node )
+{
+    aeMovieNodeSampling * node_sampling = __get_movie_composition_node_sampling( _composition, _node );
 
-            _node->composition_opacity = local_opacity;
-        }
-        else
-        {
-            _node->composition_color.r = 1.f;
-            _node->composition_color.g = 1.f;
-            _node->composition_color.b = 1.f;
+    ae_bool_t matrix_changed = (node_sampling->matrix_notify_revision != node_sampling->matrix_revision) ? AE_TRUE : AE_FALSE;
 
-            _node->composition_opacity = 1.f;
-        }
+    node_sampling->matrix_notify_revision = node_sampling->matrix_revision;
 
-        _node->color.r = local_r;
-        _node->color.g = local_g;
-        _node->color.b = local_b;
+    return matrix_changed;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const ae_float_t * __get_movie_composition_node_cache_matrix( const aeMovieNode * _node, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _frameId )
+{
+    const aeMovieLayerData * node_layer = _node->layer_data;
+    const aeMovieCompositionData * layer_composition_data = node_layer->composition_data;
 
-        _node->opacity = local_opacity;
+    aeMovieCompositionMatrixCache * matrix_cache = layer_composition_data->matrix_cache;
 
-        return;
+    if( matrix_cache == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
+    }
+
+    const aeMovieLayerTransformation * layer_transformation = node_layer->transformation;
+
+    if( layer_transformation->immutable_matrix != AE_NULLPTR || _frameId >= node_layer->frame_count )
+    {
+        return AE_NULLPTR;
     }
 
     if( (layer_transformation->identity_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL )
     {
-        ae_copy_m34( _node->matrix, node_relative->matrix );
+        return AE_NULLPTR;
     }
-    else
+
+    ae_uint32_t layer_position = (ae_uint32_t)(node_layer - layer_composition_data->layers);
+
+    ae_uint32_t * slot = matrix_cache->slots + matrix_cache->layer_offsets[layer_position] + _frameId;
+
+    if( *slot != 0U )
     {
-        ae_matrix34_t local_matrix;
-        ae_movie_make_layer_matrix( local_matrix, layer_transformation, _interpolate, _frameId, _t );
+        ++matrix_cache->hits;
 
-        ae_mul_m34_m34_r( _node->matrix, local_matrix, node_relative->matrix );
+        return matrix_cache->entries[*slot - 1U].matrix;
+    }
+
+    ++matrix_cache->misses;
+
+    ae_uint32_t entry_index;
+
+    if( matrix_cache->count != matrix_cache->capacity )
+    {
+        entry_index = matrix_cache->count++;
+    }
+    else
+    {
+        entry_index = matrix_cache->evict;
+
+        matrix_cache->evict = (entry_index + 1U == matrix_cache->capacity) ? 0U : entry_index + 1U;
+
+        *matrix_cache->entries[entry_index].slot = 0U;
+
+        ++matrix_cache->evictions;
+    }
+
+    aeMovieCompositionMatrixCacheEntry * entry = matrix_cache->entries + entry_index;
+
+    ae_movie_make_layer_matrix( entry->matrix, layer_transformation, _cursors, AE_FALSE, _frameId, 0.f );
+
+    entry->slot = slot;
+    *slot = entry_index + 1U;
+
+    return entry->matrix;
+}
+//////////////////////////////////////////////////////////////////////////
+//local matrix built ahead by a node matrix batch and the sample it was built for
+typedef struct aeMovieNodeLocalMatrix
+{
+    ae_uint32_t frame;
+    ae_bool_t interpolate;
+    ae_float_t t;
+
+    ae_matrix34_t matrix;
+} aeMovieNodeLocalMatrix;
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_movie_node_local_matrix_sample( const aeMovieNodeLocalMatrix * _local, ae_uint32_t _frameId, ae_bool_t _interpolate, ae_float_t _t )
+{
+    if( _local == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    if( _local->frame != _frameId || _local->interpolate != _interpolate || _local->t != _t )
+    {
+        return AE_FALSE;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __update_movie_composition_node_matrix( aeMovieNode * _node, const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, ae_uint32_t _frameId, ae_bool_t _interpolate, ae_float_t _t, const aeMovieNodeLocalMatrix * _local )
+{
+    AE_UNUSED( _compositionData );
+
+    const aeMovieLayerData * node_layer = _node->layer_data;
+
+    aeMovieNodeSampling * node_sampling = __get_movie_composition_node_sampling( _composition, _node );
+
+    aeMovieLayerTransformationCursors * node_cursors = &node_sampling->cursors;
+
+#ifdef AE_MOVIE_DEBUG
+    if( __test_error_composition_layer_frame( _composition->movie_data->instance
+        , _compositionData
+        , node_layer
+        , _frameId
+        , "__update_movie_composition_node_matrix frame id out count"
+    ) == AE_FALSE )
+    {
+        return;
+    }
+#endif
+
+#ifdef AE_MOVIE_SAFE
+    if( _frameId >= node_layer->frame_count )
+    {
+        return;
+    }
+#endif
+
+    if( node_layer->extensions->volume != AE_NULLPTR )
+    {
+        const struct aeMoviePropertyValue * property_volume = node_layer->extensions->volume->property_volume;
+
+        ae_float_t volume = __compute_movie_property_value( property_volume, _frameId, _interpolate, _t );
+
+        __get_movie_composition_node_cold( _composition, _node )->volume = volume;
+    }
+
+    const struct aeMovieLayerTransformation * layer_transformation = node_layer->transformation;
+
+    aeMovieNode * node_relative = _node->relative_node;
+
+    ae_uint32_t relative_revision = __get_movie_composition_node_relative_revision( _composition, _node );
+
+    //same local frame under an unchanged parent, the whole subtree below keep its revision too
+    if( __is_movie_composition_node_matrix_clean( node_sampling, relative_revision, _frameId, _interpolate, _t ) == AE_TRUE )
+    {
+        ++node_sampling->matrix_skip_count;
+
+        return;
+    }
+
+    node_sampling->matrix_sampled = AE_TRUE;
+    node_sampling->matrix_frame = _frameId;
+    node_sampling->matrix_interpolate = _interpolate;
+    node_sampling->matrix_t = _t;
+    node_sampling->matrix_relative_revision = relative_revision;
+
+    ae_bool_t node_interpolate = _interpolate;
+    ae_float_t node_t = _t;
+
+    if( __update_movie_composition_node_hold( _node, node_sampling, _frameId, _interpolate ) == AE_TRUE )
+    {
+        if( node_sampling->hold_matrix == AE_TRUE && node_sampling->hold_relative_revision == relative_revision )
+        {
+            ++node_sampling->matrix_skip_count;
+
+            return;
+        }
+
+        node_sampling->hold_matrix = AE_TRUE;
+        node_sampling->hold_relative_revision = relative_revision;
+
+        //equal neighbours, sample at the frame itself but keep the interpolated path and its quaternion normalisation
+        node_t = 0.f;
+    }
+    else
+    {
+        node_sampling->hold_matrix = AE_FALSE;
+    }
+
+    ++node_sampling->matrix_revision;
+
+    ae_color_t local_color;
+    ae_color_channel_t local_opacity;
+    ae_movie_make_layer_color( &local_color, &local_opacity, layer_transformation, node_cursors, _frameId, node_interpolate, node_t );
+
+    ae_color_channel_t local_r = local_color.r;
+    ae_color_channel_t local_g = local_color.g;
+    ae_color_channel_t local_b = local_color.b;
+
+    const ae_float_t * node_local_matrix = AE_NULLPTR;
+
+    //a held node is sampled at the frame itself, not at the batched sample
+    if( node_t == _t && __is_movie_node_local_matrix_sample( _local, _frameId, _interpolate, _t ) == AE_TRUE )
+    {
+        node_local_matrix = _local->matrix;
+    }
+    else if( node_interpolate == AE_FALSE )
+    {
+        node_local_matrix = __get_movie_composition_node_cache_matrix( _node, node_cursors, _frameId );
+    }
+
+    if( node_relative == AE_NULLPTR )
+    {
+        if( node_local_matrix != AE_NULLPTR )
+        {
+            ae_copy_m34( _node->matrix, node_local_matrix );
+        }
+        else
+        {
+            ae_movie_make_layer_matrix( _node->matrix, layer_transformation, node_cursors, node_interpolate, _frameId, node_t );
+        }
+
+        if( node_layer->subcomposition_data != AE_NULLPTR )
+        {
+            _node->composition_color.r = local_r;
+            _node->composition_color.g = local_g;
+            _node->composition_color.b = local_b;
+
+            _node->composition_opacity = local_opacity;
+        }
+        else
+        {
+            _node->composition_color.r = 1.f;
+            _node->composition_color.g = 1.f;
+            _node->composition_color.b = 1.f;
+
+            _node->composition_opacity = 1.f;
+        }
+
+        _node->color.r = local_r;
+        _node->color.g = local_g;
+        _node->color.b = local_b;
+
+        _node->opacity = local_opacity;
+
+        return;
+    }
+
+    if( (layer_transformation->identity_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL )
+    {
+        ae_copy_m34( _node->matrix, node_relative->matrix );
+    }
+    else if( node_local_matrix != AE_NULLPTR )
+    {
+        ae_mul_m34_m34_r( _node->matrix, node_local_matrix, node_relative->matrix );
+    }
+    else
+    {
+        ae_matrix34_t local_matrix;
+        ae_movie_make_layer_matrix( local_matrix, layer_transformation, node_cursors, node_interpolate, _frameId, node_t );
+
+        ae_mul_m34_m34_r( _node->matrix, local_matrix, node_relative->matrix );
     }
 
     if( node_layer->subcomposition_data != AE_NULLPTR )
@@ -656,6 +1158,139 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_matrix( aeMovieNode * _nod
     _node->opacity = node_relative->composition_opacity * local_opacity;
 }
 //////////////////////////////////////////////////////////////////////////
+//nodes of one deep level, their parents are finished before the level is gathered
+typedef struct aeMovieNodeMatrixBatch
+{
+    ae_uint32_t count;
+    ae_uint32_t deep;
+
+    aeMovieNode * nodes[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_uint32_t slots[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    aeMovieNodeLocalMatrix locals[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+
+    aeMovieLayerTransformation2DBatch transformation2d;
+} aeMovieNodeMatrixBatch;
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __clear_movie_composition_node_matrix_batch( aeMovieNodeMatrixBatch * _batch, ae_uint32_t _deep )
+{
+    _batch->count = 0U;
+    _batch->deep = _deep;
+
+    _batch->transformation2d.count = 0U;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_movie_composition_node_matrix_batch_full( const aeMovieNodeMatrixBatch * _batch, ae_uint32_t _deep )
+{
+    if( _batch->count == AE_MOVIE_TRANSFORMATION_BATCH_SIZE || _batch->deep != _deep )
+    {
+        return AE_TRUE;
+    }
+
+    return AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __skip_movie_composition_node_matrix_batch( aeMovieNodeMatrixBatch * _batch, aeMovieNode * _node )
+{
+    ae_uint32_t index = _batch->count++;
+
+    _batch->nodes[index] = _node;
+    _batch->slots[index] = ~0U;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __push_movie_composition_node_matrix_batch( aeMovieNodeMatrixBatch * _batch, const aeMovieComposition * _composition, aeMovieNode * _node, ae_uint32_t _frameId, ae_bool_t _interpolate, ae_float_t _t )
+{
+    ae_uint32_t index = _batch->count++;
+
+    _batch->nodes[index] = _node;
+    _batch->slots[index] = ~0U;
+
+    aeMovieNodeLocalMatrix * local = _batch->locals + index;
+
+    local->frame = _frameId;
+    local->interpolate = _interpolate;
+    local->t = _t;
+
+#ifdef AE_MOVIE_TRANSFORMATION_BATCH
+    const aeMovieLayerData * node_layer = _node->layer_data;
+
+    if( node_layer->threeD == AE_TRUE || _frameId >= node_layer->frame_count )
+    {
+        return;
+    }
+
+    //fixed frames are served by the matrix cache when there is one
+    if( _interpolate == AE_FALSE && node_layer->composition_data->matrix_cache != AE_NULLPTR )
+    {
+        return;
+    }
+
+    aeMovieNodeSampling * node_sampling = __get_movie_composition_node_sampling( _composition, _node );
+
+    //an already sampled local frame is skipped or rebuilt against a new parent by the scalar path
+    if( __is_movie_composition_node_matrix_sampled( node_sampling, _frameId, _interpolate, _t ) == AE_TRUE )
+    {
+        return;
+    }
+
+    if( __update_movie_composition_node_hold( _node, node_sampling, _frameId, _interpolate ) == AE_TRUE )
+    {
+        return;
+    }
+
+    ae_movie_gather_layer_transformation2d_batch( &_batch->transformation2d, node_layer->transformation, &node_sampling->cursors, _interpolate, _frameId, _t, _batch->slots + index );
+#else
+    AE_UNUSED( _composition );
+#endif
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __make_movie_composition_node_matrix_batch( aeMovieNodeMatrixBatch * _batch )
+{
+    if( _batch->transformation2d.count == 0U )
+    {
+        return;
+    }
+
+    ae_movie_make_layer_transformation2d_batch( &_batch->transformation2d );
+
+    for( ae_uint32_t index = 0U; index != _batch->count; ++index )
+    {
+        ae_uint32_t slot = _batch->slots[index];
+
+        if( slot == ~0U )
+        {
+            continue;
+        }
+
+        ae_movie_get_layer_transformation2d_batch_matrix( _batch->locals[index].matrix, &_batch->transformation2d, slot );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const aeMovieNodeLocalMatrix * __get_movie_composition_node_matrix_batch_local( const aeMovieNodeMatrixBatch * _batch, ae_uint32_t _index )
+{
+    if( _batch->slots[_index] == ~0U )
+    {
+        return AE_NULLPTR;
+    }
+
+    return _batch->locals + _index;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __flush_movie_composition_node_matrix_batch( aeMovieNodeMatrixBatch * _batch, const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData )
+{
+    __make_movie_composition_node_matrix_batch( _batch );
+
+    for( ae_uint32_t index = 0U; index != _batch->count; ++index )
+    {
+        aeMovieNode * node = _batch->nodes[index];
+
+        const aeMovieNodeLocalMatrix * local = _batch->locals + index;
+
+        const aeMovieNodeLocalMatrix * batch_local = __get_movie_composition_node_matrix_batch_local( _batch, index );
+
+        __update_movie_composition_node_matrix( node, _composition, _compositionData, local->frame, local->interpolate, local->t, batch_local );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __update_movie_composition_node_shader( aeMovieNode * _node, const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, ae_uint32_t _frameId, ae_bool_t _interpolate, ae_float_t _t )
 {
     AE_UNUSED( _compositionData );
@@ -683,6 +1318,8 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_shader( aeMovieNode * _nod
 
     const aeMovieLayerExtensionShader * shader = node_layer->extensions->shader;
 
+    ae_userdata_t shader_userdata = __get_movie_composition_node_cold( _composition, _node )->shader_userdata;
+
     const struct aeMovieLayerShaderParameter ** it_parameter = shader->parameters;
     const struct aeMovieLayerShaderParameter ** it_parameter_end = shader->parameters + shader->parameter_count;
 
@@ -706,7 +1343,7 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_shader( aeMovieNode * _nod
 
                 aeMovieShaderPropertyUpdateCallbackData callbackData;
                 callbackData.index = index;
-                callbackData.element_userdata = _node->shader_userdata;
+                callbackData.element_userdata = shader_userdata;
                 callbackData.name = parameter_slider->name;
                 callbackData.uniform = parameter_slider->uniform;
                 callbackData.type = parameter_slider->type;
@@ -726,7 +1363,7 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_shader( aeMovieNode * _nod
 
                 aeMovieShaderPropertyUpdateCallbackData callbackData;
                 callbackData.index = index;
-                callbackData.element_userdata = _node->shader_userdata;
+                callbackData.element_userdata = shader_userdata;
                 callbackData.name = parameter_angle->name;
                 callbackData.uniform = parameter_angle->uniform;
                 callbackData.type = parameter_angle->type;
@@ -750,7 +1387,7 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_shader( aeMovieNode * _nod
 
                 aeMovieShaderPropertyUpdateCallbackData callbackData;
                 callbackData.index = index;
-                callbackData.element_userdata = _node->shader_userdata;
+                callbackData.element_userdata = shader_userdata;
                 callbackData.name = parameter_color->name;
                 callbackData.uniform = parameter_color->uniform;
                 callbackData.type = parameter_color->type;
@@ -768,7 +1405,7 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_shader( aeMovieNode * _nod
 
                 aeMovieShaderPropertyUpdateCallbackData callbackData;
                 callbackData.index = index;
-                callbackData.element_userdata = _node->shader_userdata;
+                callbackData.element_userdata = shader_userdata;
                 callbackData.name = parameter_time->name;
                 callbackData.uniform = parameter_time->uniform;
                 callbackData.type = parameter_time->type;
@@ -816,49 +1453,187 @@ AE_INTERNAL ae_uint32_t __get_movie_composition_data_node_count( const aeMovieCo
     return count;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_bool_t __setup_movie_node_track_matte( aeMovieNode * _nodes, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, aeMovieNode * _trackMatte )
+AE_INTERNAL ae_uint32_t __get_movie_composition_data_subcomposition_count( const aeMovieCompositionData * _compositionData )
 {
+    ae_uint32_t count = 0U;
+
     const aeMovieLayerData * it_layer = _compositionData->layers;
     const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
     for( ; it_layer != it_layer_end; ++it_layer )
     {
         const aeMovieLayerData * layer = it_layer;
 
-        aeMovieNode * node = _nodes + ((*_iterator)++);
-
-        const aeMovieLayerData * node_layer = node->layer_data;
-
-        aeMovieLayerTypeEnum layer_type = node_layer->type;
+        aeMovieLayerTypeEnum layer_type = layer->type;
 
-        if( _trackMatte == AE_NULLPTR )
+        switch( layer_type )
         {
-            if( layer->has_track_matte == AE_TRUE )
+        case AE_MOVIE_LAYER_TYPE_MOVIE:
             {
-                switch( layer_type )
-                {
-                case AE_MOVIE_LAYER_TYPE_MOVIE:
-                case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
-                    {
-                        ae_uint32_t sub_composition_node_count = __get_movie_composition_data_node_count( node_layer->subcomposition_data );
-
-                        aeMovieNode * track_matte_node = _nodes + (*_iterator) + sub_composition_node_count;
+                count += __get_movie_composition_data_subcomposition_count( layer->subcomposition_data );
+            }break;
+        case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
+            {
+                count += 1U + __get_movie_composition_data_subcomposition_count( layer->subcomposition_data );
+            }break;
+        default:
+            {
+            }break;
+        }
+    }
 
-                        node->track_matte_node = track_matte_node;
-                        node->track_matte_userdata = AE_NULLPTR;
-                    }break;
+    return count;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_size_t __align_movie_composition_arena( ae_size_t _size )
+{
+    ae_size_t size = (_size + (AE_MOVIE_COMPOSITION_ARENA_ALIGN - 1U)) & ~(ae_size_t)(AE_MOVIE_COMPOSITION_ARENA_ALIGN - 1U);
+
+    return size;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_size_t __get_movie_composition_arena_size( ae_uint32_t _nodeCount, ae_uint32_t _subcompositionCount )
+{
+    ae_size_t size = 0U;
+
+    size += __align_movie_composition_arena( sizeof( aeMovieComposition ) );
+    size += __align_movie_composition_arena( sizeof( aeMovieCompositionAnimation ) );
+    size += __align_movie_composition_arena( sizeof( aeMovieNode ) * _nodeCount );
+    size += __align_movie_composition_arena( sizeof( aeMovieNode * ) * _nodeCount );
+    size += __align_movie_composition_arena( sizeof( ae_uint32_t ) * _nodeCount );
+    size += __align_movie_composition_arena( sizeof( ae_uint32_t ) * _nodeCount );
+    size += __align_movie_composition_arena( sizeof( aeMovieNodeInterval ) * _nodeCount );
+    size += __align_movie_composition_arena( sizeof( ae_uint32_t ) * _nodeCount * 5U );
+    size += __align_movie_composition_arena( sizeof( aeMovieNodeIntervalIndex ) * (_subcompositionCount + 1U) );
+    size += __align_movie_composition_arena( sizeof( aeMovieSubComposition ) * _subcompositionCount );
+    size += __align_movie_composition_arena( sizeof( aeMovieCompositionAnimation ) * _subcompositionCount );
+    size += __align_movie_composition_arena( sizeof( aeMovieNodeSampling ) * _nodeCount );
+    size += __align_movie_composition_arena( sizeof( aeMovieNodeCold ) * _nodeCount );
+    size += __align_movie_composition_arena( sizeof( aeMovieNodeGeometry ) * _nodeCount * 2U );
+
+    return size;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_voidptr_t __carve_movie_composition_arena( ae_uint8_t ** _cursor, ae_size_t _size )
+{
+    ae_voidptr_t ptr = *_cursor;
+
+    *_cursor += __align_movie_composition_arena( _size );
+
+    return ptr;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __acquire_movie_data_composition( const aeMovieData * _movieData )
+{
+    //bookkeeping only, no sampling path reads it; the bake refuses to run while it is not zero
+    aeMovieData * movie_data = (aeMovieData *)_movieData;
+
+    ++movie_data->composition_live_count;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __release_movie_data_composition( const aeMovieData * _movieData )
+{
+    aeMovieData * movie_data = (aeMovieData *)_movieData;
+
+    --movie_data->composition_live_count;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieComposition * __new_movie_composition_arena( const aeMovieInstance * _instance, ae_uint32_t _nodeCount, ae_uint32_t _subcompositionCount )
+{
+    ae_size_t size = __get_movie_composition_arena_size( _nodeCount, _subcompositionCount );
+
+    ae_uint8_t * arena = (ae_uint8_t *)AE_NEWV( _instance, size, "aeMovieCompositionArena" );
+
+    if( arena == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
+    }
+
+    //composition first, delete free one block from it
+    ae_uint8_t * cursor = arena;
+
+    aeMovieComposition * composition = (aeMovieComposition *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieComposition ) );
+
+    composition->animation = (aeMovieCompositionAnimation *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieCompositionAnimation ) );
+
+    composition->node_count = _nodeCount;
+    composition->nodes = (aeMovieNode *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieNode ) * _nodeCount );
+    composition->update_nodes = (aeMovieNode **)__carve_movie_composition_arena( &cursor, sizeof( aeMovieNode * ) * _nodeCount );
+    composition->update_node_enumerators = (ae_uint32_t *)__carve_movie_composition_arena( &cursor, sizeof( ae_uint32_t ) * _nodeCount );
+    composition->update_node_deeps = (ae_uint32_t *)__carve_movie_composition_arena( &cursor, sizeof( ae_uint32_t ) * _nodeCount );
+    composition->update_node_count = 0U;
+
+    composition->update_node_intervals = (aeMovieNodeInterval *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieNodeInterval ) * _nodeCount );
+    composition->update_node_interval_orders = (ae_uint32_t *)__carve_movie_composition_arena( &cursor, sizeof( ae_uint32_t ) * _nodeCount * 5U );
+    composition->update_node_interval_indices = (aeMovieNodeIntervalIndex *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieNodeIntervalIndex ) * (_subcompositionCount + 1U) );
+
+    composition->subcomposition_count = _subcompositionCount;
+    composition->subcompositions = AE_NULLPTR;
+
+    if( _subcompositionCount != 0U )
+    {
+        aeMovieSubComposition * subcompositions = (aeMovieSubComposition *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieSubComposition ) * _subcompositionCount );
+        aeMovieCompositionAnimation * animations = (aeMovieCompositionAnimation *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieCompositionAnimation ) * _subcompositionCount );
+
+        for( ae_uint32_t index = 0U; index != _subcompositionCount; ++index )
+        {
+            subcompositions[index].animation = animations + index;
+        }
+
+        composition->subcompositions = subcompositions;
+    }
+
+    //timeline cursors and matrix revisions, read only when a node matrix is resampled
+    composition->node_samplings = (aeMovieNodeSampling *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieNodeSampling ) * _nodeCount );
+
+    //cold node data stays out of the way of the update and mesh loops
+    composition->node_colds = (aeMovieNodeCold *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieNodeCold ) * _nodeCount );
+
+    //render geometry of the mesh queries, then of the track matte pass, per node
+    composition->node_geometries = (aeMovieNodeGeometry *)__carve_movie_composition_arena( &cursor, sizeof( aeMovieNodeGeometry ) * _nodeCount * 2U );
+
+    return composition;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __setup_movie_node_track_matte( aeMovieNode * _nodes, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, aeMovieNode * _trackMatte )
+{
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        aeMovieNode * node = _nodes + ((*_iterator)++);
+
+        const aeMovieLayerData * node_layer = node->layer_data;
+
+        aeMovieLayerTypeEnum layer_type = node_layer->type;
+
+        if( _trackMatte == AE_NULLPTR )
+        {
+            if( layer->has_track_matte == AE_TRUE )
+            {
+                switch( layer_type )
+                {
+                case AE_MOVIE_LAYER_TYPE_MOVIE:
+                case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
+                    {
+                        ae_uint32_t sub_composition_node_count = __get_movie_composition_data_node_count( node_layer->subcomposition_data );
+
+                        aeMovieNode * track_matte_node = _nodes + (*_iterator) + sub_composition_node_count;
+
+                        node->track_matte_node = track_matte_node;
+                    }break;
                 default:
                     {
                         aeMovieNode * track_matte_node = _nodes + (*_iterator);
 
                         node->track_matte_node = track_matte_node;
-                        node->track_matte_userdata = AE_NULLPTR;
                     }break;
                 }
             }
             else
             {
                 node->track_matte_node = AE_NULLPTR;
-                node->track_matte_userdata = AE_NULLPTR;
             }
         }
         else
@@ -870,7 +1645,6 @@ AE_INTERNAL ae_bool_t __setup_movie_node_track_matte( aeMovieNode * _nodes, ae_u
             else
             {
                 node->track_matte_node = _trackMatte;
-                node->track_matte_userdata = AE_NULLPTR;
             }
         }
 
@@ -910,6 +1684,8 @@ AE_INTERNAL ae_bool_t __setup_movie_node_track_matte2( aeMovieComposition * _com
 
         const aeMovieLayerData * layer = node->layer_data;
 
+        aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, node );
+
         if( layer->is_track_matte == AE_TRUE )
         {
             aeMovieRenderMesh mesh;
@@ -917,7 +1693,7 @@ AE_INTERNAL ae_bool_t __setup_movie_node_track_matte2( aeMovieComposition * _com
 
             aeMovieTrackMatteProviderCallbackData callbackData;
             callbackData.index = enumerator;
-            callbackData.element_userdata = node->element_userdata;
+            callbackData.element_userdata = node_cold->element_userdata;
             callbackData.layer_data = layer;
             callbackData.loop = AE_FALSE;
             callbackData.offset = AE_TIME_OUTSCALE( node->start_time );
@@ -935,11 +1711,11 @@ AE_INTERNAL ae_bool_t __setup_movie_node_track_matte2( aeMovieComposition * _com
                 return AE_FALSE;
             }
 
-            node->track_matte_userdata = track_matte_userdata;
+            node_cold->track_matte_userdata = track_matte_userdata;
         }
         else
         {
-            node->track_matte_userdata = AE_NULLPTR;
+            node_cold->track_matte_userdata = AE_NULLPTR;
         }
     }
 
@@ -977,7 +1753,7 @@ AE_INTERNAL ae_bool_t __setup_movie_composition_scene_effect( aeMovieComposition
 
         aeMovieCompositionSceneEffectProviderCallbackData callbackData;
         callbackData.index = enumerator;
-        callbackData.element_userdata = node->element_userdata;
+        callbackData.element_userdata = __get_movie_composition_node_cold( _composition, node )->element_userdata;
 
         ae_movie_make_layer_transformation2d_fixed( callbackData.anchor_point, callbackData.position, callbackData.scale, callbackData.quaternion, callbackData.skew, transformation2d, 0 );
         ae_movie_make_layer_transformation_color_fixed( &callbackData.color, &callbackData.opacity, layer->transformation, 0 );
@@ -996,34 +1772,6 @@ AE_INTERNAL ae_bool_t __setup_movie_composition_scene_effect( aeMovieComposition
     return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_uint32_t __get_movie_subcomposition_count( const aeMovieComposition * _composition )
-{
-    ae_uint32_t count = 0;
-
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
-    {
-        aeMovieNode * node = it_node;
-
-        if( node->ignore == AE_TRUE )
-        {
-            continue;
-        }
-
-        const aeMovieLayerData * layer = node->layer_data;
-
-        if( layer->type != AE_MOVIE_LAYER_TYPE_SUB_MOVIE )
-        {
-            continue;
-        }
-
-        ++count;
-    }
-
-    return count;
-}
-//////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_bool_t __setup_movie_subcomposition2( aeMovieComposition * _composition, ae_uint32_t * _node_iterator, aeMovieSubComposition * _subcompositions, ae_uint32_t * _subcomposition_iterator, const aeMovieCompositionData * _compositionData, const aeMovieSubComposition * _subcomposition )
 {
     const aeMovieLayerData * it_layer = _compositionData->layers;
@@ -1057,9 +1805,7 @@ AE_INTERNAL ae_bool_t __setup_movie_subcomposition2( aeMovieComposition * _compo
                 subcomposition->composition_data = layer->composition_data;
                 subcomposition->subcomposition_data = layer->subcomposition_data;
 
-                aeMovieCompositionAnimation * animation = AE_NEW( _composition->movie_data->instance, aeMovieCompositionAnimation );
-
-                AE_MOVIE_PANIC_MEMORY( animation, AE_FALSE );
+                aeMovieCompositionAnimation * animation = subcomposition->animation;
 
                 animation->enable = AE_TRUE;
                 animation->play = AE_FALSE;
@@ -1078,20 +1824,11 @@ AE_INTERNAL ae_bool_t __setup_movie_subcomposition2( aeMovieComposition * _compo
                 animation->work_area_time_begin = __correct_timeline_frame_time( 0.f, _compositionData, &animation->work_area_frame_begin );
                 animation->work_area_time_end = __correct_timeline_frame_time( sub_composition_data->duration_time, _compositionData, &animation->work_area_frame_end );
 
-                subcomposition->animation = animation;
-
-                aeMovieSubCompositionProviderCallbackData callbackData;
-                callbackData.layer_data = subcomposition->layer_data;
-                callbackData.composition_data = subcomposition->composition_data;
-                callbackData.animation = subcomposition->animation;
-
-                ae_userdata_t subcomposition_userdata = AE_USERDATA_NULL;
-                if( (*_composition->providers.subcomposition_provider)(&callbackData, &subcomposition_userdata, _composition->provider_userdata) == AE_FALSE )
-                {
-                    return AE_FALSE;
-                }
+                animation->camera_sampled = AE_FALSE;
+                animation->camera_frame = 0U;
+                animation->camera_t = 0.f;
 
-                subcomposition->subcomposition_userdata = subcomposition_userdata;
+                subcomposition->subcomposition_userdata = AE_USERDATA_NULL;
 
                 if( __setup_movie_subcomposition2( _composition, _node_iterator, _subcompositions, _subcomposition_iterator, layer->subcomposition_data, subcomposition ) == AE_FALSE )
                 {
@@ -1109,35 +1846,43 @@ AE_INTERNAL ae_bool_t __setup_movie_subcomposition2( aeMovieComposition * _compo
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_bool_t __setup_movie_subcomposition( aeMovieComposition * _composition )
 {
-    ae_uint32_t subcomposition_count = __get_movie_subcomposition_count( _composition );
+    ae_uint32_t node_iterator = 0U;
+    ae_uint32_t subcomposition_iterator = 0U;
 
-    if( subcomposition_count == 0U )
+    if( __setup_movie_subcomposition2( _composition, &node_iterator, _composition->subcompositions, &subcomposition_iterator, _composition->composition_data, AE_NULLPTR ) == AE_FALSE )
     {
-        _composition->subcomposition_count = 0U;
-        _composition->subcompositions = AE_NULLPTR;
-
-        return AE_TRUE;
+        return AE_FALSE;
     }
 
-    aeMovieSubComposition * subcompositions = AE_NEWN( _composition->movie_data->instance, aeMovieSubComposition, subcomposition_count );
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __setup_movie_subcomposition_provider( aeMovieComposition * _composition )
+{
+    aeMovieSubComposition * it_subcomposition = _composition->subcompositions;
+    aeMovieSubComposition * it_subcomposition_end = _composition->subcompositions + _composition->subcomposition_count;
+    for( ; it_subcomposition != it_subcomposition_end; ++it_subcomposition )
+    {
+        aeMovieSubComposition * subcomposition = it_subcomposition;
 
-    AE_MOVIE_PANIC_MEMORY( subcompositions, AE_FALSE );
+        aeMovieSubCompositionProviderCallbackData callbackData;
+        callbackData.layer_data = subcomposition->layer_data;
+        callbackData.composition_data = subcomposition->composition_data;
+        callbackData.animation = subcomposition->animation;
 
-    ae_uint32_t node_iterator = 0U;
-    ae_uint32_t subcomposition_iterator = 0U;
+        ae_userdata_t subcomposition_userdata = AE_USERDATA_NULL;
+        if( (*_composition->providers.subcomposition_provider)(&callbackData, &subcomposition_userdata, _composition->provider_userdata) == AE_FALSE )
+        {
+            return AE_FALSE;
+        }
 
-    if( __setup_movie_subcomposition2( _composition, &node_iterator, subcompositions, &subcomposition_iterator, _composition->composition_data, AE_NULLPTR ) == AE_FALSE )
-    {
-        return AE_FALSE;
+        subcomposition->subcomposition_userdata = subcomposition_userdata;
     }
 
-    _composition->subcomposition_count = subcomposition_count;
-    _composition->subcompositions = subcompositions;
-
     return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __setup_movie_node_initialize( aeMovieNode * _nodes, ae_uint32_t _count )
+AE_INTERNAL ae_void_t __setup_movie_node_initialize( aeMovieNode * _nodes, aeMovieNodeSampling * _samplings, aeMovieNodeCold * _colds, aeMovieNodeGeometry * _geometries, ae_uint32_t _count )
 {
     aeMovieNode * it_node = _nodes;
     aeMovieNode * it_node_end = _nodes + _count;
@@ -1146,182 +1891,815 @@ AE_INTERNAL ae_void_t __setup_movie_node_initialize( aeMovieNode * _nodes, ae_ui
         aeMovieNode * node = it_node;
 
         node->subcomposition = AE_NULLPTR;
-        node->volume = 1.f;
         node->extra_opacity = 1.f;
     }
-}
-//////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_uint32_t _calc_node_relative_deep( aeMovieNode * _node )
-{
-    ae_uint32_t deep = 0;
 
-    while( _node->relative_node != AE_NULLPTR )
+    aeMovieNodeSampling * it_sampling = _samplings;
+    aeMovieNodeSampling * it_sampling_end = _samplings + _count;
+    for( ; it_sampling != it_sampling_end; ++it_sampling )
+    {
+        aeMovieNodeSampling * node_sampling = it_sampling;
+
+        ae_movie_clear_layer_transformation_cursors( &node_sampling->cursors );
+
+        node_sampling->hold_begin = 1U;
+        node_sampling->hold_end = 0U;
+        node_sampling->hold = AE_FALSE;
+        node_sampling->hold_matrix = AE_FALSE;
+        node_sampling->hold_relative_revision = 0U;
+
+        node_sampling->matrix_revision = 0U;
+        node_sampling->matrix_skip_count = 0U;
+
+        node_sampling->matrix_sampled = AE_FALSE;
+        node_sampling->matrix_frame = 0U;
+        node_sampling->matrix_interpolate = AE_FALSE;
+        node_sampling->matrix_t = 0.f;
+        node_sampling->matrix_relative_revision = 0U;
+        node_sampling->matrix_notify_revision = ~0U;
+    }
+
+    aeMovieNodeCold * it_cold = _colds;
+    aeMovieNodeCold * it_cold_end = _colds + _count;
+    for( ; it_cold != it_cold_end; ++it_cold )
     {
-        ++deep;
+        aeMovieNodeCold * node_cold = it_cold;
 
-        _node = _node->relative_node;
+        node_cold->volume = 1.f;
+        node_cold->viewport = AE_NULLPTR;
+
+        node_cold->element_userdata = AE_USERDATA_NULL;
+        node_cold->camera_userdata = AE_USERDATA_NULL;
+        node_cold->shader_userdata = AE_USERDATA_NULL;
+        node_cold->track_matte_userdata = AE_USERDATA_NULL;
     }
 
-    return deep;
+    aeMovieNodeGeometry * it_geometry = _geometries;
+    aeMovieNodeGeometry * it_geometry_end = _geometries + _count * 2U;
+    for( ; it_geometry != it_geometry_end; ++it_geometry )
+    {
+        aeMovieNodeGeometry * node_geometry = it_geometry;
+
+        node_geometry->revision = 0U;
+        node_geometry->type = AE_MOVIE_RENDER_GEOMETRY_REVISION_NONE;
+        node_geometry->source = AE_NULLPTR;
+        node_geometry->uvs = AE_NULLPTR;
+        node_geometry->resource = AE_NULLPTR;
+        node_geometry->frame = 0U;
+        node_geometry->t = 0.f;
+        node_geometry->matrix_revision = 0U;
+    }
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __setup_movie_update_nodes( aeMovieNode ** _update_nodes, aeMovieNode * _nodes, ae_uint32_t _count )
+AE_INTERNAL ae_uint32_t __calc_node_relative_deep( aeMovieNode * _nodes, aeMovieNode * _node, ae_uint32_t * _deeps )
 {
-    ae_uint32_t relative_deep = 0;
+    //walk up to the first ancestor with known deep, every node is walked once
+    ae_uint32_t chain = 0U;
+    ae_uint32_t base = 0U;
 
-    for( ;; )
+    aeMovieNode * it_relative = _node;
+    while( it_relative->relative_node != AE_NULLPTR )
     {
-        ae_bool_t exist_relative = AE_FALSE;
+        aeMovieNode * relative_node = it_relative->relative_node;
+
+        ae_uint32_t relative_deep = _deeps[relative_node - _nodes];
 
-        aeMovieNode * it_node = _nodes;
-        aeMovieNode * it_node_end = _nodes + _count;
-        for( ; it_node != it_node_end; ++it_node )
+        ++chain;
+
+        if( relative_deep != AE_MOVIE_NODE_DEEP_NONE )
         {
-            aeMovieNode * node = it_node;
+            base = relative_deep;
 
-            ae_uint32_t deep = _calc_node_relative_deep( node );
+            break;
+        }
 
-            if( relative_deep != deep )
-            {
-                continue;
-            }
+        it_relative = relative_node;
+    }
 
-            *(_update_nodes++) = node;
+    ae_uint32_t deep = base + chain;
 
-            exist_relative = AE_TRUE;
-        }
+    ae_uint32_t relative_deep = deep;
 
-        if( exist_relative == AE_FALSE )
+    for( it_relative = _node; _deeps[it_relative - _nodes] == AE_MOVIE_NODE_DEEP_NONE; it_relative = it_relative->relative_node )
+    {
+        _deeps[it_relative - _nodes] = relative_deep;
+
+        if( relative_deep == 0U )
         {
             break;
         }
 
-        ++relative_deep;
-    };
+        --relative_deep;
+    }
+
+    return deep;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __setup_movie_node_relative( aeMovieNode * _nodes, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, aeMovieNode * _parent )
+AE_INTERNAL ae_void_t __setup_movie_update_nodes( aeMovieNode ** _update_nodes, aeMovieNode * _nodes, ae_uint32_t _count, ae_uint32_t * _scratch )
 {
-    ae_uint32_t begin_index = *_iterator;
+    if( _count == 0U )
+    {
+        return;
+    }
 
-    const aeMovieLayerData * it_layer = _compositionData->layers;
-    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
-    for( ; it_layer != it_layer_end; ++it_layer )
+    //deeps for every node and a counter for every deep level
+    ae_uint32_t * deeps = _scratch;
+    ae_uint32_t * offsets = deeps + _count;
+
+    for( ae_uint32_t index = 0U; index != _count; ++index )
     {
-        const aeMovieLayerData * layer = it_layer;
+        deeps[index] = AE_MOVIE_NODE_DEEP_NONE;
+    }
 
-        aeMovieNode * node = _nodes + ((*_iterator)++);
+    ae_uint32_t max_deep = 0U;
 
-        node->layer_data = layer;
+    for( ae_uint32_t index = 0U; index != _count; ++index )
+    {
+        aeMovieNode * node = _nodes + index;
 
-        node->active = AE_FALSE;
-        node->ignore = AE_FALSE;
-        node->enable = AE_TRUE;
-        node->animate = AE_MOVIE_NODE_ANIMATE_STATIC;
+        ae_uint32_t deep = deeps[index];
 
-        if( layer->parent_index == 0 )
+        if( deep == AE_MOVIE_NODE_DEEP_NONE )
         {
-            node->relative_node = _parent;
+            deep = __calc_node_relative_deep( _nodes, node, deeps );
         }
 
-        node->current_time = 0.f;
-        node->current_frame = 0;
-        node->current_frame_t = 0.f;
-
-        switch( layer->type )
+        if( max_deep < deep )
         {
-        case AE_MOVIE_LAYER_TYPE_MOVIE:
-        case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
-            {
-                __setup_movie_node_relative( _nodes, _iterator, layer->subcomposition_data, node );
-            }break;
-        default:
-            {
-            }break;
+            max_deep = deep;
         }
     }
 
-    ae_uint32_t end_index = *_iterator;
-
-    const aeMovieLayerData * it_layer2 = _compositionData->layers;
-    const aeMovieLayerData * it_layer2_end = _compositionData->layers + _compositionData->layer_count;
-    for( ; it_layer2 != it_layer2_end; ++it_layer2 )
+    for( ae_uint32_t deep = 0U; deep != max_deep + 2U; ++deep )
     {
-        const aeMovieLayerData * layer = it_layer2;
-
-        ae_uint32_t parent_index = layer->parent_index;
-
-        if( parent_index == 0 )
-        {
-            continue;
-        }
+        offsets[deep] = 0U;
+    }
 
-        aeMovieNode * node = __find_node_by_layer( _nodes, begin_index, end_index, layer );
+    for( ae_uint32_t index = 0U; index != _count; ++index )
+    {
+        ++offsets[deeps[index] + 1U];
+    }
 
-        const aeMovieLayerData * parent_layer = __find_layer_by_index( _compositionData, parent_index );
+    for( ae_uint32_t deep = 1U; deep != max_deep + 2U; ++deep )
+    {
+        offsets[deep] += offsets[deep - 1U];
+    }
 
-        aeMovieNode * parent_node = __find_node_by_layer( _nodes, begin_index, end_index, parent_layer );
+    //stable, nodes of one deep keep composition order
+    for( ae_uint32_t index = 0U; index != _count; ++index )
+    {
+        ae_uint32_t deep = deeps[index];
 
-        node->relative_node = parent_node;
+        _update_nodes[offsets[deep]++] = _nodes + index;
     }
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_bool_t __is_layer_super_immutable_transform( const aeMovieLayerData * _layer )
-{
-    const struct aeMovieLayerTransformation * layer_transformation = _layer->transformation;
-
-    return (layer_transformation->immutable_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL;
-}
-//////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_bool_t __is_node_super_immutable_transform( const aeMovieNode * _node )
+AE_INTERNAL ae_void_t __setup_movie_update_nodes_partition( aeMovieComposition * _composition, ae_uint32_t * _scratch )
 {
-    const aeMovieLayerData * node_layer = _node->layer_data;
+    ae_uint32_t node_count = _composition->node_count;
 
-    ae_bool_t super_immutable = __is_layer_super_immutable_transform( node_layer );
+    //deeps are left at the front by the deep sort, depth order is read from a copy behind them
+    const ae_uint32_t * deeps = _scratch;
+    ae_uint32_t * depth_nodes = _scratch + node_count;
 
-    if( super_immutable == AE_FALSE )
+    for( ae_uint32_t index = 0U; index != node_count; ++index )
     {
-        return AE_FALSE;
+        depth_nodes[index] = (ae_uint32_t)(_composition->update_nodes[index] - _composition->nodes);
     }
 
-    struct aeMovieNode * relative_node = _node->relative_node;
+    aeMovieNode ** partition_nodes = _composition->update_nodes;
+    ae_uint32_t * partition_enumerators = _composition->update_node_enumerators;
+    ae_uint32_t * partition_deeps = _composition->update_node_deeps;
 
-    if( relative_node == AE_NULLPTR )
+    ae_uint32_t main_count = 0U;
+
+    aeMovieSubComposition * it_subcomposition = _composition->subcompositions;
+    aeMovieSubComposition * it_subcomposition_end = _composition->subcompositions + _composition->subcomposition_count;
+    for( ; it_subcomposition != it_subcomposition_end; ++it_subcomposition )
     {
-        return AE_TRUE;
+        it_subcomposition->update_node_count = 0U;
     }
 
-    ae_bool_t parent_super_immutable = __is_node_super_immutable_transform( relative_node );
-
-    return parent_super_immutable;
-}
-//////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __setup_movie_node_transform_immutable( aeMovieComposition * _composition )
-{
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
+    const ae_uint32_t * it_node = depth_nodes;
+    const ae_uint32_t * it_node_end = depth_nodes + node_count;
     for( ; it_node != it_node_end; ++it_node )
     {
-        aeMovieNode * node = it_node;
+        const aeMovieNode * node = _composition->nodes + *it_node;
 
-        ae_bool_t immutable_transform = __is_node_super_immutable_transform( node );
+        if( node->subcomposition == AE_NULLPTR )
+        {
+            ++main_count;
+        }
+        else
+        {
+            aeMovieSubComposition * subcomposition = _composition->subcompositions + (node->subcomposition - _composition->subcompositions);
 
-        node->immutable_matrix = immutable_transform;
+            ++subcomposition->update_node_count;
+        }
     }
-}
-//////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_bool_t __is_layer_super_immutable_color( const aeMovieLayerData * _layer )
-{
-    const struct aeMovieLayerTransformation * layer_transformation = _layer->transformation;
 
-    return (layer_transformation->immutable_property_mask & AE_MOVIE_PROPERTY_COLOR_SUPER_ALL) == AE_MOVIE_PROPERTY_COLOR_SUPER_ALL;
-}
-//////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_bool_t __is_node_super_immutable_color( const aeMovieNode * _node )
-{
-    const aeMovieLayerData * node_layer = _node->layer_data;
+    ae_uint32_t partition_offset = main_count;
 
-    ae_bool_t super_immutable = __is_layer_super_immutable_color( node_layer );
+    for( it_subcomposition = _composition->subcompositions; it_subcomposition != it_subcomposition_end; ++it_subcomposition )
+    {
+        it_subcomposition->update_node_offset = partition_offset;
+
+        partition_offset += it_subcomposition->update_node_count;
+
+        it_subcomposition->update_node_count = 0U;
+    }
+
+    //stable, depth order is kept inside every partition
+    ae_uint32_t main_fill = 0U;
+
+    ae_uint32_t enumerator = 0U;
+    for( it_node = depth_nodes; it_node != it_node_end; ++it_node, ++enumerator )
+    {
+        aeMovieNode * node = _composition->nodes + *it_node;
+
+        ae_uint32_t partition_index;
+
+        if( node->subcomposition == AE_NULLPTR )
+        {
+            partition_index = main_fill++;
+        }
+        else
+        {
+            aeMovieSubComposition * subcomposition = _composition->subcompositions + (node->subcomposition - _composition->subcompositions);
+
+            partition_index = subcomposition->update_node_offset + subcomposition->update_node_count++;
+        }
+
+        partition_nodes[partition_index] = node;
+        partition_enumerators[partition_index] = enumerator;
+        partition_deeps[partition_index] = deeps[*it_node];
+    }
+
+    _composition->update_node_count = main_count;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieNode ** __get_movie_composition_update_nodes( const aeMovieComposition * _composition, const aeMovieSubComposition * _subcomposition, ae_uint32_t * _count )
+{
+    if( _subcomposition == AE_NULLPTR )
+    {
+        *_count = _composition->update_node_count;
+
+        return _composition->update_nodes;
+    }
+
+    *_count = _subcomposition->update_node_count;
+
+    return _composition->update_nodes + _subcomposition->update_node_offset;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_float_t __get_movie_node_interval_key( const aeMovieNodeInterval * _interval, ae_bool_t _out )
+{
+    ae_float_t key = (_out == AE_TRUE) ? _interval->out_time : _interval->in_time;
+
+    return key;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __sort_movie_node_interval_order( ae_uint32_t * _order, ae_uint32_t _count, const aeMovieNodeInterval * _intervals, ae_bool_t _out )
+{
+    ae_uint32_t gap = 1U;
+    while( gap < _count / 3U )
+    {
+        gap = gap * 3U + 1U;
+    }
+
+    for( ; gap != 0U; gap /= 3U )
+    {
+        for( ae_uint32_t index = gap; index < _count; ++index )
+        {
+            ae_uint32_t position = _order[index];
+            ae_float_t key = __get_movie_node_interval_key( _intervals + position, _out );
+
+            ae_uint32_t hole = index;
+            for( ; hole >= gap && __get_movie_node_interval_key( _intervals + _order[hole - gap], _out ) > key; hole -= gap )
+            {
+                _order[hole] = _order[hole - gap];
+            }
+
+            _order[hole] = position;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __sort_movie_node_interval_visit( ae_uint32_t * _visit, ae_uint32_t _count )
+{
+    ae_uint32_t gap = 1U;
+    while( gap < _count / 3U )
+    {
+        gap = gap * 3U + 1U;
+    }
+
+    for( ; gap != 0U; gap /= 3U )
+    {
+        for( ae_uint32_t index = gap; index < _count; ++index )
+        {
+            ae_uint32_t position = _visit[index];
+
+            ae_uint32_t hole = index;
+            for( ; hole >= gap && _visit[hole - gap] > position; hole -= gap )
+            {
+                _visit[hole] = _visit[hole - gap];
+            }
+
+            _visit[hole] = position;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __setup_movie_node_interval_index( aeMovieComposition * _composition, aeMovieNodeIntervalIndex * _index, ae_uint32_t _offset, ae_uint32_t _count )
+{
+    ae_uint32_t node_count = _composition->node_count;
+    ae_uint32_t * orders = _composition->update_node_interval_orders;
+
+    _index->offset = _offset;
+    _index->count = _count;
+
+    _index->in_order = orders + node_count * 0U + _offset;
+    _index->out_order = orders + node_count * 1U + _offset;
+    _index->alive = orders + node_count * 2U + _offset;
+    _index->active = orders + node_count * 3U + _offset;
+    _index->visit = orders + node_count * 4U + _offset;
+
+    for( ae_uint32_t index = 0U; index != _count; ++index )
+    {
+        ae_uint32_t position = _offset + index;
+
+        _index->in_order[index] = position;
+        _index->out_order[index] = position;
+        _index->active[index] = position;
+    }
+
+    __sort_movie_node_interval_order( _index->in_order, _count, _composition->update_node_intervals, AE_FALSE );
+    __sort_movie_node_interval_order( _index->out_order, _count, _composition->update_node_intervals, AE_TRUE );
+
+    _index->in_cursor = 0U;
+    _index->out_cursor = 0U;
+    _index->alive_count = 0U;
+
+    //first update visit every node
+    _index->active_count = _count;
+    _index->visit_stamp = 0U;
+
+    _index->sweep_time = 0.f;
+    _index->sweep_valid = AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __setup_movie_node_interval_time( aeMovieNodeInterval * _interval, const aeMovieNode * _node )
+{
+    const aeMovieLayerData * layer = _node->layer_data;
+
+    ae_float_t frameDuration = layer->composition_data->frameDuration;
+
+    //widened by a few frames, the update compare frames and loop work area only shrink [in, out]
+    ae_float_t in_time = ((ae_float_t)_node->in_frame - AE_MOVIE_NODE_INTERVAL_MARGIN) * frameDuration;
+    ae_float_t out_time = ((ae_float_t)_node->out_frame + AE_MOVIE_NODE_INTERVAL_MARGIN) * frameDuration;
+
+    _interval->in_time = in_time;
+    _interval->out_time = (out_time < in_time) ? in_time : out_time;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_movie_node_interval_always( const aeMovieNode * _node )
+{
+    const aeMovieLayerData * layer = _node->layer_data;
+
+    if( _node->incessantly == AE_TRUE
+        || layer->type == AE_MOVIE_LAYER_TYPE_EVENT
+        || layer->type == AE_MOVIE_LAYER_TYPE_SUB_MOVIE )
+    {
+        return AE_TRUE;
+    }
+
+    return AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __setup_movie_update_nodes_interval( aeMovieComposition * _composition )
+{
+    ae_uint32_t node_count = _composition->node_count;
+
+    aeMovieNodeInterval * intervals = _composition->update_node_intervals;
+    aeMovieNodeIntervalIndex * indices = _composition->update_node_interval_indices;
+
+    for( ae_uint32_t position = 0U; position != node_count; ++position )
+    {
+        const aeMovieNode * node = _composition->update_nodes[position];
+
+        aeMovieNodeInterval * interval = intervals + position;
+
+        __setup_movie_node_interval_time( interval, node );
+
+        interval->alive_slot = AE_MOVIE_NODE_INTERVAL_NONE;
+        interval->visit_stamp = 0U;
+        interval->always = __is_movie_node_interval_always( node );
+    }
+
+    __setup_movie_node_interval_index( _composition, indices + 0U, 0U, _composition->update_node_count );
+
+    for( ae_uint32_t index = 0U; index != _composition->subcomposition_count; ++index )
+    {
+        const aeMovieSubComposition * subcomposition = _composition->subcompositions + index;
+
+        __setup_movie_node_interval_index( _composition, indices + index + 1U, subcomposition->update_node_offset, subcomposition->update_node_count );
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieNodeIntervalIndex * __get_movie_composition_interval_index( const aeMovieComposition * _composition, const aeMovieSubComposition * _subcomposition )
+{
+    if( _subcomposition == AE_NULLPTR )
+    {
+        return _composition->update_node_interval_indices + 0U;
+    }
+
+    ae_uint32_t index = (ae_uint32_t)(_subcomposition - _composition->subcompositions);
+
+    return _composition->update_node_interval_indices + index + 1U;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieNodeIntervalIndex * __find_movie_composition_interval_index( const aeMovieComposition * _composition, ae_uint32_t _position )
+{
+    if( _position < _composition->update_node_count )
+    {
+        return _composition->update_node_interval_indices + 0U;
+    }
+
+    for( ae_uint32_t index = 0U; index != _composition->subcomposition_count; ++index )
+    {
+        const aeMovieSubComposition * subcomposition = _composition->subcompositions + index;
+
+        if( _position >= subcomposition->update_node_offset && _position < subcomposition->update_node_offset + subcomposition->update_node_count )
+        {
+            return _composition->update_node_interval_indices + index + 1U;
+        }
+    }
+
+    return AE_NULLPTR;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __sweep_movie_node_interval_index( aeMovieNodeIntervalIndex * _index, aeMovieNodeInterval * _intervals, ae_float_t _time )
+{
+    if( _index->sweep_valid == AE_FALSE || _time < _index->sweep_time )
+    {
+        for( ae_uint32_t index = 0U; index != _index->alive_count; ++index )
+        {
+            _intervals[_index->alive[index]].alive_slot = AE_MOVIE_NODE_INTERVAL_NONE;
+        }
+
+        _index->in_cursor = 0U;
+        _index->out_cursor = 0U;
+        _index->alive_count = 0U;
+    }
+
+    while( _index->in_cursor != _index->count )
+    {
+        ae_uint32_t position = _index->in_order[_index->in_cursor];
+
+        aeMovieNodeInterval * interval = _intervals + position;
+
+        if( interval->in_time > _time )
+        {
+            break;
+        }
+
+        interval->alive_slot = _index->alive_count;
+        _index->alive[_index->alive_count++] = position;
+
+        ++_index->in_cursor;
+    }
+
+    while( _index->out_cursor != _index->count )
+    {
+        ae_uint32_t position = _index->out_order[_index->out_cursor];
+
+        aeMovieNodeInterval * interval = _intervals + position;
+
+        if( interval->out_time >= _time )
+        {
+            break;
+        }
+
+        ae_uint32_t slot = interval->alive_slot;
+
+        if( slot != AE_MOVIE_NODE_INTERVAL_NONE )
+        {
+            ae_uint32_t last = _index->alive[--_index->alive_count];
+
+            _index->alive[slot] = last;
+            _intervals[last].alive_slot = slot;
+
+            interval->alive_slot = AE_MOVIE_NODE_INTERVAL_NONE;
+        }
+
+        ++_index->out_cursor;
+    }
+
+    _index->sweep_time = _time;
+    _index->sweep_valid = AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __visit_movie_node_interval( aeMovieNodeIntervalIndex * _index, aeMovieNodeInterval * _intervals, ae_uint32_t _position, ae_uint32_t * _count )
+{
+    aeMovieNodeInterval * interval = _intervals + _position;
+
+    if( interval->visit_stamp == _index->visit_stamp )
+    {
+        return;
+    }
+
+    interval->visit_stamp = _index->visit_stamp;
+
+    _index->visit[(*_count)++] = _position;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __gather_movie_composition_interval_nodes( const aeMovieComposition * _composition, const aeMovieSubComposition * _subcomposition, ae_float_t _beginTime, ae_float_t _endTime, const ae_uint32_t ** _visit )
+{
+    aeMovieNodeIntervalIndex * index = __get_movie_composition_interval_index( _composition, _subcomposition );
+    aeMovieNodeInterval * intervals = _composition->update_node_intervals;
+
+#ifndef AE_MOVIE_NODE_INTERVAL_INDEX
+    AE_UNUSED( intervals );
+    AE_UNUSED( _beginTime );
+    AE_UNUSED( _endTime );
+
+    //full visit, the reference the interval index is tested against
+    for( ae_uint32_t iterator = 0U; iterator != index->count; ++iterator )
+    {
+        index->visit[iterator] = index->offset + iterator;
+    }
+
+    *_visit = index->visit;
+
+    return index->count;
+#else
+    __sweep_movie_node_interval_index( index, intervals, _beginTime );
+
+    if( ++index->visit_stamp == 0U )
+    {
+        for( ae_uint32_t position = index->offset; position != index->offset + index->count; ++position )
+        {
+            intervals[position].visit_stamp = 0U;
+        }
+
+        index->visit_stamp = 1U;
+    }
+
+    ae_uint32_t visit_count = 0U;
+
+    //alive at begin time
+    for( ae_uint32_t iterator = 0U; iterator != index->alive_count; ++iterator )
+    {
+        __visit_movie_node_interval( index, intervals, index->alive[iterator], &visit_count );
+    }
+
+    //entering inside (begin time, end time]
+    for( ae_uint32_t iterator = index->in_cursor; iterator != index->count; ++iterator )
+    {
+        ae_uint32_t position = index->in_order[iterator];
+
+        if( intervals[position].in_time > _endTime )
+        {
+            break;
+        }
+
+        __visit_movie_node_interval( index, intervals, position, &visit_count );
+    }
+
+    //still active after previous update, incessantly, sub movies and events
+    for( ae_uint32_t iterator = 0U; iterator != index->active_count; ++iterator )
+    {
+        __visit_movie_node_interval( index, intervals, index->active[iterator], &visit_count );
+    }
+
+    __sort_movie_node_interval_visit( index->visit, visit_count );
+
+    *_visit = index->visit;
+
+    return visit_count;
+#endif
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __update_movie_composition_interval_active( const aeMovieComposition * _composition, const aeMovieSubComposition * _subcomposition, const ae_uint32_t * _visit, ae_uint32_t _count )
+{
+    aeMovieNodeIntervalIndex * index = __get_movie_composition_interval_index( _composition, _subcomposition );
+    const aeMovieNodeInterval * intervals = _composition->update_node_intervals;
+
+    ae_uint32_t active_count = 0U;
+
+    for( ae_uint32_t iterator = 0U; iterator != _count; ++iterator )
+    {
+        ae_uint32_t position = _visit[iterator];
+
+        const aeMovieNode * node = _composition->update_nodes[position];
+
+        if( node->active == AE_TRUE || intervals[position].always == AE_TRUE )
+        {
+            index->active[active_count++] = position;
+        }
+    }
+
+    index->active_count = active_count;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __get_movie_composition_data_max_layer_index( const aeMovieCompositionData * _compositionData )
+{
+    ae_uint32_t max_layer_index = 0U;
+
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        if( max_layer_index < layer->index )
+        {
+            max_layer_index = layer->index;
+        }
+    }
+
+    return max_layer_index;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __get_movie_node_relative_scratch_count( const aeMovieCompositionData * _compositionData )
+{
+    ae_uint32_t max_layer_index = __get_movie_composition_data_max_layer_index( _compositionData );
+
+    ae_uint32_t max_subcomposition_count = 0U;
+
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        switch( layer->type )
+        {
+        case AE_MOVIE_LAYER_TYPE_MOVIE:
+        case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
+            {
+                ae_uint32_t subcomposition_count = __get_movie_node_relative_scratch_count( layer->subcomposition_data );
+
+                if( max_subcomposition_count < subcomposition_count )
+                {
+                    max_subcomposition_count = subcomposition_count;
+                }
+            }break;
+        default:
+            {
+            }break;
+        }
+    }
+
+    //every nested level stacks its tables after the parent ones
+    ae_uint32_t count = _compositionData->layer_count + max_layer_index + 1U + max_subcomposition_count;
+
+    return count;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __setup_movie_node_relative( aeMovieNode * _nodes, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, aeMovieNode * _parent, ae_uint32_t * _scratch )
+{
+    ae_uint32_t layer_count = _compositionData->layer_count;
+
+    ae_uint32_t max_layer_index = __get_movie_composition_data_max_layer_index( _compositionData );
+
+    //node index per layer position, followed by node index per layer index
+    ae_uint32_t * layer_nodes = _scratch;
+    ae_uint32_t * index_nodes = layer_nodes + layer_count;
+
+    ae_uint32_t * subcomposition_scratch = index_nodes + max_layer_index + 1U;
+
+    for( ae_uint32_t index = 0U; index != max_layer_index + 1U; ++index )
+    {
+        index_nodes[index] = AE_MOVIE_NODE_INDEX_NONE;
+    }
+
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        ae_uint32_t node_index = (*_iterator)++;
+
+        aeMovieNode * node = _nodes + node_index;
+
+        node->layer_data = layer;
+
+        layer_nodes[it_layer - _compositionData->layers] = node_index;
+
+        if( index_nodes[layer->index] == AE_MOVIE_NODE_INDEX_NONE )
+        {
+            index_nodes[layer->index] = node_index;
+        }
+
+        node->active = AE_FALSE;
+        node->ignore = AE_FALSE;
+        node->enable = AE_TRUE;
+        node->animate = AE_MOVIE_NODE_ANIMATE_STATIC;
+
+        if( layer->parent_index == 0 )
+        {
+            node->relative_node = _parent;
+        }
+
+        node->current_time = 0.f;
+        node->current_frame = 0;
+        node->current_frame_t = 0.f;
+
+        switch( layer->type )
+        {
+        case AE_MOVIE_LAYER_TYPE_MOVIE:
+        case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
+            {
+                __setup_movie_node_relative( _nodes, _iterator, layer->subcomposition_data, node, subcomposition_scratch );
+            }break;
+        default:
+            {
+            }break;
+        }
+    }
+
+    const aeMovieLayerData * it_layer2 = _compositionData->layers;
+    const aeMovieLayerData * it_layer2_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer2 != it_layer2_end; ++it_layer2 )
+    {
+        const aeMovieLayerData * layer = it_layer2;
+
+        ae_uint32_t parent_index = layer->parent_index;
+
+        if( parent_index == 0 )
+        {
+            continue;
+        }
+
+        aeMovieNode * node = _nodes + layer_nodes[it_layer2 - _compositionData->layers];
+
+        ae_uint32_t parent_node_index = parent_index > max_layer_index ? AE_MOVIE_NODE_INDEX_NONE : index_nodes[parent_index];
+
+        node->relative_node = parent_node_index == AE_MOVIE_NODE_INDEX_NONE ? AE_NULLPTR : _nodes + parent_node_index;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_layer_super_immutable_transform( const aeMovieLayerData * _layer )
+{
+    const struct aeMovieLayerTransformation * layer_transformation = _layer->transformation;
+
+    return (layer_transformation->immutable_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_node_super_immutable_transform( const aeMovieNode * _node )
+{
+    const aeMovieLayerData * node_layer = _node->layer_data;
+
+    ae_bool_t super_immutable = __is_layer_super_immutable_transform( node_layer );
+
+    if( super_immutable == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    struct aeMovieNode * relative_node = _node->relative_node;
+
+    if( relative_node == AE_NULLPTR )
+    {
+        return AE_TRUE;
+    }
+
+    //parents are set up first, see update nodes order
+    ae_bool_t parent_super_immutable = relative_node->immutable_matrix;
+
+    return parent_super_immutable;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __setup_movie_node_transform_immutable( aeMovieComposition * _composition )
+{
+    aeMovieNode ** it_node = _composition->update_nodes;
+    aeMovieNode ** it_node_end = _composition->update_nodes + _composition->node_count;
+    for( ; it_node != it_node_end; ++it_node )
+    {
+        aeMovieNode * node = *it_node;
+
+        ae_bool_t immutable_transform = __is_node_super_immutable_transform( node );
+
+        node->immutable_matrix = immutable_transform;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_layer_super_immutable_color( const aeMovieLayerData * _layer )
+{
+    const struct aeMovieLayerTransformation * layer_transformation = _layer->transformation;
+
+    return (layer_transformation->immutable_property_mask & AE_MOVIE_PROPERTY_COLOR_SUPER_ALL) == AE_MOVIE_PROPERTY_COLOR_SUPER_ALL;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_node_super_immutable_color( const aeMovieNode * _node )
+{
+    const aeMovieLayerData * node_layer = _node->layer_data;
+
+    ae_bool_t super_immutable = __is_layer_super_immutable_color( node_layer );
 
     if( super_immutable == AE_FALSE )
     {
@@ -1335,18 +2713,18 @@ AE_INTERNAL ae_bool_t __is_node_super_immutable_color( const aeMovieNode * _node
         return AE_TRUE;
     }
 
-    ae_bool_t parent_super_immutable = __is_node_super_immutable_color( relative_node );
+    ae_bool_t parent_super_immutable = relative_node->immutable_color;
 
     return parent_super_immutable;
 }
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __setup_movie_node_color_immutable( aeMovieComposition * _composition )
 {
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
+    aeMovieNode ** it_node = _composition->update_nodes;
+    aeMovieNode ** it_node_end = _composition->update_nodes + _composition->node_count;
     for( ; it_node != it_node_end; ++it_node )
     {
-        aeMovieNode * node = it_node;
+        aeMovieNode * node = *it_node;
 
         ae_bool_t immutable_color = __is_node_super_immutable_color( node );
 
@@ -1354,7 +2732,7 @@ AE_INTERNAL ae_void_t __setup_movie_node_color_immutable( aeMovieComposition * _
     }
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __setup_movie_node_time( aeMovieNode * _nodes, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, const aeMovieNode * _parent, ae_float_t _stretch, ae_float_t _startTime )
+AE_INTERNAL ae_void_t __setup_movie_node_time( aeMovieNode * _nodes, aeMovieNodeCold * _colds, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, const aeMovieNode * _parent, ae_float_t _stretch, ae_float_t _startTime )
 {
     const aeMovieLayerData * it_layer = _compositionData->layers;
     const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
@@ -1362,11 +2740,14 @@ AE_INTERNAL ae_void_t __setup_movie_node_time( aeMovieNode * _nodes, ae_uint32_t
     {
         const aeMovieLayerData * layer = it_layer;
 
-        aeMovieNode * node = _nodes + ((*_iterator)++);
+        ae_uint32_t node_index = (*_iterator)++;
+
+        aeMovieNode * node = _nodes + node_index;
+        aeMovieNodeCold * node_cold = _colds + node_index;
 
         if( _parent == AE_NULLPTR )
         {
-            node->start_time = __correct_timeline_frame_time( 0.f, _compositionData, &node->start_frame );
+            node->start_time = __correct_timeline_frame_time( 0.f, _compositionData, &node_cold->start_frame );
             node->in_time = __correct_timeline_frame_time( layer->in_time, _compositionData, &node->in_frame );
             node->out_time = __correct_timeline_frame_time( layer->out_time, _compositionData, &node->out_frame );
         }
@@ -1377,12 +2758,12 @@ AE_INTERNAL ae_void_t __setup_movie_node_time( aeMovieNode * _nodes, ae_uint32_t
 
             if( parent_in > layer_in )
             {
-                node->start_time = __correct_timeline_frame_time( parent_in - layer_in, _compositionData, &node->start_frame );
+                node->start_time = __correct_timeline_frame_time( parent_in - layer_in, _compositionData, &node_cold->start_frame );
                 node->in_time = __correct_timeline_frame_time( parent_in, _compositionData, &node->in_frame );
             }
             else
             {
-                node->start_time = __correct_timeline_frame_time( 0.f, _compositionData, &node->start_frame );
+                node->start_time = __correct_timeline_frame_time( 0.f, _compositionData, &node_cold->start_frame );
                 node->in_time = __correct_timeline_frame_time( layer_in, _compositionData, &node->in_frame );
             }
 
@@ -1419,7 +2800,7 @@ AE_INTERNAL ae_void_t __setup_movie_node_time( aeMovieNode * _nodes, ae_uint32_t
 
                 ae_float_t to_startTime = _startTime + layer->start_time - layer->in_time;
 
-                __setup_movie_node_time( _nodes, _iterator, layer->subcomposition_data, node, to_stretch, to_startTime );
+                __setup_movie_node_time( _nodes, _colds, _iterator, layer->subcomposition_data, node, to_stretch, to_startTime );
             }break;
         default:
             {
@@ -1429,7 +2810,29 @@ AE_INTERNAL ae_void_t __setup_movie_node_time( aeMovieNode * _nodes, ae_uint32_t
     }
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __setup_movie_node_incessantly( aeMovieNode * _nodes, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, ae_frame_t _in, ae_frame_t _out, ae_frame_t _duration, ae_bool_t _incessantly )
+AE_INTERNAL ae_bool_t __is_movie_node_incessantly( const aeMovieNode * _node, const aeMovieNodeCold * _cold, ae_frame_t _in, ae_frame_t _out, ae_frame_t _duration, ae_bool_t _incessantly )
+{
+    const aeMovieLayerData * layer = _node->layer_data;
+
+    if( layer->incessantly == AE_TRUE )
+    {
+        return AE_TRUE;
+    }
+
+    if( layer->trimmed_time == AE_TRUE || _cold->start_frame != 0 )
+    {
+        return AE_FALSE;
+    }
+
+    if( _incessantly == AE_FALSE )
+    {
+        return (_node->in_frame == 0 && _node->out_frame == _duration) ? AE_TRUE : AE_FALSE;
+    }
+
+    return (_node->in_frame == _in && _node->out_frame == _out) ? AE_TRUE : AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __setup_movie_node_incessantly( aeMovieNode * _nodes, aeMovieNodeCold * _colds, ae_uint32_t * _iterator, const aeMovieCompositionData * _compositionData, ae_frame_t _in, ae_frame_t _out, ae_frame_t _duration, ae_bool_t _incessantly )
 {
     const aeMovieLayerData * it_layer = _compositionData->layers;
     const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
@@ -1437,47 +2840,19 @@ AE_INTERNAL ae_void_t __setup_movie_node_incessantly( aeMovieNode * _nodes, ae_u
     {
         const aeMovieLayerData * layer = it_layer;
 
-        aeMovieNode * node = _nodes + ((*_iterator)++);
+        ae_uint32_t node_index = (*_iterator)++;
 
-        if( layer->incessantly == AE_TRUE )
-        {
-            node->incessantly = AE_TRUE;
-        }
-        else if( _incessantly == AE_FALSE )
-        {
-            if( layer->trimmed_time == AE_FALSE &&
-                node->start_frame == 0 &&
-                node->in_frame == 0 &&
-                node->out_frame == _duration )
-            {
-                node->incessantly = AE_TRUE;
-            }
-            else
-            {
-                node->incessantly = AE_FALSE;
-            }
-        }
-        else
-        {
-            if( layer->trimmed_time == AE_FALSE &&
-                node->start_frame == 0 &&
-                node->in_frame == _in &&
-                node->out_frame == _out )
-            {
-                node->incessantly = AE_TRUE;
-            }
-            else
-            {
-                node->incessantly = AE_FALSE;
-            }
-        }
+        aeMovieNode * node = _nodes + node_index;
+        aeMovieNodeCold * node_cold = _colds + node_index;
+
+        node->incessantly = __is_movie_node_incessantly( node, node_cold, _in, _out, _duration, _incessantly );
 
         switch( layer->type )
         {
         case AE_MOVIE_LAYER_TYPE_MOVIE:
         case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
             {
-                __setup_movie_node_incessantly( _nodes, _iterator, layer->subcomposition_data, node->in_frame, node->out_frame, _duration, node->incessantly );
+                __setup_movie_node_incessantly( _nodes, _colds, _iterator, layer->subcomposition_data, node->in_frame, node->out_frame, _duration, node->incessantly );
             }break;
         default:
             {
@@ -1536,15 +2911,15 @@ AE_INTERNAL ae_void_t __setup_movie_node_camera2( aeMovieComposition * _composit
     {
         const aeMovieLayerData * layer = it_layer;
 
-        aeMovieNode * node = _composition->nodes + ((*_iterator)++);
+        aeMovieNodeCold * node_cold = _composition->node_colds + ((*_iterator)++);
 
         if( layer->threeD == AE_TRUE )
         {
-            node->camera_userdata = _composition->camera_userdata;
+            node_cold->camera_userdata = _composition->camera_userdata;
         }
         else
         {
-            node->camera_userdata = _userdata;
+            node_cold->camera_userdata = _userdata;
         }
 
         switch( layer->type )
@@ -1552,7 +2927,7 @@ AE_INTERNAL ae_void_t __setup_movie_node_camera2( aeMovieComposition * _composit
         case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
         case AE_MOVIE_LAYER_TYPE_MOVIE:
             {
-                __setup_movie_node_camera2( _composition, _iterator, layer->subcomposition_data, node->camera_userdata );
+                __setup_movie_node_camera2( _composition, _iterator, layer->subcomposition_data, node_cold->camera_userdata );
             }break;
         default:
             {
@@ -1569,13 +2944,13 @@ AE_INTERNAL ae_bool_t __setup_movie_node_camera( aeMovieComposition * _compositi
     {
         _composition->camera_userdata = AE_NULLPTR;
 
-        aeMovieNode * it_node = _composition->nodes;
-        aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-        for( ; it_node != it_node_end; ++it_node )
+        aeMovieNodeCold * it_cold = _composition->node_colds;
+        aeMovieNodeCold * it_cold_end = _composition->node_colds + _composition->node_count;
+        for( ; it_cold != it_cold_end; ++it_cold )
         {
-            aeMovieNode * node = it_node;
+            aeMovieNodeCold * node_cold = it_cold;
 
-            node->camera_userdata = AE_NULLPTR;
+            node_cold->camera_userdata = AE_NULLPTR;
         }
 
         return AE_TRUE;
@@ -1616,15 +2991,15 @@ AE_INTERNAL ae_void_t __setup_movie_node_viewport2( aeMovieComposition * _compos
     {
         const aeMovieLayerData * layer = it_layer;
 
-        aeMovieNode * node = _composition->nodes + ((*_iterator)++);
+        aeMovieNodeCold * node_cold = _composition->node_colds + ((*_iterator)++);
 
         if( layer->extensions->viewport != AE_NULLPTR )
         {
-            node->viewport = &layer->extensions->viewport->viewport;
+            node_cold->viewport = &layer->extensions->viewport->viewport;
         }
         else
         {
-            node->viewport = _viewport;
+            node_cold->viewport = _viewport;
         }
 
         switch( layer->type )
@@ -1632,7 +3007,7 @@ AE_INTERNAL ae_void_t __setup_movie_node_viewport2( aeMovieComposition * _compos
         case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
         case AE_MOVIE_LAYER_TYPE_MOVIE:
             {
-                __setup_movie_node_viewport2( _composition, _iterator, layer->subcomposition_data, node->viewport );
+                __setup_movie_node_viewport2( _composition, _iterator, layer->subcomposition_data, node_cold->viewport );
             }break;
         default:
             {
@@ -1651,17 +3026,20 @@ AE_INTERNAL ae_void_t __setup_movie_node_viewport( aeMovieComposition * _composi
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __setup_movie_node_matrix2( const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, const aeMovieCompositionAnimation * _animation, const aeMovieSubComposition * _subcomposition )
 {
-    aeMovieNode ** it_node = _composition->update_nodes;
-    aeMovieNode ** it_node_end = _composition->update_nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    ae_uint32_t update_node_count;
+    aeMovieNode ** update_nodes = __get_movie_composition_update_nodes( _composition, _subcomposition, &update_node_count );
+
+    aeMovieNodeMatrixBatch batch;
+    __clear_movie_composition_node_matrix_batch( &batch, 0U );
+
+    const ae_uint32_t * it_deep = _composition->update_node_deeps + (update_nodes - _composition->update_nodes);
+
+    aeMovieNode ** it_node = update_nodes;
+    aeMovieNode ** it_node_end = update_nodes + update_node_count;
+    for( ; it_node != it_node_end; ++it_node, ++it_deep )
     {
         aeMovieNode * node = *it_node;
 
-        if( node->subcomposition != _subcomposition )
-        {
-            continue;
-        }
-
         const aeMovieLayerData * node_layer = node->layer_data;
 
         ae_float_t t = 0.f;
@@ -1674,8 +3052,17 @@ AE_INTERNAL ae_void_t __setup_movie_node_matrix2( const aeMovieComposition * _co
             ae_ident_m34( node->matrix );
         }
 
-        __update_movie_composition_node_matrix( node, _composition, _compositionData, frameId, node_interpolate, t );
+        if( __is_movie_composition_node_matrix_batch_full( &batch, *it_deep ) == AE_TRUE )
+        {
+            __flush_movie_composition_node_matrix_batch( &batch, _composition, _compositionData );
+
+            __clear_movie_composition_node_matrix_batch( &batch, *it_deep );
+        }
+
+        __push_movie_composition_node_matrix_batch( &batch, _composition, node, frameId, node_interpolate, t );
     }
+
+    __flush_movie_composition_node_matrix_batch( &batch, _composition, _compositionData );
 }
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __setup_movie_node_matrix( const aeMovieComposition * _composition )
@@ -1709,9 +3096,11 @@ AE_INTERNAL ae_bool_t __setup_movie_node_shader( aeMovieComposition * _compositi
 
         const aeMovieLayerData * layer = node->layer_data;
 
+        aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, node );
+
         if( layer->extensions->shader == AE_NULLPTR )
         {
-            node->shader_userdata = AE_NULLPTR;
+            node_cold->shader_userdata = AE_NULLPTR;
 
             continue;
         }
@@ -1819,7 +3208,7 @@ AE_INTERNAL ae_bool_t __setup_movie_node_shader( aeMovieComposition * _compositi
             return AE_FALSE;
         }
 
-        node->shader_userdata = shader_userdata;
+        node_cold->shader_userdata = shader_userdata;
     }
 
     return AE_TRUE;
@@ -1835,6 +3224,8 @@ AE_INTERNAL ae_bool_t __setup_movie_composition_element( aeMovieComposition * _c
     {
         aeMovieNode * node = it_node;
 
+        aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, node );
+
         const aeMovieLayerData * track_matte_layer = node->track_matte_node == AE_NULLPTR ? AE_NULLPTR : node->track_matte_node->layer_data;
 
         aeMovieNodeProviderCallbackData callbackData;
@@ -1846,7 +3237,7 @@ AE_INTERNAL ae_bool_t __setup_movie_composition_element( aeMovieComposition * _c
         callbackData.matrix = node->matrix;
         callbackData.color = node->color;
         callbackData.opacity = node->opacity * node->extra_opacity;
-        callbackData.volume = node->volume;
+        callbackData.volume = node_cold->volume;
         callbackData.track_matte_layer = track_matte_layer;
 
         ae_userdata_t element_userdata = AE_USERDATA_NULL;
@@ -1855,7 +3246,7 @@ AE_INTERNAL ae_bool_t __setup_movie_composition_element( aeMovieComposition * _c
             return AE_FALSE;
         }
 
-        node->element_userdata = element_userdata;
+        node_cold->element_userdata = element_userdata;
     }
 
     return AE_TRUE;
@@ -1881,18 +3272,34 @@ AE_INTERNAL ae_void_t __setup_movie_composition_active( aeMovieComposition * _co
     }
 }
 //////////////////////////////////////////////////////////////////////////
-const aeMovieComposition * ae_create_movie_composition( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _interpolate, const aeMovieCompositionProviders * _providers, ae_userdata_t _userdata )
+AE_INTERNAL ae_void_t __delete_movie_composition_structure( const aeMovieComposition * _composition )
+{
+    const aeMovieInstance * instance = _composition->movie_data->instance;
+
+    __release_movie_data_composition( _composition->movie_data );
+
+    //nodes, update lists and subcompositions live in the composition block
+    AE_DELETE( instance, _composition );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieComposition * __create_movie_composition_structure( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _interpolate )
 {
-    aeMovieComposition * composition = AE_NEW( _movieData->instance, aeMovieComposition );
+    ae_uint32_t node_count = __get_movie_composition_data_node_count( _compositionData );
+    ae_uint32_t subcomposition_count = __get_movie_composition_data_subcomposition_count( _compositionData );
 
-    AE_MOVIE_PANIC_MEMORY( composition, AE_NULLPTR );
+    aeMovieComposition * composition = __new_movie_composition_arena( _movieData->instance, node_count, subcomposition_count );
+
+    if( composition == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
+    }
 
     composition->movie_data = _movieData;
     composition->composition_data = _compositionData;
 
-    aeMovieCompositionAnimation * animation = AE_NEW( _movieData->instance, aeMovieCompositionAnimation );
+    __acquire_movie_data_composition( _movieData );
 
-    AE_MOVIE_PANIC_MEMORY( animation, AE_NULLPTR );
+    aeMovieCompositionAnimation * animation = composition->animation;
 
     animation->enable = AE_TRUE;
     animation->play = AE_FALSE;
@@ -1906,85 +3313,306 @@ const aeMovieComposition * ae_create_movie_composition( const aeMovieData * _mov
     animation->work_area_time_begin = __correct_timeline_frame_time( 0, _compositionData, &animation->work_area_frame_begin );
     animation->work_area_time_end = __correct_timeline_frame_time( _compositionData->duration_time, _compositionData, &animation->work_area_frame_end );
 
-    composition->animation = animation;
+    animation->camera_sampled = AE_FALSE;
+    animation->camera_frame = 0U;
+    animation->camera_t = 0.f;
 
     composition->interpolate = _interpolate;
 
-    ae_uint32_t node_count = __get_movie_composition_data_node_count( _compositionData );
+    aeMovieNode * nodes = composition->nodes;
 
-    composition->node_count = node_count;
+    __setup_movie_node_initialize( nodes, composition->node_samplings, composition->node_colds, composition->node_geometries, node_count );
 
-    aeMovieNode * nodes = AE_NEWN( _movieData->instance, aeMovieNode, node_count );
-    AE_MOVIE_PANIC_MEMORY( nodes, AE_NULLPTR );
+    composition->camera_userdata = AE_USERDATA_NULL;
 
-    __setup_movie_node_initialize( nodes, node_count );
+    composition->scene_effect_node = AE_NULLPTR;
+    composition->scene_effect_userdata = AE_USERDATA_NULL;
 
-    composition->nodes = nodes;
+    //one scratch block shared by the parent tables, the deep sort and the partition
+    ae_uint32_t scratch_count = __get_movie_node_relative_scratch_count( _compositionData );
 
-    composition->providers = *_providers;
-    composition->provider_userdata = _userdata;
+    if( scratch_count < node_count * 2U + 1U )
+    {
+        scratch_count = node_count * 2U + 1U;
+    }
 
-    ae_uint32_t node_relative_iterator = 0U;
-    __setup_movie_node_relative( composition->nodes, &node_relative_iterator, _compositionData, AE_NULLPTR );
+    ae_uint32_t * scratch = AE_NEWN( _movieData->instance, ae_uint32_t, scratch_count );
 
-    aeMovieNode ** update_nodes = AE_NEWN( _movieData->instance, aeMovieNode *, node_count );
-    AE_MOVIE_PANIC_MEMORY( update_nodes, AE_NULLPTR );
+    if( scratch == AE_NULLPTR )
+    {
+        __delete_movie_composition_structure( composition );
 
-    __setup_movie_update_nodes( update_nodes, nodes, node_count );
+        return AE_NULLPTR;
+    }
 
-    composition->update_nodes = update_nodes;
+    ae_uint32_t node_relative_iterator = 0U;
+    __setup_movie_node_relative( composition->nodes, &node_relative_iterator, _compositionData, AE_NULLPTR, scratch );
+
+    __setup_movie_update_nodes( composition->update_nodes, nodes, node_count, scratch );
 
     __setup_movie_node_transform_immutable( composition );
     __setup_movie_node_color_immutable( composition );
 
     if( __setup_movie_subcomposition( composition ) == AE_FALSE )
     {
+        AE_DELETEN( _movieData->instance, scratch );
+
+        __delete_movie_composition_structure( composition );
+
         return AE_NULLPTR;
     }
 
+    __setup_movie_update_nodes_partition( composition, scratch );
+
+    AE_DELETEN( _movieData->instance, scratch );
+
     ae_uint32_t node_time_iterator = 0U;
-    __setup_movie_node_time( composition->nodes, &node_time_iterator, _compositionData, AE_NULLPTR, 1.f, 0.f );
+    __setup_movie_node_time( composition->nodes, composition->node_colds, &node_time_iterator, _compositionData, AE_NULLPTR, 1.f, 0.f );
 
     ae_uint32_t node_incessantly2_iterator = 0U;
-    __setup_movie_node_incessantly( composition->nodes, &node_incessantly2_iterator, _compositionData, 0, _compositionData->duration_frame, _compositionData->duration_frame, AE_TRUE );
+    __setup_movie_node_incessantly( composition->nodes, composition->node_colds, &node_incessantly2_iterator, _compositionData, 0, _compositionData->duration_frame, _compositionData->duration_frame, AE_TRUE );
 
     ae_uint32_t node_blend_mode_iterator = 0U;
     __setup_movie_node_blend_mode( composition->nodes, &node_blend_mode_iterator, _compositionData, AE_NULLPTR, AE_MOVIE_BLEND_NORMAL );
 
-    if( __setup_movie_node_camera( composition ) == AE_FALSE )
-    {
-        return AE_NULLPTR;
-    }
-
     __setup_movie_node_matrix( composition );
 
     __setup_movie_node_viewport( composition );
 
     __setup_movie_composition_active( composition );
 
+    if( __setup_movie_update_nodes_interval( composition ) == AE_FALSE )
+    {
+        __delete_movie_composition_structure( composition );
+
+        return AE_NULLPTR;
+    }
+
     ae_uint32_t node_track_matte_iterator = 0;
     if( __setup_movie_node_track_matte( composition->nodes, &node_track_matte_iterator, _compositionData, AE_NULLPTR ) == AE_FALSE )
     {
+        __delete_movie_composition_structure( composition );
+
+        return AE_NULLPTR;
+    }
+
+    return composition;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __setup_movie_composition_providers( aeMovieComposition * _composition, const aeMovieCompositionProviders * _providers, ae_userdata_t _userdata )
+{
+    _composition->providers = *_providers;
+    _composition->provider_userdata = _userdata;
+
+    if( __setup_movie_subcomposition_provider( _composition ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __setup_movie_node_camera( _composition ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __setup_movie_node_shader( _composition ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __setup_movie_composition_element( _composition ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __setup_movie_node_track_matte2( _composition ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __setup_movie_composition_scene_effect( _composition ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieNode * __rebase_movie_node( const aeMovieNode * _node, const aeMovieNode * _from, aeMovieNode * _to )
+{
+    if( _node == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieNode * node = _to + (_node - _from);
+
+    return node;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL aeMovieComposition * __clone_movie_composition_structure( const aeMovieComposition * _composition )
+{
+    const aeMovieInstance * instance = _composition->movie_data->instance;
+
+    ae_uint32_t node_count = _composition->node_count;
+    ae_uint32_t subcomposition_count = _composition->subcomposition_count;
+
+    aeMovieComposition * composition = __new_movie_composition_arena( instance, node_count, subcomposition_count );
+
+    if( composition == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieCompositionAnimation * animation = composition->animation;
+    aeMovieNode * nodes = composition->nodes;
+    aeMovieNodeSampling * node_samplings = composition->node_samplings;
+    aeMovieNodeCold * node_colds = composition->node_colds;
+    aeMovieNodeGeometry * node_geometries = composition->node_geometries;
+    aeMovieNode ** update_nodes = composition->update_nodes;
+    ae_uint32_t * update_node_enumerators = composition->update_node_enumerators;
+    ae_uint32_t * update_node_deeps = composition->update_node_deeps;
+    aeMovieNodeInterval * update_node_intervals = composition->update_node_intervals;
+    ae_uint32_t * update_node_interval_orders = composition->update_node_interval_orders;
+    aeMovieNodeIntervalIndex * update_node_interval_indices = composition->update_node_interval_indices;
+    aeMovieSubComposition * subcompositions = composition->subcompositions;
+
+    *composition = *_composition;
+
+    __acquire_movie_data_composition( composition->movie_data );
+
+    *animation = *_composition->animation;
+
+    for( ae_uint32_t index = 0U; index != subcomposition_count; ++index )
+    {
+        const aeMovieSubComposition * subcomposition = _composition->subcompositions + index;
+
+        aeMovieCompositionAnimation * subcomposition_animation = subcompositions[index].animation;
+
+        *subcomposition_animation = *subcomposition->animation;
+
+        subcompositions[index] = *subcomposition;
+        subcompositions[index].animation = subcomposition_animation;
+    }
+
+    for( ae_uint32_t index = 0U; index != node_count; ++index )
+    {
+        const aeMovieNode * template_node = _composition->nodes + index;
+
+        aeMovieNode * node = nodes + index;
+
+        *node = *template_node;
+
+        node->relative_node = __rebase_movie_node( template_node->relative_node, _composition->nodes, nodes );
+        node->track_matte_node = __rebase_movie_node( template_node->track_matte_node, _composition->nodes, nodes );
+
+        if( template_node->subcomposition != AE_NULLPTR )
+        {
+            node->subcomposition = subcompositions + (template_node->subcomposition - _composition->subcompositions);
+        }
+
+        node_samplings[index] = _composition->node_samplings[index];
+        node_colds[index] = _composition->node_colds[index];
+
+        node_geometries[index * 2U + 0U] = _composition->node_geometries[index * 2U + 0U];
+        node_geometries[index * 2U + 1U] = _composition->node_geometries[index * 2U + 1U];
+
+        update_nodes[index] = __rebase_movie_node( _composition->update_nodes[index], _composition->nodes, nodes );
+        update_node_enumerators[index] = _composition->update_node_enumerators[index];
+        update_node_deeps[index] = _composition->update_node_deeps[index];
+        update_node_intervals[index] = _composition->update_node_intervals[index];
+    }
+
+    for( ae_uint32_t index = 0U; index != node_count * 5U; ++index )
+    {
+        update_node_interval_orders[index] = _composition->update_node_interval_orders[index];
+    }
+
+    for( ae_uint32_t index = 0U; index != subcomposition_count + 1U; ++index )
+    {
+        const aeMovieNodeIntervalIndex * template_interval_index = _composition->update_node_interval_indices + index;
+
+        aeMovieNodeIntervalIndex * interval_index = update_node_interval_indices + index;
+
+        *interval_index = *template_interval_index;
+
+        interval_index->in_order = update_node_interval_orders + (template_interval_index->in_order - _composition->update_node_interval_orders);
+        interval_index->out_order = update_node_interval_orders + (template_interval_index->out_order - _composition->update_node_interval_orders);
+        interval_index->alive = update_node_interval_orders + (template_interval_index->alive - _composition->update_node_interval_orders);
+        interval_index->active = update_node_interval_orders + (template_interval_index->active - _composition->update_node_interval_orders);
+        interval_index->visit = update_node_interval_orders + (template_interval_index->visit - _composition->update_node_interval_orders);
+    }
+
+    composition->animation = animation;
+    composition->nodes = nodes;
+    composition->node_samplings = node_samplings;
+    composition->node_colds = node_colds;
+    composition->node_geometries = node_geometries;
+    composition->update_nodes = update_nodes;
+    composition->update_node_enumerators = update_node_enumerators;
+    composition->update_node_deeps = update_node_deeps;
+    composition->update_node_intervals = update_node_intervals;
+    composition->update_node_interval_orders = update_node_interval_orders;
+    composition->update_node_interval_indices = update_node_interval_indices;
+    composition->subcompositions = subcompositions;
+
+    return composition;
+}
+//////////////////////////////////////////////////////////////////////////
+const aeMovieComposition * ae_create_movie_composition( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _interpolate, const aeMovieCompositionProviders * _providers, ae_userdata_t _userdata )
+{
+    aeMovieComposition * composition = __create_movie_composition_structure( _movieData, _compositionData, _interpolate );
+
+    if( composition == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
+    }
+
+    if( __setup_movie_composition_providers( composition, _providers, _userdata ) == AE_FALSE )
+    {
+        __delete_movie_composition_structure( composition );
+
         return AE_NULLPTR;
     }
 
-    if( __setup_movie_node_shader( composition ) == AE_FALSE )
+    return composition;
+}
+//////////////////////////////////////////////////////////////////////////
+const aeMovieCompositionTemplate * ae_create_movie_composition_template( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _interpolate )
+{
+    aeMovieCompositionTemplate * compositionTemplate = AE_NEW( _movieData->instance, aeMovieCompositionTemplate );
+
+    if( compositionTemplate == AE_NULLPTR )
     {
         return AE_NULLPTR;
     }
 
-    if( __setup_movie_composition_element( composition ) == AE_FALSE )
+    aeMovieComposition * composition = __create_movie_composition_structure( _movieData, _compositionData, _interpolate );
+
+    if( composition == AE_NULLPTR )
     {
+        AE_DELETE( _movieData->instance, compositionTemplate );
+
         return AE_NULLPTR;
     }
 
-    if( __setup_movie_node_track_matte2( composition ) == AE_FALSE )
+    compositionTemplate->composition = composition;
+
+    return compositionTemplate;
+}
+//////////////////////////////////////////////////////////////////////////
+const aeMovieComposition * ae_create_movie_composition_from_template( const aeMovieCompositionTemplate * _compositionTemplate, const aeMovieCompositionProviders * _providers, ae_userdata_t _userdata )
+{
+    aeMovieComposition * composition = __clone_movie_composition_structure( _compositionTemplate->composition );
+
+    if( composition == AE_NULLPTR )
     {
         return AE_NULLPTR;
     }
 
-    if( __setup_movie_composition_scene_effect( composition ) == AE_FALSE )
+    if( __setup_movie_composition_providers( composition, _providers, _userdata ) == AE_FALSE )
     {
+        __delete_movie_composition_structure( composition );
+
         return AE_NULLPTR;
     }
 
@@ -2003,11 +3631,13 @@ AE_INTERNAL ae_void_t __delete_nodes( const aeMovieComposition * _composition )
 
         const aeMovieLayerData * layer = node->layer_data;
 
-        if( node->shader_userdata != AE_NULLPTR )
+        const aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, node );
+
+        if( node_cold->shader_userdata != AE_NULLPTR )
         {
             aeMovieShaderDeleterCallbackData callbackData;
             callbackData.index = enumerator;
-            callbackData.element_userdata = node->shader_userdata;
+            callbackData.element_userdata = node_cold->shader_userdata;
             callbackData.name = layer->extensions->shader->name;
             callbackData.version = layer->extensions->shader->version;
 
@@ -2018,9 +3648,9 @@ AE_INTERNAL ae_void_t __delete_nodes( const aeMovieComposition * _composition )
         {
             aeMovieTrackMatteDeleterCallbackData callbackData;
             callbackData.index = enumerator;
-            callbackData.element_userdata = node->element_userdata;
+            callbackData.element_userdata = node_cold->element_userdata;
             callbackData.layer_data = layer;
-            callbackData.track_matte_userdata = node->track_matte_userdata;
+            callbackData.track_matte_userdata = node_cold->track_matte_userdata;
 
             (*_composition->providers.track_matte_deleter)(&callbackData, _composition->provider_userdata);
         }
@@ -2029,7 +3659,7 @@ AE_INTERNAL ae_void_t __delete_nodes( const aeMovieComposition * _composition )
 
         aeMovieNodeDeleterCallbackData callbackData;
         callbackData.index = enumerator;
-        callbackData.element_userdata = node->element_userdata;
+        callbackData.element_userdata = node_cold->element_userdata;
         callbackData.layer_data = layer;
         callbackData.track_matte_layer = track_matte_layer;
 
@@ -2064,20 +3694,14 @@ AE_INTERNAL ae_void_t __delete_scene_effect( const aeMovieComposition * _composi
     aeMovieNode * scene_effect_node = _composition->scene_effect_node;
 
     aeMovieCompositionSceneEffectDeleterCallbackData callbackData;
-    callbackData.element_userdata = scene_effect_node->element_userdata;
+    callbackData.element_userdata = __get_movie_composition_node_cold( _composition, scene_effect_node )->element_userdata;
     callbackData.scene_effect_userdata = _composition->scene_effect_userdata;
 
     (*_composition->providers.scene_effect_deleter)(&callbackData, _composition->provider_userdata);
 }
 //////////////////////////////////////////////////////////////////////////
-ae_void_t ae_delete_movie_composition( const aeMovieComposition * _composition )
+AE_INTERNAL ae_void_t __delete_subcompositions( const aeMovieComposition * _composition )
 {
-    __delete_nodes( _composition );
-    __delete_camera( _composition );
-    __delete_scene_effect( _composition );
-
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
     const aeMovieSubComposition * it_subcomposition = _composition->subcompositions;
     const aeMovieSubComposition * it_subcomposition_end = _composition->subcompositions + _composition->subcomposition_count;
     for( ; it_subcomposition != it_subcomposition_end; ++it_subcomposition )
@@ -2088,18 +3712,26 @@ ae_void_t ae_delete_movie_composition( const aeMovieComposition * _composition )
         callbackData.subcomposition_userdata = subcomposition->subcomposition_userdata;
 
         (*_composition->providers.subcomposition_deleter)(&callbackData, _composition->provider_userdata);
-
-        AE_DELETE( instance, subcomposition->animation );
     }
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_delete_movie_composition( const aeMovieComposition * _composition )
+{
+    __delete_nodes( _composition );
+    __delete_camera( _composition );
+    __delete_scene_effect( _composition );
+    __delete_subcompositions( _composition );
 
-    AE_DELETEN( instance, _composition->subcompositions );
-
-    AE_DELETEN( instance, _composition->nodes );
-    AE_DELETEN( instance, _composition->update_nodes );
+    __delete_movie_composition_structure( _composition );
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_delete_movie_composition_template( const aeMovieCompositionTemplate * _compositionTemplate )
+{
+    const aeMovieInstance * instance = _compositionTemplate->composition->movie_data->instance;
 
-    AE_DELETE( instance, _composition->animation );
+    __delete_movie_composition_structure( _compositionTemplate->composition );
 
-    AE_DELETE( instance, _composition );
+    AE_DELETE( instance, _compositionTemplate );
 }
 //////////////////////////////////////////////////////////////////////////
 const aeMovieCompositionData * ae_get_movie_composition_composition_data( const aeMovieComposition * _composition )
@@ -2384,6 +4016,24 @@ ae_bool_t ae_get_movie_composition_interpolate( const aeMovieComposition * _comp
     return interpolate;
 }
 //////////////////////////////////////////////////////////////////////////
+ae_uint32_t ae_get_movie_composition_matrix_skip_count( const aeMovieComposition * _composition )
+{
+    ae_uint32_t skip_count = 0U;
+
+    const aeMovieNode * it_node = _composition->nodes;
+    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
+    for( ; it_node != it_node_end; ++it_node )
+    {
+        const aeMovieNode * node = it_node;
+
+        const aeMovieNodeSampling * node_sampling = __get_movie_composition_node_sampling( _composition, node );
+
+        skip_count += node_sampling->matrix_skip_count;
+    }
+
+    return skip_count;
+}
+//////////////////////////////////////////////////////////////////////////
 ae_bool_t ae_is_play_movie_composition( const aeMovieComposition * _composition )
 {
     const aeMovieCompositionAnimation * animation = _composition->animation;
@@ -2430,6 +4080,8 @@ AE_INTERNAL ae_void_t __notify_stop_nodies( const aeMovieComposition * _composit
 
         const aeMovieLayerData * layer = node->layer_data;
 
+        const aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, node );
+
         if( layer->is_track_matte == AE_TRUE )
         {
             if( node->animate != AE_MOVIE_NODE_ANIMATE_STATIC && node->animate != AE_MOVIE_NODE_ANIMATE_END )
@@ -2439,7 +4091,7 @@ AE_INTERNAL ae_void_t __notify_stop_nodies( const aeMovieComposition * _composit
 
                 aeMovieTrackMatteUpdateCallbackData callbackData;
                 callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
+                callbackData.element_userdata = node_cold->element_userdata;
                 callbackData.layer_data = layer;
                 callbackData.loop = _animation->loop;
                 callbackData.state = AE_MOVIE_STATE_UPDATE_STOP;
@@ -2450,7 +4102,7 @@ AE_INTERNAL ae_void_t __notify_stop_nodies( const aeMovieComposition * _composit
                 callbackData.color = node->color;
                 callbackData.opacity = node->opacity * node->extra_opacity;
                 callbackData.mesh = &mesh;
-                callbackData.track_matte_userdata = node->track_matte_userdata;
+                callbackData.track_matte_userdata = node_cold->track_matte_userdata;
 
                 (*_composition->providers.track_matte_update)(&callbackData, _composition->provider_userdata);
 
@@ -2463,17 +4115,18 @@ AE_INTERNAL ae_void_t __notify_stop_nodies( const aeMovieComposition * _composit
             {
                 aeMovieNodeUpdateCallbackData callbackData;
                 callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
+                callbackData.element_userdata = node_cold->element_userdata;
                 callbackData.layer_data = layer;
                 callbackData.loop = _animation->loop;
                 callbackData.state = AE_MOVIE_STATE_UPDATE_STOP;
                 callbackData.offset = AE_TIME_OUTSCALE( 0.f );
                 callbackData.immutable_matrix = node->immutable_matrix;
                 callbackData.matrix = node->matrix;
+                callbackData.matrix_changed = __notify_movie_composition_node_matrix_changed( _composition, node );
                 callbackData.immutable_color = node->immutable_color;
                 callbackData.color = node->color;
                 callbackData.opacity = node->opacity * node->extra_opacity;
-                callbackData.volume = node->volume;
+                callbackData.volume = node_cold->volume;
 
                 (*_composition->providers.node_update)(&callbackData, _composition->provider_userdata);
 
@@ -2516,6 +4169,8 @@ AE_INTERNAL ae_void_t __notify_pause_nodies( const aeMovieComposition * _composi
 
         const aeMovieLayerData * layer = node->layer_data;
 
+        const aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, node );
+
         if( layer->is_track_matte == AE_TRUE )
         {
             if( node->animate != AE_MOVIE_NODE_ANIMATE_STATIC && node->animate != AE_MOVIE_NODE_ANIMATE_END )
@@ -2525,7 +4180,7 @@ AE_INTERNAL ae_void_t __notify_pause_nodies( const aeMovieComposition * _composi
 
                 aeMovieTrackMatteUpdateCallbackData callbackData;
                 callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
+                callbackData.element_userdata = node_cold->element_userdata;
                 callbackData.layer_data = layer;
                 callbackData.loop = _animation->loop;
                 callbackData.state = AE_MOVIE_STATE_UPDATE_PAUSE;
@@ -2536,7 +4191,7 @@ AE_INTERNAL ae_void_t __notify_pause_nodies( const aeMovieComposition * _composi
                 callbackData.color = node->color;
                 callbackData.opacity = node->opacity * node->extra_opacity;
                 callbackData.mesh = &mesh;
-                callbackData.track_matte_userdata = node->track_matte_userdata;
+                callbackData.track_matte_userdata = node_cold->track_matte_userdata;
 
                 (*_composition->providers.track_matte_update)(&callbackData, _composition->provider_userdata);
             }
@@ -2547,17 +4202,18 @@ AE_INTERNAL ae_void_t __notify_pause_nodies( const aeMovieComposition * _composi
             {
                 aeMovieNodeUpdateCallbackData callbackData;
                 callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
+                callbackData.element_userdata = node_cold->element_userdata;
                 callbackData.layer_data = layer;
                 callbackData.loop = _animation->loop;
                 callbackData.state = AE_MOVIE_STATE_UPDATE_PAUSE;
                 callbackData.offset = AE_TIME_OUTSCALE( node->current_time );
                 callbackData.immutable_matrix = node->immutable_matrix;
                 callbackData.matrix = node->matrix;
+                callbackData.matrix_changed = __notify_movie_composition_node_matrix_changed( _composition, node );
                 callbackData.immutable_color = node->immutable_color;
                 callbackData.color = node->color;
                 callbackData.opacity = node->opacity * node->extra_opacity;
-                callbackData.volume = node->volume;
+                callbackData.volume = node_cold->volume;
 
                 (*_composition->providers.node_update)(&callbackData, _composition->provider_userdata);
             }
@@ -2622,6 +4278,8 @@ AE_INTERNAL ae_void_t __notify_resume_nodies( const aeMovieComposition * _compos
 
         const aeMovieLayerData * layer = node->layer_data;
 
+        const aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, node );
+
         if( layer->is_track_matte == AE_TRUE )
         {
             if( node->animate != AE_MOVIE_NODE_ANIMATE_STATIC && node->animate != AE_MOVIE_NODE_ANIMATE_END )
@@ -2631,7 +4289,7 @@ AE_INTERNAL ae_void_t __notify_resume_nodies( const aeMovieComposition * _compos
 
                 aeMovieTrackMatteUpdateCallbackData callbackData;
                 callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
+                callbackData.element_userdata = node_cold->element_userdata;
                 callbackData.layer_data = layer;
                 callbackData.loop = _animation->loop;
                 callbackData.state = AE_MOVIE_STATE_UPDATE_RESUME;
@@ -2642,7 +4300,7 @@ AE_INTERNAL ae_void_t __notify_resume_nodies( const aeMovieComposition * _compos
                 callbackData.color = node->color;
                 callbackData.opacity = node->opacity * node->extra_opacity;
                 callbackData.mesh = &mesh;
-                callbackData.track_matte_userdata = node->track_matte_userdata;
+                callbackData.track_matte_userdata = node_cold->track_matte_userdata;
 
                 (*_composition->providers.track_matte_update)(&callbackData, _composition->provider_userdata);
             }
@@ -2653,17 +4311,18 @@ AE_INTERNAL ae_void_t __notify_resume_nodies( const aeMovieComposition * _compos
             {
                 aeMovieNodeUpdateCallbackData callbackData;
                 callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
+                callbackData.element_userdata = node_cold->element_userdata;
                 callbackData.layer_data = layer;
                 callbackData.loop = _animation->loop;
                 callbackData.state = AE_MOVIE_STATE_UPDATE_RESUME;
                 callbackData.offset = AE_TIME_OUTSCALE( node->current_time );
                 callbackData.immutable_matrix = node->immutable_matrix;
                 callbackData.matrix = node->matrix;
+                callbackData.matrix_changed = __notify_movie_composition_node_matrix_changed( _composition, node );
                 callbackData.immutable_color = node->immutable_color;
                 callbackData.color = node->color;
                 callbackData.opacity = node->opacity * node->extra_opacity;
-                callbackData.volume = node->volume;
+                callbackData.volume = node_cold->volume;
 
                 (*_composition->providers.node_update)(&callbackData, _composition->provider_userdata);
             }
@@ -2757,7 +4416,9 @@ AE_INTERNAL ae_float_t __get_animation_loop_work_end( const aeMovieCompositionAn
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __update_movie_composition_node_normal_state( const aeMovieComposition * _composition, const aeMovieCompositionAnimation * _animation, aeMovieNode * _node, ae_uint32_t _index, ae_bool_t _loop, ae_bool_t _begin, ae_float_t _time )
 {
-    if( _node->element_userdata == AE_NULLPTR )
+    const aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, _node );
+
+    if( node_cold->element_userdata == AE_NULLPTR )
     {
         return;
     }
@@ -2766,16 +4427,17 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_normal_state( const aeMovi
 
     aeMovieNodeUpdateCallbackData callbackData;
     callbackData.index = _index;
-    callbackData.element_userdata = _node->element_userdata;
+    callbackData.element_userdata = node_cold->element_userdata;
     callbackData.layer_data = layer;
     callbackData.interrupt = _animation->interrupt;
     callbackData.loop = _loop;
     callbackData.immutable_matrix = _node->immutable_matrix;
     callbackData.matrix = _node->matrix;
+    callbackData.matrix_changed = __notify_movie_composition_node_matrix_changed( _composition, _node );
     callbackData.immutable_color = _node->immutable_color;
     callbackData.color = _node->color;
     callbackData.opacity = _node->opacity * _node->extra_opacity;
-    callbackData.volume = _node->volume;
+    callbackData.volume = node_cold->volume;
 
     if( _animation->play == AE_FALSE )
     {
@@ -2859,6 +4521,8 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_track_matte_state( const a
 {
     const aeMovieLayerData * layer = _node->layer_data;
 
+    const aeMovieNodeCold * node_cold = __get_movie_composition_node_cold( _composition, _node );
+
     aeMovieLayerTypeEnum layer_type = layer->type;
 
     switch( layer_type )
@@ -2877,7 +4541,7 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_track_matte_state( const a
 
     aeMovieTrackMatteUpdateCallbackData callbackData;
     callbackData.index = _index;
-    callbackData.element_userdata = _node->element_userdata;
+    callbackData.element_userdata = node_cold->element_userdata;
     callbackData.layer_data = layer;
     callbackData.interrupt = _animation->interrupt;
     callbackData.loop = _loop;
@@ -2900,7 +4564,7 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_track_matte_state( const a
     callbackData.color = _node->color;
     callbackData.opacity = 0.f;
     callbackData.mesh = &mesh;
-    callbackData.track_matte_userdata = _node->track_matte_userdata;
+    callbackData.track_matte_userdata = node_cold->track_matte_userdata;
 
     if( _begin == AE_TRUE )
     {
@@ -2950,7 +4614,7 @@ AE_INTERNAL ae_void_t __update_movie_composition_node_state( const aeMovieCompos
     }
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __update_node( const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, const aeMovieCompositionAnimation * _animation, aeMovieNode * _node, ae_uint32_t _index, ae_float_t _time, ae_uint32_t _frameId, ae_float_t _t, ae_bool_t _loop, ae_bool_t _interpolate, ae_bool_t _begin )
+AE_INTERNAL ae_void_t __update_node( const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, const aeMovieCompositionAnimation * _animation, aeMovieNode * _node, ae_uint32_t _index, ae_float_t _time, ae_uint32_t _frameId, ae_float_t _t, ae_bool_t _loop, ae_bool_t _interpolate, ae_bool_t _begin, const aeMovieNodeLocalMatrix * _local )
 {
     const aeMovieLayerData * node_layer = _node->layer_data;
 
@@ -2975,9 +4639,9 @@ AE_INTERNAL ae_void_t __update_node( const aeMovieComposition * _composition, co
 
     ae_bool_t node_interpolate = (_frameId + 1 == node_layer->frame_count) ? AE_FALSE : _interpolate;
 
-    __update_movie_composition_node_matrix( _node, _composition, _compositionData, _frameId, node_interpolate, _t );
+    __update_movie_composition_node_matrix( _node, _composition, _compositionData, _frameId, node_interpolate, _t, _local );
 
-    if( _node->shader_userdata != AE_NULLPTR )
+    if( __get_movie_composition_node_cold( _composition, _node )->shader_userdata != AE_NULLPTR )
     {
         __update_movie_composition_node_shader( _node, _composition, _compositionData, _frameId, node_interpolate, _t );
     }
@@ -3006,7 +4670,7 @@ AE_INTERNAL ae_void_t __update_movie_scene_effect( const aeMovieComposition * _c
     ae_uint32_t frameId = (ae_uint32_t)frame_time;
 
     aeMovieCompositionSceneEffectUpdateCallbackData callbackData;
-    callbackData.element_userdata = scene_effect_node->element_userdata;
+    callbackData.element_userdata = __get_movie_composition_node_cold( _composition, scene_effect_node )->element_userdata;
 
     ae_bool_t composition_interpolate = _composition->interpolate;
 
@@ -3032,9 +4696,17 @@ AE_INTERNAL ae_void_t __refresh_movie_composition_matrix( const aeMovieCompositi
 {
     ae_bool_t composition_interpolate = _composition->interpolate;
 
-    aeMovieNode ** it_node = _composition->update_nodes;
-    aeMovieNode ** it_node_end = _composition->update_nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    ae_uint32_t update_node_count;
+    aeMovieNode ** update_nodes = __get_movie_composition_update_nodes( _composition, _subcomposition, &update_node_count );
+
+    aeMovieNodeMatrixBatch batch;
+    __clear_movie_composition_node_matrix_batch( &batch, 0U );
+
+    const ae_uint32_t * it_deep = _composition->update_node_deeps + (update_nodes - _composition->update_nodes);
+
+    aeMovieNode ** it_node = update_nodes;
+    aeMovieNode ** it_node_end = update_nodes + update_node_count;
+    for( ; it_node != it_node_end; ++it_node, ++it_deep )
     {
         aeMovieNode * node = *it_node;
 
@@ -3048,11 +4720,6 @@ AE_INTERNAL ae_void_t __refresh_movie_composition_matrix( const aeMovieCompositi
             continue;
         }
 
-        if( node->subcomposition != _subcomposition )
-        {
-            continue;
-        }
-
         const aeMovieLayerData * node_layer = node->layer_data;
 
         if( node_layer->type == AE_MOVIE_LAYER_TYPE_EVENT )
@@ -3072,225 +4739,421 @@ AE_INTERNAL ae_void_t __refresh_movie_composition_matrix( const aeMovieCompositi
             t = ae_fractional_f( frame_time );
         }
 
-        __update_movie_composition_node_matrix( node, _composition, _compositionData, frameId, composition_interpolate, t );
+        if( __is_movie_composition_node_matrix_batch_full( &batch, *it_deep ) == AE_TRUE )
+        {
+            __flush_movie_composition_node_matrix_batch( &batch, _composition, _compositionData );
+
+            __clear_movie_composition_node_matrix_batch( &batch, *it_deep );
+        }
+
+        __push_movie_composition_node_matrix_batch( &batch, _composition, node, frameId, composition_interpolate, t );
     }
+
+    __flush_movie_composition_node_matrix_batch( &batch, _composition, _compositionData );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __update_movie_composition_node( const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, const aeMovieCompositionAnimation * _animation, const aeMovieSubComposition * _subcomposition, ae_float_t _beginTime, ae_bool_t _interpolate, ae_bool_t _end )
+typedef struct aeMovieNodeUpdateContext
 {
-    ae_bool_t composition_interpolate = _composition->interpolate && _interpolate;
-
-    ae_float_t animation_time = _animation->time;
-    ae_bool_t animation_interrupt = _animation->interrupt;
-    ae_bool_t animation_loop = _animation->loop;
+    ae_float_t begin_time;
+    ae_float_t animation_time;
+    ae_bool_t animation_interrupt;
+    ae_bool_t animation_loop;
+    ae_bool_t interpolate;
 
     ae_uint32_t loop_begin_frame;
     ae_uint32_t loop_end_frame;
-    ae_float_t loop_begin_time = __get_animation_loop_work_begin( _animation, &loop_begin_frame );
-    ae_float_t loop_end_time = __get_animation_loop_work_end( _animation, &loop_end_frame );
+    ae_float_t loop_begin_time;
+    ae_float_t loop_end_time;
+} aeMovieNodeUpdateContext;
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieNodeUpdateFrame
+{
+    ae_uint32_t begin_frame;
+    ae_uint32_t end_frame;
+    ae_uint32_t in_frame;
+    ae_uint32_t out_frame;
 
-    ae_uint32_t enumerator = 0U;
+    ae_float_t stretch_time;
+    ae_uint32_t frame;
+    ae_float_t frame_time_for_fractional;
+} aeMovieNodeUpdateFrame;
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __compute_movie_composition_node_update_frame( const aeMovieNodeUpdateContext * _context, const aeMovieNode * _node, aeMovieNodeUpdateFrame * _frame )
+{
+    const aeMovieLayerData * node_layer = _node->layer_data;
 
-    aeMovieNode ** it_node = _composition->update_nodes;
-    aeMovieNode ** it_node_end = _composition->update_nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node, ++enumerator )
+    ae_float_t frameDurationInv = node_layer->composition_data->frameDurationInv;
+
+    ae_bool_t test_time = (_context->begin_time >= _context->loop_begin_time
+        && _context->animation_time < _context->loop_end_time
+        && _context->animation_interrupt == AE_FALSE
+        && _context->animation_loop == AE_TRUE
+        && node_layer->type != AE_MOVIE_LAYER_TYPE_EVENT);
+
+    ae_float_t node_out_time = (test_time == AE_TRUE && _node->out_time >= _context->loop_end_time) ? _context->loop_end_time : _node->out_time;
+
+    _frame->in_frame = (test_time == AE_TRUE && _node->in_frame <= _context->loop_begin_frame) ? _context->loop_begin_frame : _node->in_frame;
+    _frame->out_frame = (test_time == AE_TRUE && _node->out_frame >= _context->loop_end_frame) ? _context->loop_end_frame : _node->out_frame;
+
+    _frame->begin_frame = (ae_uint32_t)(_context->begin_time * frameDurationInv + AE_MOVIE_FRAME_EPSILON);
+    _frame->end_frame = (ae_uint32_t)(_context->animation_time * frameDurationInv + AE_MOVIE_FRAME_EPSILON);
+
+    ae_float_t node_current_time = (_context->animation_time >= node_out_time) ? node_out_time - _node->in_time + _node->start_time : _context->animation_time - _node->in_time + _node->start_time;
+
+    if( node_current_time < 0.f )
     {
-        aeMovieNode * node = *it_node;
+        node_current_time = 0.f;
+    }
 
-        if( node->ignore == AE_TRUE )
+    ae_float_t node_stretch_time = node_current_time * _node->stretchInv;
+    ae_float_t node_frame_time = node_stretch_time * frameDurationInv;
+
+    ae_uint32_t nodeFrameId2 = (ae_uint32_t)node_frame_time;
+    ae_uint32_t nodeFrameId = (ae_uint32_t)(node_frame_time + AE_MOVIE_FRAME_EPSILON);
+
+    _frame->stretch_time = node_stretch_time;
+    _frame->frame = nodeFrameId;
+    _frame->frame_time_for_fractional = (nodeFrameId != nodeFrameId2) ? 0.f : node_frame_time;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __get_movie_composition_node_update_sample( const aeMovieNodeUpdateContext * _context, const aeMovieNode * _node, const aeMovieNodeUpdateFrame * _frame, ae_uint32_t * _frameId, ae_bool_t * _interpolate, ae_float_t * _t )
+{
+    //mirrors the branches of __update_movie_composition_node, a wrong guess only costs the scalar path
+    if( _node->ignore == AE_TRUE )
+    {
+        return AE_FALSE;
+    }
+
+    const aeMovieLayerData * node_layer = _node->layer_data;
+
+    aeMovieLayerTypeEnum node_layer_type = node_layer->type;
+
+    //events sample only on the frames they fire
+    if( node_layer_type == AE_MOVIE_LAYER_TYPE_EVENT )
+    {
+        return AE_FALSE;
+    }
+
+    ae_uint32_t beginFrame = _frame->begin_frame;
+    ae_uint32_t endFrame = _frame->end_frame;
+    ae_uint32_t nodeInFrame = _frame->in_frame;
+    ae_uint32_t nodeOutFrame = _frame->out_frame;
+
+    ae_bool_t node_always = (_node->incessantly == AE_TRUE || node_layer_type == AE_MOVIE_LAYER_TYPE_SUB_MOVIE) ? AE_TRUE : AE_FALSE;
+
+    ae_uint32_t frameId;
+    ae_bool_t interpolate = AE_FALSE;
+    ae_float_t t = 0.f;
+
+    if( nodeInFrame > endFrame || nodeOutFrame < beginFrame )
+    {
+        if( node_always == AE_FALSE )
         {
-            continue;
+            return AE_FALSE;
         }
 
-        if( node->subcomposition != _subcomposition )
+        frameId = 0U;
+    }
+    else if( nodeInFrame > beginFrame && nodeOutFrame < endFrame )
+    {
+        if( node_always == AE_FALSE )
         {
-            continue;
+            return AE_FALSE;
         }
 
-        const aeMovieLayerData * node_layer = node->layer_data;
+        frameId = _frame->frame;
+    }
+    else if( beginFrame < nodeInFrame && endFrame >= nodeInFrame && endFrame < nodeOutFrame )
+    {
+        frameId = _frame->frame;
 
-        aeMovieLayerTypeEnum node_layer_type = node_layer->type;
+        interpolate = (_context->interpolate == AE_TRUE) ? (endFrame + 1) < nodeOutFrame : AE_FALSE;
 
-        ae_float_t frameDurationInv = node_layer->composition_data->frameDurationInv;
+        t = (interpolate == AE_TRUE) ? ae_fractional_f( _frame->frame_time_for_fractional ) : _node->current_frame_t;
+    }
+    else if( endFrame >= nodeOutFrame && beginFrame >= nodeInFrame && beginFrame < nodeOutFrame )
+    {
+        frameId = nodeOutFrame - nodeInFrame;
+    }
+    else if( beginFrame >= nodeInFrame && endFrame >= nodeInFrame && endFrame < nodeOutFrame )
+    {
+        frameId = _frame->frame;
+
+        interpolate = (_context->interpolate == AE_TRUE) ? (endFrame + 1) < nodeOutFrame : AE_FALSE;
 
-        ae_bool_t test_time = (_beginTime >= loop_begin_time
-            && animation_time < loop_end_time
-            && animation_interrupt == AE_FALSE
-            && animation_loop == AE_TRUE
-            && node_layer_type != AE_MOVIE_LAYER_TYPE_EVENT);
+        t = (interpolate == AE_TRUE) ? ae_fractional_f( _frame->frame_time_for_fractional ) : _node->current_frame_t;
+    }
+    else
+    {
+        return AE_FALSE;
+    }
 
-        ae_float_t node_in_time = (test_time == AE_TRUE && node->in_time <= loop_begin_time) ? loop_begin_time : node->in_time;
-        ae_float_t node_out_time = (test_time == AE_TRUE && node->out_time >= loop_end_time) ? loop_end_time : node->out_time;
+    if( frameId >= node_layer->frame_count )
+    {
+        return AE_FALSE;
+    }
 
-        ae_frame_t node_in_frame = (test_time == AE_TRUE && node->in_frame <= loop_begin_frame) ? loop_begin_frame : node->in_frame;
-        ae_frame_t node_out_frame = (test_time == AE_TRUE && node->out_frame >= loop_end_frame) ? loop_end_frame : node->out_frame;
+    if( frameId + 1 == node_layer->frame_count )
+    {
+        interpolate = AE_FALSE;
+    }
 
-        AE_UNUSED( node_in_time );
+    *_frameId = frameId;
+    *_interpolate = interpolate;
+    *_t = t;
 
-        ae_uint32_t beginFrame = (ae_uint32_t)(_beginTime * frameDurationInv + AE_MOVIE_FRAME_EPSILON);
-        ae_uint32_t endFrame = (ae_uint32_t)(animation_time * frameDurationInv + AE_MOVIE_FRAME_EPSILON);
-        ae_uint32_t nodeInFrame = node_in_frame;
-        ae_uint32_t nodeOutFrame = node_out_frame;
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const ae_uint32_t * __gather_movie_composition_node_update_batch( aeMovieNodeMatrixBatch * _batch, aeMovieNodeUpdateFrame * _frames, const aeMovieComposition * _composition, const aeMovieNodeUpdateContext * _context, const ae_uint32_t * _begin, const ae_uint32_t * _end )
+{
+    __clear_movie_composition_node_matrix_batch( _batch, _composition->update_node_deeps[*_begin] );
 
-        ae_float_t node_current_time = (animation_time >= node_out_time) ? node_out_time - node->in_time + node->start_time : animation_time - node->in_time + node->start_time;
+    const ae_uint32_t * it_visit = _begin;
+    for( ; it_visit != _end; ++it_visit )
+    {
+        ae_uint32_t position = *it_visit;
 
-        if( node_current_time < 0.f )
+        if( __is_movie_composition_node_matrix_batch_full( _batch, _composition->update_node_deeps[position] ) == AE_TRUE )
         {
-            node_current_time = 0.f;
+            break;
         }
 
-        ae_float_t node_stretch_time = node_current_time * node->stretchInv;
-        ae_float_t node_frame_time = node_stretch_time * frameDurationInv;
+        aeMovieNode * node = _composition->update_nodes[position];
 
-        ae_uint32_t nodeFrameId2 = (ae_uint32_t)node_frame_time;
-        ae_uint32_t nodeFrameId = (ae_uint32_t)(node_frame_time + AE_MOVIE_FRAME_EPSILON);
+        //the update below reuses the frame, the timing is computed once per visit
+        aeMovieNodeUpdateFrame * update_frame = _frames + _batch->count;
+        __compute_movie_composition_node_update_frame( _context, node, update_frame );
 
-        ae_float_t node_frame_time_for_fractional = node_frame_time;
-        if( nodeFrameId != nodeFrameId2 )
+        ae_uint32_t frameId;
+        ae_bool_t interpolate;
+        ae_float_t t;
+        if( __get_movie_composition_node_update_sample( _context, node, update_frame, &frameId, &interpolate, &t ) == AE_FALSE )
         {
-            node_frame_time_for_fractional = 0.f;
+            __skip_movie_composition_node_matrix_batch( _batch, node );
+
+            continue;
         }
 
-        if( node_layer_type == AE_MOVIE_LAYER_TYPE_EVENT )
+        __push_movie_composition_node_matrix_batch( _batch, _composition, node, frameId, interpolate, t );
+    }
+
+    __make_movie_composition_node_matrix_batch( _batch );
+
+    return it_visit;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __update_movie_composition_node( const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, const aeMovieCompositionAnimation * _animation, const aeMovieSubComposition * _subcomposition, ae_float_t _beginTime, ae_bool_t _interpolate, ae_bool_t _end )
+{
+    ae_bool_t composition_interpolate = _composition->interpolate && _interpolate;
+
+    ae_float_t animation_time = _animation->time;
+    ae_bool_t animation_interrupt = _animation->interrupt;
+    ae_bool_t animation_loop = _animation->loop;
+
+    ae_uint32_t loop_begin_frame;
+    ae_uint32_t loop_end_frame;
+    ae_float_t loop_begin_time = __get_animation_loop_work_begin( _animation, &loop_begin_frame );
+    ae_float_t loop_end_time = __get_animation_loop_work_end( _animation, &loop_end_frame );
+
+    aeMovieNodeUpdateContext context;
+    context.begin_time = _beginTime;
+    context.animation_time = animation_time;
+    context.animation_interrupt = animation_interrupt;
+    context.animation_loop = animation_loop;
+    context.interpolate = composition_interpolate;
+    context.loop_begin_frame = loop_begin_frame;
+    context.loop_end_frame = loop_end_frame;
+    context.loop_begin_time = loop_begin_time;
+    context.loop_end_time = loop_end_time;
+
+    const ae_uint32_t * visit_nodes;
+    ae_uint32_t visit_count = __gather_movie_composition_interval_nodes( _composition, _subcomposition, _beginTime, animation_time, &visit_nodes );
+
+    aeMovieNodeMatrixBatch batch;
+    aeMovieNodeUpdateFrame batch_frames[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+
+    const ae_uint32_t * it_visit = visit_nodes;
+    const ae_uint32_t * it_visit_end = visit_nodes + visit_count;
+    while( it_visit != it_visit_end )
+    {
+        //local matrices of one deep level are built ahead, the callbacks below still run in node order
+        const ae_uint32_t * it_batch_end = __gather_movie_composition_node_update_batch( &batch, batch_frames, _composition, &context, it_visit, it_visit_end );
+
+        ae_uint32_t batch_index = 0U;
+        for( ; it_visit != it_batch_end; ++it_visit, ++batch_index )
         {
-            node->current_time = node_stretch_time;
-            node->current_frame = nodeFrameId;
-            node->current_frame_t = 0.f;
+            ae_uint32_t position = *it_visit;
 
-            if( beginFrame < nodeInFrame && endFrame > nodeInFrame )
-            {
-                __update_movie_composition_node_matrix( node, _composition, _compositionData, nodeFrameId, AE_FALSE, 0.f );
+            aeMovieNode * node = _composition->update_nodes[position];
 
-                aeMovieCompositionEventCallbackData callbackData;
-                callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
-                callbackData.name = node_layer->name;
-                callbackData.immutable_matrix = node->immutable_matrix;
-                callbackData.matrix = node->matrix;
-                callbackData.immutable_color = node->immutable_color;
-                callbackData.color = node->color;
-                callbackData.opacity = node->opacity * node->extra_opacity;
-                callbackData.begin = AE_TRUE;
+            ae_uint32_t enumerator = _composition->update_node_enumerators[position];
 
-                (*_composition->providers.composition_event)(&callbackData, _composition->provider_userdata);
+            if( node->ignore == AE_TRUE )
+            {
+                continue;
             }
 
-            if( beginFrame < nodeOutFrame && endFrame > nodeOutFrame )
-            {
-                __update_movie_composition_node_matrix( node, _composition, _compositionData, nodeFrameId, AE_FALSE, 0.f );
+            const aeMovieNodeLocalMatrix * node_local = __get_movie_composition_node_matrix_batch_local( &batch, batch_index );
 
-                aeMovieCompositionEventCallbackData callbackData;
-                callbackData.index = enumerator;
-                callbackData.element_userdata = node->element_userdata;
-                callbackData.name = node_layer->name;
-                callbackData.immutable_matrix = node->immutable_matrix;
-                callbackData.matrix = node->matrix;
-                callbackData.immutable_color = node->immutable_color;
-                callbackData.color = node->color;
-                callbackData.opacity = node->opacity * node->extra_opacity;
-                callbackData.begin = AE_FALSE;
+            const aeMovieLayerData * node_layer = node->layer_data;
 
-                (*_composition->providers.composition_event)(&callbackData, _composition->provider_userdata);
-            }
+            aeMovieLayerTypeEnum node_layer_type = node_layer->type;
 
-            continue;
-        }
+            const aeMovieNodeUpdateFrame * update_frame = batch_frames + batch_index;
 
-        if( nodeInFrame > endFrame || nodeOutFrame < beginFrame )
-        {
-            if( node->incessantly == AE_TRUE || node_layer_type == AE_MOVIE_LAYER_TYPE_SUB_MOVIE )
+            ae_uint32_t beginFrame = update_frame->begin_frame;
+            ae_uint32_t endFrame = update_frame->end_frame;
+            ae_uint32_t nodeInFrame = update_frame->in_frame;
+            ae_uint32_t nodeOutFrame = update_frame->out_frame;
+
+            ae_float_t node_stretch_time = update_frame->stretch_time;
+            ae_uint32_t nodeFrameId = update_frame->frame;
+            ae_float_t node_frame_time_for_fractional = update_frame->frame_time_for_fractional;
+
+            if( node_layer_type == AE_MOVIE_LAYER_TYPE_EVENT )
             {
                 node->current_time = node_stretch_time;
                 node->current_frame = nodeFrameId;
                 node->current_frame_t = 0.f;
 
-                __update_movie_composition_node_matrix( node, _composition, _compositionData, 0, AE_FALSE, 0.f );
+                if( beginFrame < nodeInFrame && endFrame > nodeInFrame )
+                {
+                    __update_movie_composition_node_matrix( node, _composition, _compositionData, nodeFrameId, AE_FALSE, 0.f, AE_NULLPTR );
+
+                    aeMovieCompositionEventCallbackData callbackData;
+                    callbackData.index = enumerator;
+                    callbackData.element_userdata = __get_movie_composition_node_cold( _composition, node )->element_userdata;
+                    callbackData.name = node_layer->name;
+                    callbackData.immutable_matrix = node->immutable_matrix;
+                    callbackData.matrix = node->matrix;
+                    callbackData.immutable_color = node->immutable_color;
+                    callbackData.color = node->color;
+                    callbackData.opacity = node->opacity * node->extra_opacity;
+                    callbackData.begin = AE_TRUE;
+
+                    (*_composition->providers.composition_event)(&callbackData, _composition->provider_userdata);
+                }
 
-                __update_movie_composition_node_state( _composition, _animation, node, enumerator, AE_TRUE, AE_TRUE, 0.f, composition_interpolate );
+                if( beginFrame < nodeOutFrame && endFrame > nodeOutFrame )
+                {
+                    __update_movie_composition_node_matrix( node, _composition, _compositionData, nodeFrameId, AE_FALSE, 0.f, AE_NULLPTR );
+
+                    aeMovieCompositionEventCallbackData callbackData;
+                    callbackData.index = enumerator;
+                    callbackData.element_userdata = __get_movie_composition_node_cold( _composition, node )->element_userdata;
+                    callbackData.name = node_layer->name;
+                    callbackData.immutable_matrix = node->immutable_matrix;
+                    callbackData.matrix = node->matrix;
+                    callbackData.immutable_color = node->immutable_color;
+                    callbackData.color = node->color;
+                    callbackData.opacity = node->opacity * node->extra_opacity;
+                    callbackData.begin = AE_FALSE;
+
+                    (*_composition->providers.composition_event)(&callbackData, _composition->provider_userdata);
+                }
 
-                node->active = AE_TRUE;
-            }
-            else
-            {
-                node->active = AE_FALSE;
+                continue;
             }
 
-            continue;
-        }
-        else if( nodeInFrame > beginFrame && nodeOutFrame < endFrame )
-        {
-            if( node->incessantly == AE_TRUE || node_layer_type == AE_MOVIE_LAYER_TYPE_SUB_MOVIE )
+            if( nodeInFrame > endFrame || nodeOutFrame < beginFrame )
             {
-                node->current_time = 0.f;
-                node->current_frame = 0U;
-                node->current_frame_t = 0.f;
+                if( node->incessantly == AE_TRUE || node_layer_type == AE_MOVIE_LAYER_TYPE_SUB_MOVIE )
+                {
+                    node->current_time = node_stretch_time;
+                    node->current_frame = nodeFrameId;
+                    node->current_frame_t = 0.f;
 
-                __update_movie_composition_node_matrix( node, _composition, _compositionData, nodeFrameId, AE_FALSE, 0.f );
+                    __update_movie_composition_node_matrix( node, _composition, _compositionData, 0, AE_FALSE, 0.f, node_local );
 
-                __update_movie_composition_node_state( _composition, _animation, node, enumerator, AE_TRUE, AE_TRUE, node_stretch_time, composition_interpolate );
+                    __update_movie_composition_node_state( _composition, _animation, node, enumerator, AE_TRUE, AE_TRUE, 0.f, composition_interpolate );
 
-                node->active = AE_TRUE;
+                    node->active = AE_TRUE;
+                }
+                else
+                {
+                    node->active = AE_FALSE;
+                }
+
+                continue;
             }
-            else
+            else if( nodeInFrame > beginFrame && nodeOutFrame < endFrame )
             {
-                node->active = AE_FALSE;
-            }
+                if( node->incessantly == AE_TRUE || node_layer_type == AE_MOVIE_LAYER_TYPE_SUB_MOVIE )
+                {
+                    node->current_time = 0.f;
+                    node->current_frame = 0U;
+                    node->current_frame_t = 0.f;
 
-            continue;
-        }
+                    __update_movie_composition_node_matrix( node, _composition, _compositionData, nodeFrameId, AE_FALSE, 0.f, node_local );
 
-        node->current_time = node_stretch_time;
-        node->current_frame = nodeFrameId;
+                    __update_movie_composition_node_state( _composition, _animation, node, enumerator, AE_TRUE, AE_TRUE, node_stretch_time, composition_interpolate );
 
-        ae_bool_t node_loop = ((animation_loop == AE_TRUE && animation_interrupt == AE_FALSE && loop_begin_time >= node->in_time && node->out_time >= loop_end_time) || node_layer->incessantly == AE_TRUE);
+                    node->active = AE_TRUE;
+                }
+                else
+                {
+                    node->active = AE_FALSE;
+                }
 
-        if( beginFrame < nodeInFrame && endFrame >= nodeInFrame && endFrame < nodeOutFrame )
-        {
-            node->active = AE_TRUE;
+                continue;
+            }
+
+            node->current_time = node_stretch_time;
+            node->current_frame = nodeFrameId;
 
-            ae_bool_t node_interpolate = composition_interpolate ? ((endFrame + 1) < nodeOutFrame) : AE_FALSE;
+            ae_bool_t node_loop = ((animation_loop == AE_TRUE && animation_interrupt == AE_FALSE && loop_begin_time >= node->in_time && node->out_time >= loop_end_time) || node_layer->incessantly == AE_TRUE);
 
-            if( node_interpolate == AE_TRUE )
+            if( beginFrame < nodeInFrame && endFrame >= nodeInFrame && endFrame < nodeOutFrame )
             {
-                node->current_frame_t = ae_fractional_f( node_frame_time_for_fractional );
-            }
+                node->active = AE_TRUE;
 
-            __update_node( _composition, _compositionData, _animation, node, enumerator, animation_time, node->current_frame, node->current_frame_t, node_loop, node_interpolate, AE_TRUE );
-        }
-        else if( endFrame >= nodeOutFrame && beginFrame >= nodeInFrame && beginFrame < nodeOutFrame )
-        {
-            ae_bool_t node_active = (node_loop == AE_TRUE || node->incessantly == AE_TRUE) ? AE_TRUE : AE_FALSE;
+                ae_bool_t node_interpolate = composition_interpolate ? ((endFrame + 1) < nodeOutFrame) : AE_FALSE;
 
-            node->active = node_active;
+                if( node_interpolate == AE_TRUE )
+                {
+                    node->current_frame_t = ae_fractional_f( node_frame_time_for_fractional );
+                }
 
-            ae_uint32_t frameEnd = nodeOutFrame - nodeInFrame;
+                __update_node( _composition, _compositionData, _animation, node, enumerator, animation_time, node->current_frame, node->current_frame_t, node_loop, node_interpolate, AE_TRUE, node_local );
+            }
+            else if( endFrame >= nodeOutFrame && beginFrame >= nodeInFrame && beginFrame < nodeOutFrame )
+            {
+                ae_bool_t node_active = (node_loop == AE_TRUE || node->incessantly == AE_TRUE) ? AE_TRUE : AE_FALSE;
 
-            node->current_frame = frameEnd;
-            node->current_frame_t = 0.f;
+                node->active = node_active;
 
-            ae_bool_t begin = (node->incessantly == AE_TRUE) ? AE_TRUE : AE_FALSE;
+                ae_uint32_t frameEnd = nodeOutFrame - nodeInFrame;
 
-            __update_node( _composition, _compositionData, _animation, node, enumerator, animation_time, node->current_frame, node->current_frame_t, node_loop, AE_FALSE, begin );
-        }
-        else if( beginFrame >= nodeInFrame && endFrame >= nodeInFrame && endFrame < nodeOutFrame )
-        {
-            node->active = AE_TRUE;
+                node->current_frame = frameEnd;
+                node->current_frame_t = 0.f;
 
-            ae_bool_t node_interpolate = (composition_interpolate == AE_TRUE) ? (endFrame + 1) < nodeOutFrame : AE_FALSE;
+                ae_bool_t begin = (node->incessantly == AE_TRUE) ? AE_TRUE : AE_FALSE;
 
-            if( node_interpolate == AE_TRUE )
-            {
-                node->current_frame_t = ae_fractional_f( node_frame_time_for_fractional );
+                __update_node( _composition, _compositionData, _animation, node, enumerator, animation_time, node->current_frame, node->current_frame_t, node_loop, AE_FALSE, begin, node_local );
             }
+            else if( beginFrame >= nodeInFrame && endFrame >= nodeInFrame && endFrame < nodeOutFrame )
+            {
+                node->active = AE_TRUE;
+
+                ae_bool_t node_interpolate = (composition_interpolate == AE_TRUE) ? (endFrame + 1) < nodeOutFrame : AE_FALSE;
+
+                if( node_interpolate == AE_TRUE )
+                {
+                    node->current_frame_t = ae_fractional_f( node_frame_time_for_fractional );
+                }
 
-            ae_bool_t begin = (_end == AE_TRUE) ? AE_FALSE : AE_TRUE;
+                ae_bool_t begin = (_end == AE_TRUE) ? AE_FALSE : AE_TRUE;
 
-            __update_node( _composition, _compositionData, _animation, node, enumerator, animation_time, node->current_frame, node->current_frame_t, node_loop, node_interpolate, begin );
+                __update_node( _composition, _compositionData, _animation, node, enumerator, animation_time, node->current_frame, node->current_frame_t, node_loop, node_interpolate, begin, node_local );
+            }
         }
     }
+
+    __update_movie_composition_interval_active( _composition, _subcomposition, visit_nodes, visit_count );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __update_movie_camera( const aeMovieComposition * _composition, const aeMovieCompositionAnimation * _animation )
+AE_INTERNAL ae_void_t __update_movie_camera( const aeMovieComposition * _composition, aeMovieCompositionAnimation * _animation )
 {
     if( _composition->camera_userdata == AE_NULLPTR )
     {
@@ -3302,46 +5165,60 @@ AE_INTERNAL ae_void_t __update_movie_camera( const aeMovieComposition * _composi
 
     ae_bool_t composition_interpolate = _composition->interpolate;
 
-    aeMovieCameraUpdateCallbackData callbackData;
-    callbackData.camera_userdata = _composition->camera_userdata;
-    callbackData.name = camera->name;
-
     ae_float_t frameDurationInv = composition_data->frameDurationInv;
 
     ae_float_t frame_time = _animation->time * frameDurationInv;
 
     ae_uint32_t frame_id = (ae_uint32_t)frame_time;
+    ae_float_t frame_t = 0.f;
+
+    ae_uint32_t duration_frame = composition_data->duration_frame;
 
-    if( composition_interpolate == AE_FALSE )
+    if( duration_frame != 0U && frame_id + 1U >= duration_frame )
     {
-        ae_movie_make_camera_transformation( callbackData.target, callbackData.position, callbackData.quaternion, composition_data->camera, frame_id, AE_FALSE, 0.f );
+        frame_id = duration_frame - 1U;
+        composition_interpolate = AE_FALSE;
     }
-    else
+
+    if( composition_interpolate == AE_TRUE )
     {
-        ae_float_t t = ae_fractional_f( frame_time );
+        frame_t = ae_fractional_f( frame_time );
+    }
 
-        ae_movie_make_camera_transformation( callbackData.target, callbackData.position, callbackData.quaternion, composition_data->camera, frame_id, AE_TRUE, t );
+    if( _animation->camera_sampled == AE_TRUE && _animation->camera_frame == frame_id && _animation->camera_t == frame_t )
+    {
+        return;
     }
 
+    _animation->camera_sampled = AE_TRUE;
+    _animation->camera_frame = frame_id;
+    _animation->camera_t = frame_t;
+
+    aeMovieCameraUpdateCallbackData callbackData;
+    callbackData.camera_userdata = _composition->camera_userdata;
+    callbackData.name = camera->name;
+
+    ae_movie_make_camera_transformation( callbackData.target, callbackData.position, callbackData.quaternion, camera, frame_id, composition_interpolate, frame_t );
+
     (*_composition->providers.camera_update)(&callbackData, _composition->provider_userdata);
 }
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __skip_movie_composition_node( const aeMovieComposition * _composition, const aeMovieCompositionData * _compositionData, aeMovieCompositionAnimation * _animation, const aeMovieSubComposition * _subcomposition, ae_float_t _beginTime, ae_float_t _endTime )
 {
-    ae_uint32_t enumerator = 0U;
+    ae_uint32_t update_node_count;
+    aeMovieNode ** update_nodes = __get_movie_composition_update_nodes( _composition, _subcomposition, &update_node_count );
 
-    aeMovieNode ** it_node = _composition->update_nodes;
-    aeMovieNode ** it_node_end = _composition->update_nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node, ++enumerator )
+    const ae_uint32_t * it_enumerator = _composition->update_node_enumerators + (update_nodes - _composition->update_nodes);
+
+    aeMovieNode ** it_node = update_nodes;
+    aeMovieNode ** it_node_end = update_nodes + update_node_count;
+    for( ; it_node != it_node_end; ++it_node, ++it_enumerator )
     {
         aeMovieNode * node = *it_node;
 
-        if( node->ignore == AE_TRUE )
-        {
-            continue;
-        }
+        ae_uint32_t enumerator = *it_enumerator;
 
-        if( node->subcomposition != _subcomposition )
+        if( node->ignore == AE_TRUE )
         {
             continue;
         }
@@ -3405,7 +5282,7 @@ AE_INTERNAL ae_void_t __skip_movie_composition_node( const aeMovieComposition *
                     node->current_frame_t = ae_fractional_f( frame_time );
                 }
 
-                __update_node( _composition, _compositionData, _animation, node, enumerator, _endTime, node->current_frame, node->current_frame_t, AE_FALSE, node_interpolate, AE_FALSE );
+                __update_node( _composition, _compositionData, _animation, node, enumerator, _endTime, node->current_frame, node->current_frame_t, AE_FALSE, node_interpolate, AE_FALSE, AE_NULLPTR );
             }
             else if( beginFrame >= indexIn && endFrame >= indexIn && endFrame < indexOut )
             {
@@ -3848,223 +5725,602 @@ ae_void_t ae_get_movie_composition_in_out_loop( const aeMovieComposition * _comp
     *_out = AE_TIME_OUTSCALE( work_end );
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_set_movie_composition_slot_userdata( const aeMovieComposition * _composition, const ae_char_t * _name, ae_userdata_t _userdata )
+typedef struct aeMovieCompositionNameIterator
+{
+    const ae_char_t * name;
+    ae_uint32_t hash;
+
+    const aeMovieCompositionNameEntry * it_entry;
+    const aeMovieCompositionNameEntry * it_entry_end;
+} aeMovieCompositionNameIterator;
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __begin_movie_composition_name_iterator( const aeMovieComposition * _composition, const ae_char_t * _name, aeMovieCompositionNameIterator * _iterator )
+{
+    const aeMovieCompositionNameIndex * name_index = &_composition->composition_data->name_index;
+
+    ae_uint32_t hash = __hash_movie_layer_name( _composition->movie_data->instance, _name );
+
+    _iterator->name = _name;
+    _iterator->hash = hash;
+
+    if( name_index->entries == AE_NULLPTR )
+    {
+        _iterator->it_entry = AE_NULLPTR;
+        _iterator->it_entry_end = AE_NULLPTR;
+
+        return;
+    }
+
+    ae_uint32_t bucket = hash & name_index->bucket_mask;
+
+    _iterator->it_entry = name_index->entries + name_index->buckets[bucket];
+    _iterator->it_entry_end = name_index->entries + name_index->buckets[bucket + 1U];
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const aeMovieCompositionNameEntry * __next_movie_composition_name_entry( const aeMovieComposition * _composition, aeMovieCompositionNameIterator * _iterator, aeMovieLayerTypeEnum _type )
 {
     const aeMovieInstance * instance = _composition->movie_data->instance;
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    for( ; _iterator->it_entry != _iterator->it_entry_end; ++_iterator->it_entry )
     {
-        aeMovieNode * node = it_node;
+        const aeMovieCompositionNameEntry * entry = _iterator->it_entry;
 
-        const aeMovieLayerData * layer = node->layer_data;
+        if( entry->hash != _iterator->hash )
+        {
+            continue;
+        }
 
-        if( layer->type != AE_MOVIE_LAYER_TYPE_SLOT )
+        const aeMovieLayerData * layer = _composition->nodes[entry->node_index].layer_data;
+
+        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
         {
             continue;
         }
 
-        if( AE_STRNCMP( instance, layer->name, _name, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
+        if( AE_STRNCMP( instance, layer->name, _iterator->name, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
         {
             continue;
         }
 
-        node->element_userdata = _userdata;
+        ++_iterator->it_entry;
 
-        return AE_TRUE;
+        return entry;
     }
 
-    return AE_FALSE;
+    return AE_NULLPTR;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_set_movie_composition_slot_userdata( const aeMovieComposition * _composition, const ae_char_t * _name, ae_userdata_t _userdata )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _name, &iterator );
+
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_SLOT );
+
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    aeMovieNodeCold * node_cold = _composition->node_colds + entry->node_index;
+
+    node_cold->element_userdata = _userdata;
+
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
 ae_userdata_t ae_get_movie_composition_slot_userdata( const aeMovieComposition * _composition, const ae_char_t * _name )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _name, &iterator );
 
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_SLOT );
+
+    if( entry == AE_NULLPTR )
     {
-        const aeMovieNode * node = it_node;
+        return AE_USERDATA_NULL;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    const aeMovieNodeCold * node_cold = _composition->node_colds + entry->node_index;
+
+    return node_cold->element_userdata;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_has_movie_composition_slot( const aeMovieComposition * _composition, const ae_char_t * _name )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _name, &iterator );
+
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_SLOT );
+
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_userdata_t ae_remove_movie_composition_slot( const aeMovieComposition * _composition, const ae_char_t * _name )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _name, &iterator );
+
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_SLOT );
+
+    if( entry == AE_NULLPTR )
+    {
+        return AE_USERDATA_NULL;
+    }
+
+    aeMovieNodeCold * node_cold = _composition->node_colds + entry->node_index;
+
+    ae_userdata_t prev_element_userdata = node_cold->element_userdata;
+
+    node_cold->element_userdata = AE_NULLPTR;
+
+    return prev_element_userdata;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_userdata_t ae_get_movie_composition_camera_userdata( const aeMovieComposition * _composition )
+{
+    return _composition->camera_userdata;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_get_movie_composition_socket( const aeMovieComposition * _composition, const ae_char_t * _slotName, const ae_polygon_t ** _polygon )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _slotName, &iterator );
+
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_SOCKET );
+
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    const aeMovieNode * node = _composition->nodes + entry->node_index;
+
+    const aeMovieLayerData * layer = node->layer_data;
+
+    const aeMovieLayerExtensionPolygon * polygon = layer->extensions->polygon;
+
+    if( polygon->immutable == AE_TRUE )
+    {
+        *_polygon = &polygon->immutable_polygon;
+    }
+    else
+    {
+        ae_float_t t;
+        ae_uint32_t frame = __compute_movie_node_frame( node, &t );
+
+        *_polygon = polygon->polygons + frame;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const aeMovieNode * __next_movie_composition_render_node( const aeMovieComposition * _composition, ae_uint32_t * _iterator )
+{
+    ae_uint32_t render_node_index = *_iterator;
+    ae_uint32_t render_node_max_count = _composition->node_count;
+
+    ae_uint32_t iterator = render_node_index;
+    for( ; iterator != render_node_max_count; ++iterator )
+    {
+        const aeMovieNode * node = _composition->nodes + iterator;
+
+        if( node->active == AE_FALSE )
+        {
+            continue;
+        }
+
+        if( node->enable == AE_FALSE )
+        {
+            continue;
+        }
+
+        if( node->opacity * node->extra_opacity < 0.00390625f )
+        {
+            continue;
+        }
+
+        if( node->track_matte_node != AE_NULLPTR && node->track_matte_node->active == AE_FALSE )
+        {
+            continue;
+        }
 
-        if( layer->type != AE_MOVIE_LAYER_TYPE_SLOT )
+        if( node->subcomposition != AE_NULLPTR && node->subcomposition->animation->enable == AE_FALSE )
         {
             continue;
         }
 
-        if( AE_STRNCMP( instance, layer->name, _name, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
+        const aeMovieLayerData * layer = node->layer_data;
+
+        if( layer->renderable == AE_FALSE )
         {
             continue;
         }
 
-        return node->element_userdata;
+        *_iterator = iterator + 1U;
+
+        return node;
     }
 
-    return AE_USERDATA_NULL;
+    return AE_NULLPTR;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_has_movie_composition_slot( const aeMovieComposition * _composition, const ae_char_t * _name )
+ae_bool_t ae_compute_movie_mesh( const aeMovieComposition * _composition, ae_uint32_t * _iterator, aeMovieRenderMesh * _render )
+{
+    const aeMovieNode * node = __next_movie_composition_render_node( _composition, _iterator );
+
+    if( node == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    __compute_movie_render_mesh( _composition, node, _render, _composition->interpolate, AE_FALSE );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_compute_movie_mesh_ex( const aeMovieComposition * _composition, ae_uint32_t * _iterator, aeMovieRenderMeshEx * _render, ae_movie_render_mesh_sink_t _sink, ae_userdata_t _ud )
 {
+    const aeMovieNode * node = __next_movie_composition_render_node( _composition, _iterator );
+
+    if( node == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    aeMovieRenderGeometry geometry;
+    __compute_movie_render_mesh_state( _composition, node, _render, AE_FALSE, &geometry );
+
+    if( _render->vertexCount == 0 || _sink == (ae_movie_render_mesh_sink_t)AE_FUNCTION_NULL )
+    {
+        return AE_TRUE;
+    }
+
+    ae_vector3_t * position = AE_NULLPTR;
+    ae_vector2_t * uv = AE_NULLPTR;
+
+    if( (*_sink)(_render, &position, &uv, _ud) == AE_FALSE )
+    {
+        return AE_TRUE;
+    }
+
     const aeMovieInstance * instance = _composition->movie_data->instance;
 
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    aeMovieRenderVertexStream stream;
+    __make_movie_render_vertex_stream( &stream, position, uv );
+
+    __make_movie_render_geometry_vertices( instance, &geometry, node, _composition->interpolate, &stream );
+
+    _render->position = position;
+    _render->uv = uv;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_compute_movie_mesh_interleaved( const aeMovieComposition * _composition, ae_uint32_t * _iterator, aeMovieRenderMeshEx * _render, const aeMovieRenderVertexLayout * _layout, ae_movie_render_vertex_buffer_sink_t _sink, ae_userdata_t _ud )
+{
+    //vertex fields are stored as floats and a 32-bit colour, see aeMovieRenderVertexLayout
+    AE_MOVIE_ASSERTION_RESULT( ((_layout->stride | _layout->position_offset | _layout->uv_offset | _layout->color_offset) & 3U) == 0U, AE_FALSE );
+
+    const aeMovieNode * node = __next_movie_composition_render_node( _composition, _iterator );
+
+    if( node == AE_NULLPTR )
     {
-        const aeMovieNode * node = it_node;
+        return AE_FALSE;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    aeMovieRenderGeometry geometry;
+    __compute_movie_render_mesh_state( _composition, node, _render, AE_FALSE, &geometry );
 
-        if( layer->type != AE_MOVIE_LAYER_TYPE_SLOT )
-        {
-            continue;
-        }
+    if( _render->vertexCount == 0 || _sink == (ae_movie_render_vertex_buffer_sink_t)AE_FUNCTION_NULL )
+    {
+        return AE_TRUE;
+    }
+
+    ae_voidptr_t vertices = AE_NULLPTR;
+
+    if( (*_sink)(_render, &vertices, _ud) == AE_FALSE )
+    {
+        return AE_TRUE;
+    }
+
+    AE_MOVIE_ASSERTION_RESULT( ((ae_size_t)vertices & 3U) == 0U, AE_FALSE );
+
+    ae_uint8_t * buffer = (ae_uint8_t *)vertices;
+
+    const aeMovieInstance * instance = _composition->movie_data->instance;
+
+    aeMovieRenderVertexStream stream;
+    stream.position = buffer + _layout->position_offset;
+    stream.position_stride = _layout->stride;
+    stream.uv = buffer + _layout->uv_offset;
+    stream.uv_stride = _layout->stride;
+
+    __make_movie_render_geometry_vertices( instance, &geometry, node, _composition->interpolate, &stream );
+
+    if( _layout->color_format != AE_MOVIE_RENDER_COLOR_NONE )
+    {
+        ae_uint32_t color = __make_movie_render_vertex_color( &_render->color, _render->opacity, _layout->color_format, _layout->color_premultiplied );
+
+        ae_uint8_t * color_vertex = buffer + _layout->color_offset;
 
-        if( AE_STRNCMP( instance, layer->name, _name, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
+        ae_uint32_t vertex_index = 0;
+        for( ; vertex_index != _render->vertexCount; ++vertex_index )
         {
-            continue;
+            *(ae_uint32_t *)color_vertex = color;
+
+            color_vertex += _layout->stride;
         }
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_initialize_movie_render_meshes( const aeMovieInstance * _instance, aeMovieRenderMeshes * _meshes )
+{
+    _meshes->instance = _instance;
+
+    _meshes->positions = AE_NULLPTR;
+    _meshes->uvs = AE_NULLPTR;
+    _meshes->vertex_count = 0;
+    _meshes->vertex_capacity = 0;
+
+    _meshes->indices = AE_NULLPTR;
+    _meshes->index_count = 0;
+    _meshes->index_capacity = 0;
+
+    _meshes->draws = AE_NULLPTR;
+    _meshes->draw_count = 0;
+    _meshes->draw_capacity = 0;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_finalize_movie_render_meshes( aeMovieRenderMeshes * _meshes )
+{
+    const aeMovieInstance * instance = _meshes->instance;
+
+    if( _meshes->positions != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _meshes->positions );
+        AE_DELETEN( instance, _meshes->uvs );
+    }
+
+    if( _meshes->indices != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _meshes->indices );
+    }
+
+    if( _meshes->draws != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _meshes->draws );
+    }
+
+    ae_initialize_movie_render_meshes( instance, _meshes );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __get_movie_render_meshes_grow_capacity( ae_uint32_t _capacity, ae_uint32_t _count )
+{
+    ae_uint32_t capacity = _capacity * 2U;
+
+    if( capacity < AE_MOVIE_RENDER_MESHES_MIN_CAPACITY )
+    {
+        capacity = AE_MOVIE_RENDER_MESHES_MIN_CAPACITY;
+    }
+
+    if( capacity < _count )
+    {
+        capacity = _count;
+    }
+
+    return capacity;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __reserve_movie_render_meshes_vertices( aeMovieRenderMeshes * _meshes, ae_uint32_t _count )
+{
+    if( _count <= _meshes->vertex_capacity )
+    {
+        return AE_TRUE;
+    }
+
+    const aeMovieInstance * instance = _meshes->instance;
+
+    ae_uint32_t capacity = __get_movie_render_meshes_grow_capacity( _meshes->vertex_capacity, _count );
+
+    ae_vector3_t * positions = AE_NEWN( instance, ae_vector3_t, capacity );
+
+    AE_MOVIE_PANIC_MEMORY( positions, AE_FALSE );
+
+    ae_vector2_t * uvs = AE_NEWN( instance, ae_vector2_t, capacity );
+
+    if( uvs == AE_NULLPTR )
+    {
+        AE_DELETEN( instance, positions );
+
+        return AE_FALSE;
+    }
+
+    ae_uint32_t index = 0;
+    for( ; index != _meshes->vertex_count; ++index )
+    {
+        positions[index][0] = _meshes->positions[index][0];
+        positions[index][1] = _meshes->positions[index][1];
+        positions[index][2] = _meshes->positions[index][2];
+
+        uvs[index][0] = _meshes->uvs[index][0];
+        uvs[index][1] = _meshes->uvs[index][1];
+    }
 
-        return AE_TRUE;
+    if( _meshes->positions != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _meshes->positions );
+        AE_DELETEN( instance, _meshes->uvs );
     }
 
-    return AE_FALSE;
+    _meshes->positions = positions;
+    _meshes->uvs = uvs;
+    _meshes->vertex_capacity = capacity;
+
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_userdata_t ae_remove_movie_composition_slot( const aeMovieComposition * _composition, const ae_char_t * _name )
+AE_INTERNAL ae_bool_t __reserve_movie_render_meshes_indices( aeMovieRenderMeshes * _meshes, ae_uint32_t _count )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    if( _count <= _meshes->index_capacity )
     {
-        aeMovieNode * node = it_node;
+        return AE_TRUE;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    const aeMovieInstance * instance = _meshes->instance;
 
-        if( layer->type != AE_MOVIE_LAYER_TYPE_SLOT )
-        {
-            continue;
-        }
+    ae_uint32_t capacity = __get_movie_render_meshes_grow_capacity( _meshes->index_capacity, _count );
 
-        if( AE_STRNCMP( instance, layer->name, _name, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    ae_uint16_t * indices = AE_NEWN( instance, ae_uint16_t, capacity );
 
-        ae_userdata_t prev_element_userdata = node->element_userdata;
+    AE_MOVIE_PANIC_MEMORY( indices, AE_FALSE );
 
-        node->element_userdata = AE_NULLPTR;
+    ae_uint32_t index = 0;
+    for( ; index != _meshes->index_count; ++index )
+    {
+        indices[index] = _meshes->indices[index];
+    }
 
-        return prev_element_userdata;
+    if( _meshes->indices != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _meshes->indices );
     }
 
-    return AE_USERDATA_NULL;
-}
-//////////////////////////////////////////////////////////////////////////
-ae_userdata_t ae_get_movie_composition_camera_userdata( const aeMovieComposition * _composition )
-{
-    return _composition->camera_userdata;
+    _meshes->indices = indices;
+    _meshes->index_capacity = capacity;
+
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_get_movie_composition_socket( const aeMovieComposition * _composition, const ae_char_t * _slotName, const ae_polygon_t ** _polygon )
+AE_INTERNAL ae_bool_t __reserve_movie_render_meshes_draws( aeMovieRenderMeshes * _meshes, ae_uint32_t _count )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    if( _count <= _meshes->draw_capacity )
     {
-        const aeMovieNode * node = it_node;
-
-        const aeMovieLayerData * layer = node->layer_data;
+        return AE_TRUE;
+    }
 
-        if( layer->type != AE_MOVIE_LAYER_TYPE_SOCKET )
-        {
-            continue;
-        }
+    const aeMovieInstance * instance = _meshes->instance;
 
-        if( AE_STRNCMP( instance, layer->name, _slotName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    ae_uint32_t capacity = __get_movie_render_meshes_grow_capacity( _meshes->draw_capacity, _count );
 
-        const aeMovieLayerExtensionPolygon * polygon = layer->extensions->polygon;
+    aeMovieRenderDraw * draws = AE_NEWN( instance, aeMovieRenderDraw, capacity );
 
-        if( polygon->immutable == AE_TRUE )
-        {
-            *_polygon = &polygon->immutable_polygon;
-        }
-        else
-        {
-            ae_float_t t;
-            ae_uint32_t frame = __compute_movie_node_frame( node, &t );
+    AE_MOVIE_PANIC_MEMORY( draws, AE_FALSE );
 
-            *_polygon = polygon->polygons + frame;
-        }
+    ae_uint32_t index = 0;
+    for( ; index != _meshes->draw_count; ++index )
+    {
+        draws[index] = _meshes->draws[index];
+    }
 
-        return AE_TRUE;
+    if( _meshes->draws != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _meshes->draws );
     }
 
-    return AE_FALSE;
+    _meshes->draws = draws;
+    _meshes->draw_capacity = capacity;
+
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_compute_movie_mesh( const aeMovieComposition * _composition, ae_uint32_t * _iterator, aeMovieRenderMesh * _render )
+ae_bool_t ae_compute_movie_meshes( const aeMovieComposition * _composition, aeMovieRenderMeshes * _meshes )
 {
+    const aeMovieInstance * instance = _composition->movie_data->instance;
     ae_bool_t composition_interpolate = _composition->interpolate;
 
-    ae_uint32_t render_node_index = *_iterator;
-    ae_uint32_t render_node_max_count = _composition->node_count;
+    _meshes->vertex_count = 0;
+    _meshes->index_count = 0;
+    _meshes->draw_count = 0;
 
-    ae_uint32_t iterator = render_node_index;
-    for( ; iterator != render_node_max_count; ++iterator )
+    ae_uint32_t vertex_base = 0;
+
+    ae_uint32_t iterator = 0;
+
+    const aeMovieNode * node;
+    while( (node = __next_movie_composition_render_node( _composition, &iterator )) != AE_NULLPTR )
     {
-        const aeMovieNode * node = _composition->nodes + iterator;
+        aeMovieRenderMeshEx render;
+        aeMovieRenderGeometry geometry;
+        __compute_movie_render_mesh_state( _composition, node, &render, AE_FALSE, &geometry );
 
-        if( node->active == AE_FALSE )
+        ae_uint32_t vertex_offset = _meshes->vertex_count;
+        ae_uint32_t index_offset = _meshes->index_count;
+
+        if( vertex_offset + render.vertexCount - vertex_base > AE_MOVIE_RENDER_MESHES_MAX_INDEXED_VERTICES )
         {
-            continue;
+            vertex_base = vertex_offset;
         }
 
-        if( node->enable == AE_FALSE )
+        if( __reserve_movie_render_meshes_vertices( _meshes, vertex_offset + render.vertexCount ) == AE_FALSE )
         {
-            continue;
+            return AE_FALSE;
         }
 
-        if( node->opacity * node->extra_opacity < 0.00390625f )
+        if( __reserve_movie_render_meshes_indices( _meshes, index_offset + render.indexCount ) == AE_FALSE )
         {
-            continue;
+            return AE_FALSE;
         }
 
-        if( node->track_matte_node != AE_NULLPTR && node->track_matte_node->active == AE_FALSE )
+        if( __reserve_movie_render_meshes_draws( _meshes, _meshes->draw_count + 1 ) == AE_FALSE )
         {
-            continue;
+            return AE_FALSE;
         }
 
-        if( node->subcomposition != AE_NULLPTR && node->subcomposition->animation->enable == AE_FALSE )
+        if( render.vertexCount != 0 )
         {
-            continue;
-        }
+            aeMovieRenderVertexStream stream;
+            __make_movie_render_vertex_stream( &stream, _meshes->positions + vertex_offset, _meshes->uvs + vertex_offset );
 
-        const aeMovieLayerData * layer = node->layer_data;
+            __make_movie_render_geometry_vertices( instance, &geometry, node, composition_interpolate, &stream );
 
-        if( layer->renderable == AE_FALSE )
-        {
-            continue;
-        }
+            ae_uint16_t rebase = (ae_uint16_t)(vertex_offset - vertex_base);
 
-        *_iterator = iterator + 1U;
+            const ae_uint16_t * it_index = render.indices;
+            const ae_uint16_t * it_index_end = render.indices + render.indexCount;
 
-        __compute_movie_render_mesh( _composition, node, _render, composition_interpolate, AE_FALSE );
+            ae_uint16_t * it_packed = _meshes->indices + index_offset;
 
-        return AE_TRUE;
+            for( ; it_index != it_index_end; ++it_index, ++it_packed )
+            {
+                *it_packed = (ae_uint16_t)(*it_index + rebase);
+            }
+        }
+
+        aeMovieRenderDraw * draw = _meshes->draws + _meshes->draw_count;
+
+        draw->layer_type = render.layer_type;
+        draw->blend_mode = render.blend_mode;
+        draw->resource = render.resource;
+        draw->vertex_base = vertex_base;
+        draw->vertex_offset = vertex_offset;
+        draw->vertex_count = render.vertexCount;
+        draw->index_offset = index_offset;
+        draw->index_count = render.indexCount;
+        draw->uv_cache_userdata = render.uv_cache_userdata;
+        draw->color = render.color;
+        draw->opacity = render.opacity;
+        draw->camera_userdata = render.camera_userdata;
+        draw->track_matte_mode = render.track_matte_mode;
+        draw->track_matte_userdata = render.track_matte_userdata;
+        draw->viewport = render.viewport;
+        draw->shader_userdata = render.shader_userdata;
+        draw->element_userdata = render.element_userdata;
+        draw->geometry_revision = render.geometry_revision;
+
+        _meshes->vertex_count += render.vertexCount;
+        _meshes->index_count += render.indexCount;
+        _meshes->draw_count += 1;
     }
 
-    return AE_FALSE;
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
 ae_uint32_t ae_get_movie_render_mesh_count( const aeMovieComposition * _composition )
@@ -4103,116 +6359,69 @@ ae_uint32_t ae_get_movie_render_mesh_count( const aeMovieComposition * _composit
 //////////////////////////////////////////////////////////////////////////
 ae_bool_t ae_has_movie_composition_node( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
-    {
-        const aeMovieNode * node = it_node;
-
-        const aeMovieLayerData * layer = node->layer_data;
-
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
 
-        return AE_TRUE;
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
     }
 
-    return AE_FALSE;
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
 ae_bool_t ae_get_movie_composition_node_in_out_time( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_time_t * _in, ae_time_t * _out )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
-    {
-        const aeMovieNode * node = it_node;
-
-        const aeMovieLayerData * layer = node->layer_data;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
 
-        *_in = AE_TIME_OUTSCALE( node->in_time );
-        *_out = AE_TIME_OUTSCALE( node->out_time );
+    const aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        return AE_TRUE;
-    }
+    *_in = AE_TIME_OUTSCALE( node->in_time );
+    *_out = AE_TIME_OUTSCALE( node->out_time );
 
-    return AE_FALSE;
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
 ae_bool_t ae_has_movie_composition_node_option( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_option_t _option, ae_bool_t * _result )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
-    {
-        const aeMovieNode * node = it_node;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-        const aeMovieLayerData * layer = node->layer_data;
-
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
 
-        ae_bool_t result = ae_has_movie_layer_data_option( layer, _option );
+    const aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        *_result = result;
+    ae_bool_t result = ae_has_movie_layer_data_option( node->layer_data, _option );
 
-        return AE_TRUE;
-    }
+    *_result = result;
 
-    return AE_FALSE;
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
 ae_void_t ae_set_movie_composition_nodes_extra_opacity( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_float_t _opacity )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
+    for( ; entry != AE_NULLPTR; entry = __next_movie_composition_name_entry( _composition, &iterator, _type ) )
     {
-        aeMovieNode * node = it_node;
-
-        const aeMovieLayerData * layer = node->layer_data;
-
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
-
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+        aeMovieNode * node = _composition->nodes + entry->node_index;
 
         node->extra_opacity = _opacity;
     }
@@ -4220,20 +6429,13 @@ ae_void_t ae_set_movie_composition_nodes_extra_opacity( const aeMovieComposition
 //////////////////////////////////////////////////////////////////////////
 ae_void_t ae_set_movie_composition_nodes_extra_opacity_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_float_t _opacity )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE );
+    for( ; entry != AE_NULLPTR; entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE ) )
     {
-        aeMovieNode * node = it_node;
-
-        const aeMovieLayerData * layer = node->layer_data;
-
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+        aeMovieNode * node = _composition->nodes + entry->node_index;
 
         node->extra_opacity = _opacity;
     }
@@ -4241,314 +6443,419 @@ ae_void_t ae_set_movie_composition_nodes_extra_opacity_any( const aeMovieComposi
 //////////////////////////////////////////////////////////////////////////
 ae_bool_t ae_set_movie_composition_node_extra_opacity( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_float_t _opacity )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
+
+    if( entry == AE_NULLPTR )
     {
-        aeMovieNode * node = it_node;
+        return AE_FALSE;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    node->extra_opacity = _opacity;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_get_movie_composition_node_extra_opacity( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_float_t * _opactity )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-        node->extra_opacity = _opacity;
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
 
-        return AE_TRUE;
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
     }
 
-    return AE_FALSE;
+    const aeMovieNode * node = _composition->nodes + entry->node_index;
+
+    *_opactity = node->extra_opacity;
+
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_get_movie_composition_node_extra_opacity( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_float_t * _opactity )
+ae_void_t ae_set_movie_composition_nodes_enable( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_bool_t _enable )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
+    for( ; entry != AE_NULLPTR; entry = __next_movie_composition_name_entry( _composition, &iterator, _type ) )
     {
-        const aeMovieNode * node = it_node;
+        aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        const aeMovieLayerData * layer = node->layer_data;
+        node->enable = _enable;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_set_movie_composition_nodes_enable_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_bool_t _enable )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE );
+    for( ; entry != AE_NULLPTR; entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE ) )
+    {
+        aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+        node->enable = _enable;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_set_movie_composition_node_enable( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_bool_t _enable )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
+
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
+
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
 
-        *_opactity = node->extra_opacity;
+    aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        return AE_TRUE;
-    }
+    node->enable = _enable;
 
-    return AE_FALSE;
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_void_t ae_set_movie_composition_nodes_enable( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_bool_t _enable )
+ae_bool_t ae_get_movie_composition_node_enable( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_bool_t * _enable )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
+
+    if( entry == AE_NULLPTR )
     {
-        aeMovieNode * node = it_node;
+        return AE_FALSE;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    const aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    *_enable = node->enable;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_has_movie_composition_node_any( const aeMovieComposition * _composition, const ae_char_t * _layerName )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-        node->enable = _enable;
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE );
+
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
     }
+
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_void_t ae_set_movie_composition_nodes_enable_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_bool_t _enable )
+ae_bool_t ae_get_movie_composition_node_in_out_time_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_time_t * _in, ae_time_t * _out )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE );
+
+    if( entry == AE_NULLPTR )
     {
-        aeMovieNode * node = it_node;
+        return AE_FALSE;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    const aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    *_in = AE_TIME_OUTSCALE( node->in_time );
+    *_out = AE_TIME_OUTSCALE( node->out_time );
 
-        node->enable = _enable;
-    }
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_set_movie_composition_node_enable( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_bool_t _enable )
+ae_bool_t ae_set_movie_composition_node_enable_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_bool_t _enable )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE );
+
+    if( entry == AE_NULLPTR )
     {
-        aeMovieNode * node = it_node;
+        return AE_FALSE;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    aeMovieNode * node = _composition->nodes + entry->node_index;
 
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    node->enable = _enable;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_get_movie_composition_node_enable_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_bool_t * _enable )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-        node->enable = _enable;
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_NONE );
 
-        return AE_TRUE;
+    if( entry == AE_NULLPTR )
+    {
+        return AE_FALSE;
     }
 
-    return AE_FALSE;
+    const aeMovieNode * node = _composition->nodes + entry->node_index;
+
+    *_enable = node->enable;
+
+    return AE_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_get_movie_composition_node_enable( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_bool_t * _enable )
+ae_bool_t ae_find_movie_composition_node_handle( const aeMovieComposition * _composition, const ae_char_t * _layerName, aeMovieLayerTypeEnum _type, ae_node_handle_t * _handle )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _layerName, &iterator );
 
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, _type );
+
+    if( entry == AE_NULLPTR )
     {
-        const aeMovieNode * node = it_node;
+        *_handle = AE_MOVIE_NODE_HANDLE_INVALID;
 
-        const aeMovieLayerData * layer = node->layer_data;
+        return AE_FALSE;
+    }
 
-        if( _type != AE_MOVIE_LAYER_TYPE_NONE && layer->type != _type )
-        {
-            continue;
-        }
+    *_handle = entry->node_index;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+const aeMovieLayerData * ae_get_movie_composition_node_handle_layer_data( const aeMovieComposition * _composition, ae_node_handle_t _handle )
+{
+    if( _handle >= _composition->node_count )
+    {
+        return AE_NULLPTR;
+    }
 
-        *_enable = node->enable;
+    const aeMovieNode * node = _composition->nodes + _handle;
 
-        return AE_TRUE;
+    return node->layer_data;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_set_movie_composition_node_handle_enable( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_bool_t _enable )
+{
+    if( _handle >= _composition->node_count )
+    {
+        return;
     }
 
-    return AE_FALSE;
+    aeMovieNode * node = _composition->nodes + _handle;
+
+    node->enable = _enable;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_has_movie_composition_node_any( const aeMovieComposition * _composition, const ae_char_t * _layerName )
+ae_bool_t ae_get_movie_composition_node_handle_enable( const aeMovieComposition * _composition, ae_node_handle_t _handle )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    if( _handle >= _composition->node_count )
     {
-        const aeMovieNode * node = it_node;
+        return AE_FALSE;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    const aeMovieNode * node = _composition->nodes + _handle;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    return node->enable;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_set_movie_composition_node_handle_extra_opacity( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_float_t _opacity )
+{
+    if( _handle >= _composition->node_count )
+    {
+        return;
+    }
 
-        return AE_TRUE;
+    aeMovieNode * node = _composition->nodes + _handle;
+
+    node->extra_opacity = _opacity;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_float_t ae_get_movie_composition_node_handle_extra_opacity( const aeMovieComposition * _composition, ae_node_handle_t _handle )
+{
+    if( _handle >= _composition->node_count )
+    {
+        return 0.f;
     }
 
-    return AE_FALSE;
+    const aeMovieNode * node = _composition->nodes + _handle;
+
+    return node->extra_opacity;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_get_movie_composition_node_in_out_time_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_time_t * _in, ae_time_t * _out )
+ae_void_t ae_get_movie_composition_node_handle_in_out_time( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_time_t * _in, ae_time_t * _out )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    if( _handle >= _composition->node_count )
+    {
+        return;
+    }
 
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    const aeMovieNode * node = _composition->nodes + _handle;
+
+    *_in = AE_TIME_OUTSCALE( node->in_time );
+    *_out = AE_TIME_OUTSCALE( node->out_time );
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_set_movie_composition_node_handle_in_out_time( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_time_t _in, ae_time_t _out )
+{
+    if( _handle >= _composition->node_count )
     {
-        const aeMovieNode * node = it_node;
+        return;
+    }
 
-        const aeMovieLayerData * layer = node->layer_data;
+    aeMovieNode * node = _composition->nodes + _handle;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    const aeMovieCompositionData * layer_composition_data = node->layer_data->composition_data;
 
-        *_in = AE_TIME_OUTSCALE( node->in_time );
-        *_out = AE_TIME_OUTSCALE( node->out_time );
+    ae_float_t in_time = AE_TIME_INSCALE( _in );
+    ae_float_t out_time = AE_TIME_INSCALE( _out );
 
-        return AE_TRUE;
+    if( in_time < 0.f )
+    {
+        in_time = 0.f;
     }
 
-    return AE_FALSE;
-}
-//////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_set_movie_composition_node_enable_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_bool_t _enable )
-{
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    if( out_time < in_time )
+    {
+        out_time = in_time;
+    }
 
-    aeMovieNode * it_node = _composition->nodes;
-    aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    node->in_time = __correct_timeline_frame_time( in_time, layer_composition_data, &node->in_frame );
+    node->out_time = __correct_timeline_frame_time( out_time, layer_composition_data, &node->out_frame );
+
+    //nodes are laid out depth first, the closest composition node of this layer composition before it is the parent
+    const aeMovieNode * parent = AE_NULLPTR;
+
+    for( ae_uint32_t index = _handle; index != 0U; --index )
     {
-        aeMovieNode * node = it_node;
+        const aeMovieNode * node_prev = _composition->nodes + index - 1U;
 
-        const aeMovieLayerData * layer = node->layer_data;
+        const aeMovieLayerData * layer_prev = node_prev->layer_data;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
+        if( (layer_prev->type == AE_MOVIE_LAYER_TYPE_MOVIE || layer_prev->type == AE_MOVIE_LAYER_TYPE_SUB_MOVIE) && layer_prev->subcomposition_data == layer_composition_data )
         {
-            continue;
+            parent = node_prev;
+
+            break;
         }
+    }
 
-        node->enable = _enable;
+    ae_frame_t duration_frame = _composition->composition_data->duration_frame;
 
-        return AE_TRUE;
+    const aeMovieNodeCold * node_cold = _composition->node_colds + _handle;
+
+    if( parent == AE_NULLPTR )
+    {
+        node->incessantly = __is_movie_node_incessantly( node, node_cold, 0, duration_frame, duration_frame, AE_TRUE );
+    }
+    else
+    {
+        node->incessantly = __is_movie_node_incessantly( node, node_cold, parent->in_frame, parent->out_frame, duration_frame, parent->incessantly );
     }
 
-    return AE_FALSE;
-}
-//////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_get_movie_composition_node_enable_any( const aeMovieComposition * _composition, const ae_char_t * _layerName, ae_bool_t * _enable )
-{
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    ae_uint32_t position = 0U;
+    for( ; position != _composition->node_count; ++position )
+    {
+        if( _composition->update_nodes[position] == node )
+        {
+            break;
+        }
+    }
 
-    const aeMovieNode * it_node = _composition->nodes;
-    const aeMovieNode * it_node_end = _composition->nodes + _composition->node_count;
-    for( ; it_node != it_node_end; ++it_node )
+    aeMovieNodeIntervalIndex * index = __find_movie_composition_interval_index( _composition, position );
+
+    if( index != AE_NULLPTR )
     {
-        const aeMovieNode * node = it_node;
+        aeMovieNodeInterval * intervals = _composition->update_node_intervals;
 
-        const aeMovieLayerData * layer = node->layer_data;
+        aeMovieNodeInterval * interval = intervals + position;
 
-        if( AE_STRNCMP( instance, layer->name, _layerName, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+        __setup_movie_node_interval_time( interval, node );
 
-        *_enable = node->enable;
+        interval->always = __is_movie_node_interval_always( node );
 
-        return AE_TRUE;
+        //one key moved, the orders are resorted and the next sweep starts over
+        __sort_movie_node_interval_order( index->in_order, index->count, intervals, AE_FALSE );
+        __sort_movie_node_interval_order( index->out_order, index->count, intervals, AE_TRUE );
+
+        index->sweep_valid = AE_FALSE;
     }
 
-    return AE_FALSE;
+    //the local frame moves with the in time, the next update rebuilds the matrix and revises the subtree
+    aeMovieNodeSampling * node_sampling = __get_movie_composition_node_sampling( _composition, node );
+
+    node_sampling->matrix_sampled = AE_FALSE;
+    node_sampling->hold_matrix = AE_FALSE;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_bool_t ae_has_movie_sub_composition( const aeMovieComposition * _composition, const ae_char_t * _name )
+ae_void_t ae_set_movie_composition_node_handle_userdata( const aeMovieComposition * _composition, ae_node_handle_t _handle, ae_userdata_t _userdata )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
-
-    const aeMovieSubComposition * it_subcomposition = _composition->subcompositions;
-    const aeMovieSubComposition * it_subcomposition_end = _composition->subcompositions + _composition->subcomposition_count;
-    for( ; it_subcomposition != it_subcomposition_end; ++it_subcomposition )
+    if( _handle >= _composition->node_count )
     {
-        const aeMovieSubComposition * subcomposition = it_subcomposition;
-
-        const aeMovieLayerData * layer = subcomposition->layer_data;
+        return;
+    }
 
-        if( AE_STRNCMP( instance, layer->name, _name, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    aeMovieNodeCold * node_cold = _composition->node_colds + _handle;
 
-        return AE_TRUE;
+    node_cold->element_userdata = _userdata;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_userdata_t ae_get_movie_composition_node_handle_userdata( const aeMovieComposition * _composition, ae_node_handle_t _handle )
+{
+    if( _handle >= _composition->node_count )
+    {
+        return AE_USERDATA_NULL;
     }
 
-    return AE_FALSE;
+    const aeMovieNodeCold * node_cold = _composition->node_colds + _handle;
+
+    return node_cold->element_userdata;
 }
 //////////////////////////////////////////////////////////////////////////
-const aeMovieSubComposition * ae_get_movie_sub_composition( const aeMovieComposition * _composition, const ae_char_t * _name )
+ae_bool_t ae_has_movie_sub_composition( const aeMovieComposition * _composition, const ae_char_t * _name )
 {
-    const aeMovieInstance * instance = _composition->movie_data->instance;
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _name, &iterator );
 
-    const aeMovieSubComposition * it_subcomposition = _composition->subcompositions;
-    const aeMovieSubComposition * it_subcomposition_end = _composition->subcompositions + _composition->subcomposition_count;
-    for( ; it_subcomposition != it_subcomposition_end; ++it_subcomposition )
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_SUB_MOVIE );
+
+    if( entry == AE_NULLPTR )
     {
-        const aeMovieSubComposition * subcomposition = it_subcomposition;
+        return AE_FALSE;
+    }
 
-        const aeMovieLayerData * layer = subcomposition->layer_data;
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+const aeMovieSubComposition * ae_get_movie_sub_composition( const aeMovieComposition * _composition, const ae_char_t * _name )
+{
+    aeMovieCompositionNameIterator iterator;
+    __begin_movie_composition_name_iterator( _composition, _name, &iterator );
 
-        if( AE_STRNCMP( instance, layer->name, _name, AE_MOVIE_MAX_LAYER_NAME ) != 0 )
-        {
-            continue;
-        }
+    const aeMovieCompositionNameEntry * entry = __next_movie_composition_name_entry( _composition, &iterator, AE_MOVIE_LAYER_TYPE_SUB_MOVIE );
 
-        return subcomposition;
+    if( entry == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
     }
 
-    return AE_NULLPTR;
+    const aeMovieSubComposition * subcomposition = _composition->subcompositions + entry->subcomposition_index;
+
+    return subcomposition;
 }
 //////////////////////////////////////////////////////////////////////////
 ae_bool_t ae_visit_movie_sub_composition( const aeMovieComposition * _composition, ae_movie_sub_composition_visitor_t _visitor, ae_userdata_t _ud )
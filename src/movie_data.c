@@ -36,6 +36,9 @@
 #include "movie_utils.h"
 #include "movie_memory.h"
 #include "movie_stream.h"
+#include "movie_detail.h"
+
+#define AE_MOVIE_SUBCOMPOSITION_INDEX_NONE (~0U)
 
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_uint32_t __len_str_option( const ae_char_t * _option4 )
@@ -96,6 +99,8 @@ aeMovieData * ae_create_movie_data( const aeMovieInstance * _instance, const aeM
     movie->composition_count = 0;
     movie->compositions = AE_NULLPTR;
 
+    movie->composition_live_count = 0U;
+
     return movie;
 }
 //////////////////////////////////////////////////////////////////////////
@@ -326,6 +331,8 @@ ae_void_t ae_delete_movie_data( const aeMovieData * _movieData )
 
                 AE_DELETE_STRING( instance, camera->name );
 
+                ae_movie_delete_camera_transformation( instance, camera );
+
                 AE_DELETE( instance, composition->camera );
             }
 
@@ -487,6 +494,27 @@ ae_void_t ae_delete_movie_data( const aeMovieData * _movieData )
 
             AE_DELETEN( instance, composition->layers );
 
+            if( composition->matrix_cache != AE_NULLPTR )
+            {
+                const aeMovieCompositionMatrixCache * matrix_cache = composition->matrix_cache;
+
+                AE_DELETEN( instance, matrix_cache->layer_offsets );
+                AE_DELETEN( instance, matrix_cache->slots );
+                AE_DELETEN( instance, matrix_cache->entries );
+
+                AE_DELETE( instance, composition->matrix_cache );
+            }
+
+            if( composition->name_index.buckets != AE_NULLPTR )
+            {
+                AE_DELETEN( instance, composition->name_index.buckets );
+            }
+
+            if( composition->name_index.entries != AE_NULLPTR )
+            {
+                AE_DELETEN( instance, composition->name_index.entries );
+            }
+
             AE_DELETE_STRING( instance, composition->name );
         }
     }
@@ -1576,6 +1604,10 @@ AE_INTERNAL ae_result_t __load_movie_data_composition( const aeMovieData * _movi
 
     AE_READ_STRING( _stream, _compositionData->name );
 
+    _compositionData->name_index.bucket_mask = 0U;
+    _compositionData->name_index.buckets = AE_NULLPTR;
+    _compositionData->name_index.entries = AE_NULLPTR;
+
     _compositionData->master = AE_READB( _stream );
 
     AE_READF( _stream, _compositionData->width );
@@ -1607,6 +1639,8 @@ AE_INTERNAL ae_result_t __load_movie_data_composition( const aeMovieData * _movi
 
     _compositionData->camera = AE_NULLPTR;
 
+    _compositionData->matrix_cache = AE_NULLPTR;
+
     for( ;; )
     {
         ae_uint8_t flag;
@@ -2457,6 +2491,138 @@ AE_INTERNAL ae_result_t __cache_movie_resource_data( aeMovieData * _movieData, a
     return AE_RESULT_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __get_movie_data_composition_node_count( const aeMovieCompositionData * _compositionData )
+{
+    ae_uint32_t count = _compositionData->layer_count;
+
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        switch( layer->type )
+        {
+        case AE_MOVIE_LAYER_TYPE_MOVIE:
+        case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
+            {
+                count += __get_movie_data_composition_node_count( layer->subcomposition_data );
+            }break;
+        default:
+            {
+            }break;
+        }
+    }
+
+    return count;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __fill_movie_data_composition_name_entries( const aeMovieInstance * _instance, const aeMovieCompositionData * _compositionData, aeMovieCompositionNameEntry * _entries, ae_uint32_t * _nodeIterator, ae_uint32_t * _subcompositionIterator )
+{
+    //same order as the composition lays out its nodes and subcompositions
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        ae_uint32_t node_index = (*_nodeIterator)++;
+
+        aeMovieCompositionNameEntry * entry = _entries + node_index;
+
+        entry->hash = __hash_movie_layer_name( _instance, layer->name );
+        entry->node_index = node_index;
+        entry->subcomposition_index = AE_MOVIE_SUBCOMPOSITION_INDEX_NONE;
+
+        switch( layer->type )
+        {
+        case AE_MOVIE_LAYER_TYPE_MOVIE:
+            {
+                __fill_movie_data_composition_name_entries( _instance, layer->subcomposition_data, _entries, _nodeIterator, _subcompositionIterator );
+            }break;
+        case AE_MOVIE_LAYER_TYPE_SUB_MOVIE:
+            {
+                entry->subcomposition_index = (*_subcompositionIterator)++;
+
+                __fill_movie_data_composition_name_entries( _instance, layer->subcomposition_data, _entries, _nodeIterator, _subcompositionIterator );
+            }break;
+        default:
+            {
+            }break;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_result_t __setup_movie_data_composition_name_index( const aeMovieInstance * _instance, aeMovieCompositionData * _compositionData )
+{
+    ae_uint32_t node_count = __get_movie_data_composition_node_count( _compositionData );
+
+    ae_uint32_t bucket_count = 1U;
+    while( _instance->use_name_hash == AE_TRUE && bucket_count < node_count )
+    {
+        bucket_count <<= 1;
+    }
+
+    ae_uint32_t * buckets = AE_NEWN( _instance, ae_uint32_t, bucket_count + 1U );
+    AE_RESULT_PANIC_MEMORY( buckets );
+
+    _compositionData->name_index.bucket_mask = bucket_count - 1U;
+    _compositionData->name_index.buckets = buckets;
+
+    for( ae_uint32_t index = 0U; index != bucket_count + 1U; ++index )
+    {
+        buckets[index] = 0U;
+    }
+
+    if( node_count == 0U )
+    {
+        return AE_RESULT_SUCCESSFUL;
+    }
+
+    aeMovieCompositionNameEntry * nodes_entries = AE_NEWN( _instance, aeMovieCompositionNameEntry, node_count );
+    AE_RESULT_PANIC_MEMORY( nodes_entries );
+
+    ae_uint32_t node_iterator = 0U;
+    ae_uint32_t subcomposition_iterator = 0U;
+    __fill_movie_data_composition_name_entries( _instance, _compositionData, nodes_entries, &node_iterator, &subcomposition_iterator );
+
+    aeMovieCompositionNameEntry * entries = AE_NEWN( _instance, aeMovieCompositionNameEntry, node_count );
+    AE_RESULT_PANIC_MEMORY( entries );
+
+    _compositionData->name_index.entries = entries;
+
+    //stable bucket sort, entries of one bucket keep the node order
+    for( ae_uint32_t index = 0U; index != node_count; ++index )
+    {
+        ++buckets[(nodes_entries[index].hash & (bucket_count - 1U)) + 1U];
+    }
+
+    for( ae_uint32_t index = 0U; index != bucket_count; ++index )
+    {
+        buckets[index + 1U] += buckets[index];
+    }
+
+    for( ae_uint32_t index = 0U; index != node_count; ++index )
+    {
+        const aeMovieCompositionNameEntry * node_entry = nodes_entries + index;
+
+        ae_uint32_t bucket = node_entry->hash & (bucket_count - 1U);
+
+        entries[buckets[bucket]++] = *node_entry;
+    }
+
+    for( ae_uint32_t index = bucket_count; index != 0U; --index )
+    {
+        buckets[index] = buckets[index - 1U];
+    }
+
+    buckets[0] = 0U;
+
+    AE_DELETEN( _instance, nodes_entries );
+
+    return AE_RESULT_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
 ae_result_t ae_load_movie_data( aeMovieData * _movieData, aeMovieStream * _stream, ae_uint32_t * _major, ae_uint32_t * _minor )
 {
     const aeMovieInstance * instance = _movieData->instance;
@@ -2549,6 +2715,15 @@ ae_result_t ae_load_movie_data( aeMovieData * _movieData, aeMovieStream * _strea
 
     _movieData->compositions = compositions;
 
+    aeMovieCompositionData * it_index_composition = compositions;
+    aeMovieCompositionData * it_index_composition_end = compositions + composition_count;
+    for( ; it_index_composition != it_index_composition_end; ++it_index_composition )
+    {
+        aeMovieCompositionData * composition = it_index_composition;
+
+        AE_RESULT( __setup_movie_data_composition_name_index, (instance, composition) );
+    }
+
     return AE_RESULT_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
@@ -3069,4 +3244,191 @@ ae_bool_t ae_has_movie_composition_data_layer( const aeMovieInstance * _instance
 
     return AE_FALSE;
 }
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_bake_movie_layer_data( aeMovieData * _movieData, const aeMovieLayerData * _layer, ae_size_t _budget, ae_size_t * _used )
+{
+    //node cursors of live compositions point into the timelines being replaced
+    if( _movieData->composition_live_count != 0U )
+    {
+        return AE_FALSE;
+    }
+
+    const aeMovieInstance * instance = _movieData->instance;
+
+    aeMovieLayerTransformation * transformation = (aeMovieLayerTransformation *)_layer->transformation;
+
+    ae_bool_t result = ae_movie_bake_layer_transformation( instance, transformation, _layer->threeD, _layer->frame_count, _budget, _used );
+
+    return result;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_bake_movie_composition_camera_data( aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_size_t _budget, ae_size_t * _used )
+{
+    if( _movieData->composition_live_count != 0U )
+    {
+        return AE_FALSE;
+    }
+
+    if( _compositionData->camera == AE_NULLPTR )
+    {
+        return AE_TRUE;
+    }
+
+    const aeMovieInstance * instance = _movieData->instance;
+
+    aeMovieCompositionCamera * camera = (aeMovieCompositionCamera *)_compositionData->camera;
+
+    ae_bool_t result = ae_movie_bake_camera_transformation( instance, camera, _compositionData->duration_frame, _budget, _used );
+
+    return result;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_bake_movie_composition_data( aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_size_t _budget, ae_size_t * _used )
+{
+    if( ae_bake_movie_composition_camera_data( _movieData, _compositionData, _budget, _used ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        if( ae_bake_movie_layer_data( _movieData, layer, _budget, _used ) == AE_FALSE )
+        {
+            return AE_FALSE;
+        }
+
+        if( layer->subcomposition_data != AE_NULLPTR )
+        {
+            if( ae_bake_movie_composition_data( _movieData, layer->subcomposition_data, _budget, _used ) == AE_FALSE )
+            {
+                return AE_FALSE;
+            }
+        }
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_enable_movie_composition_data_matrix_cache( const aeMovieData * _movieData, aeMovieCompositionData * _compositionData, ae_uint32_t _capacity )
+{
+    if( _capacity == 0U )
+    {
+        return AE_FALSE;
+    }
+
+    if( _compositionData->matrix_cache == AE_NULLPTR )
+    {
+        const aeMovieInstance * instance = _movieData->instance;
+
+        aeMovieCompositionMatrixCache * matrix_cache = AE_NEW( instance, aeMovieCompositionMatrixCache );
+
+        if( matrix_cache == AE_NULLPTR )
+        {
+            return AE_FALSE;
+        }
+
+        matrix_cache->capacity = _capacity;
+        matrix_cache->count = 0U;
+        matrix_cache->evict = 0U;
+
+        matrix_cache->hits = 0U;
+        matrix_cache->misses = 0U;
+        matrix_cache->evictions = 0U;
+
+        ae_uint32_t slot_count = 0U;
+
+        ae_uint32_t * layer_offsets = AE_NEWN( instance, ae_uint32_t, _compositionData->layer_count );
+
+        if( layer_offsets == AE_NULLPTR )
+        {
+            AE_DELETE( instance, matrix_cache );
+
+            return AE_FALSE;
+        }
+
+        for( ae_uint32_t index = 0; index != _compositionData->layer_count; ++index )
+        {
+            layer_offsets[index] = slot_count;
+
+            slot_count += _compositionData->layers[index].frame_count;
+        }
+
+        ae_uint32_t * slots = AE_NEWN( instance, ae_uint32_t, slot_count );
+
+        if( slots == AE_NULLPTR )
+        {
+            AE_DELETEN( instance, layer_offsets );
+            AE_DELETE( instance, matrix_cache );
+
+            return AE_FALSE;
+        }
+
+        for( ae_uint32_t index = 0; index != slot_count; ++index )
+        {
+            slots[index] = 0U;
+        }
+
+        aeMovieCompositionMatrixCacheEntry * entries = AE_NEWN( instance, aeMovieCompositionMatrixCacheEntry, _capacity );
+
+        if( entries == AE_NULLPTR )
+        {
+            AE_DELETEN( instance, slots );
+            AE_DELETEN( instance, layer_offsets );
+            AE_DELETE( instance, matrix_cache );
+
+            return AE_FALSE;
+        }
+
+        matrix_cache->layer_offsets = layer_offsets;
+        matrix_cache->slots = slots;
+        matrix_cache->entries = entries;
+
+        _compositionData->matrix_cache = matrix_cache;
+    }
+
+    const aeMovieLayerData * it_layer = _compositionData->layers;
+    const aeMovieLayerData * it_layer_end = _compositionData->layers + _compositionData->layer_count;
+    for( ; it_layer != it_layer_end; ++it_layer )
+    {
+        const aeMovieLayerData * layer = it_layer;
+
+        if( layer->subcomposition_data == AE_NULLPTR )
+        {
+            continue;
+        }
+
+        //sub compositions belong to the same data as _compositionData
+        aeMovieCompositionData * subcomposition_data = (aeMovieCompositionData *)layer->subcomposition_data;
+
+        if( ae_enable_movie_composition_data_matrix_cache( _movieData, subcomposition_data, _capacity ) == AE_FALSE )
+        {
+            return AE_FALSE;
+        }
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_get_movie_composition_data_matrix_cache_statistics( const aeMovieCompositionData * _compositionData, aeMovieCompositionDataMatrixCacheStatistics * _statistics )
+{
+    const aeMovieCompositionMatrixCache * matrix_cache = _compositionData->matrix_cache;
+
+    if( matrix_cache == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    _statistics->capacity = matrix_cache->capacity;
+    _statistics->count = matrix_cache->count;
+
+    _statistics->hits = matrix_cache->hits;
+    _statistics->misses = matrix_cache->misses;
+    _statistics->evictions = matrix_cache->evictions;
+
+    return AE_TRUE;
+}
 //////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -52,5 +52,26 @@ AE_INTERNAL ae_float_t __correct_timeline_frame_time( ae_float_t _time, const ae
 
     return correct_frame_time;
 }
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __hash_movie_layer_name( const aeMovieInstance * _instance, const ae_char_t * _name )
+{
+    if( _instance->use_name_hash == AE_FALSE )
+    {
+        //byte hash can't follow a custom strncmp, every name lands in one bucket
+        return 0U;
+    }
+
+    ae_uint32_t hash = 2166136261U;
+
+    const ae_char_t * it_name = _name;
+    const ae_char_t * it_name_end = _name + AE_MOVIE_MAX_LAYER_NAME;
+    for( ; it_name != it_name_end && *it_name != '\0'; ++it_name )
+    {
+        hash ^= (ae_uint8_t)*it_name;
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
 
 #endif
\ No newline at end of file
@@ -165,17 +165,24 @@ const aeMovieInstance * ae_create_movie_instance( const ae_char_t * _hashkey, ae
         }
     }
 
+    for( ae_uint32_t index = 0; index != 10; ++index )
+    {
+        instance->hashmask_repeat[index] = instance->hashmask[index % 5U];
+    }
+
     instance->memory_alloc = _alloc;
     instance->memory_alloc_n = _alloc_n;
     instance->memory_free = _free;
     instance->memory_free_n = _free_n;
     instance->strncmp = _strncmp;
+    instance->use_name_hash = AE_FALSE;
     instance->logger = _logger;
     instance->instance_userdata = _userdata;
 
     if( instance->strncmp == AE_NULLPTR )
     {
         instance->strncmp = &__movie_strncmp;
+        instance->use_name_hash = AE_TRUE;
     }
 
     if( instance->logger == AE_NULLPTR )
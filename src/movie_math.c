@@ -331,26 +331,29 @@ ae_void_t ae_movie_make_transformation3d_m34wskq( ae_matrix34_t _out, const ae_v
     _out[3 * 3 + 2] += _position[2];
 }
 //////////////////////////////////////////////////////////////////////////
-ae_void_t ae_movie_make_transformation2d_m34wq( ae_matrix34_t _out, const ae_vector2_t _position, const ae_vector2_t _anchor, const ae_vector2_t _scale, const ae_skew_t _skew )
+AE_INTERNAL ae_void_t __make_transformation2d_affine_m34( ae_matrix34_t _out, const ae_vector2_t _position, const ae_vector2_t _anchor, const ae_vector2_t _scale, ae_float_t _qz, ae_float_t _qw, ae_float_t _k0, ae_float_t _k1, ae_float_t _k2 )
 {
-    ae_matrix34_t m4_anchor_scale;
-    __make_transformation2d_anchor_scale_m34( m4_anchor_scale, _anchor, _scale );
+    ae_movie_make_transformation2d_affine( _out + 0, _out + 1, _out + 3, _out + 4, _out + 9, _out + 10
+        , _position[0], _position[1], _anchor[0], _anchor[1], _scale[0], _scale[1], _qz, _qw, _k0, _k1, _k2 );
 
-    __apply_transformation_skew_m34( _out, m4_anchor_scale, _skew );
+    _out[0 * 3 + 2] = 0.f;
+    _out[1 * 3 + 2] = 0.f;
 
-    _out[3 * 3 + 0] += _position[0];
-    _out[3 * 3 + 1] += _position[1];
+    _out[2 * 3 + 0] = 0.f;
+    _out[2 * 3 + 1] = 0.f;
+    _out[2 * 3 + 2] = 1.f;
+
+    _out[3 * 3 + 2] = 0.f;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_movie_make_transformation2d_m34wq( ae_matrix34_t _out, const ae_vector2_t _position, const ae_vector2_t _anchor, const ae_vector2_t _scale, const ae_skew_t _skew )
+{
+    __make_transformation2d_affine_m34( _out, _position, _anchor, _scale, 0.f, 1.f, _skew[0], _skew[1], _skew[2] );
 }
 //////////////////////////////////////////////////////////////////////////
 ae_void_t ae_movie_make_transformation2d_m34wsk( ae_matrix34_t _out, const ae_vector2_t _position, const ae_vector2_t _anchor, const ae_vector2_t _scale, const ae_quaternionzw_t _quaternion )
 {
-    ae_matrix34_t m4_anchor_scale;
-    __make_transformation2d_anchor_scale_m34( m4_anchor_scale, _anchor, _scale );
-
-    __apply_transformation2d_rotate_m34( _out, m4_anchor_scale, _quaternion );
-
-    _out[3 * 3 + 0] += _position[0];
-    _out[3 * 3 + 1] += _position[1];
+    __make_transformation2d_affine_m34( _out, _position, _anchor, _scale, _quaternion[0], _quaternion[1], 0.f, 0.f, 1.f );
 }
 //////////////////////////////////////////////////////////////////////////
 ae_void_t ae_movie_make_transformation2d_m34wskq( ae_matrix34_t _out, const ae_vector2_t _position, const ae_vector2_t _anchor, const ae_vector2_t _scale )
@@ -363,16 +366,7 @@ ae_void_t ae_movie_make_transformation2d_m34wskq( ae_matrix34_t _out, const ae_v
 //////////////////////////////////////////////////////////////////////////
 ae_void_t ae_movie_make_transformation2d_m34( ae_matrix34_t _out, const ae_vector2_t _position, const ae_vector2_t _anchor, const ae_vector2_t _scale, const ae_quaternionzw_t _quaternion, const ae_skew_t _skew )
 {
-    ae_matrix34_t m4_anchor_scale;
-    __make_transformation2d_anchor_scale_m34( m4_anchor_scale, _anchor, _scale );
-
-    ae_matrix34_t m4_anchor_scale_rotate;
-    __apply_transformation2d_rotate_m34( m4_anchor_scale_rotate, m4_anchor_scale, _quaternion );
-
-    __apply_transformation_skew_m34( _out, m4_anchor_scale_rotate, _skew );
-
-    _out[3 * 3 + 0] += _position[0];
-    _out[3 * 3 + 1] += _position[1];
+    __make_transformation2d_affine_m34( _out, _position, _anchor, _scale, _quaternion[0], _quaternion[1], _skew[0], _skew[1], _skew[2] );
 }
 //////////////////////////////////////////////////////////////////////////
 #ifdef LIBMOVIE_EXTERNAL_INVERSE_SQRTF
@@ -425,7 +419,15 @@ ae_void_t ae_linerp_q( ae_quaternion_t _q, const ae_quaternion_t _q1, const ae_q
     ae_float_t z;
     ae_float_t w;
 
-    if( dot < 0.f )
+    if( _q1[0] == _q2[0] && _q1[1] == _q2[1] && _q1[2] == _q2[2] && _q1[3] == _q2[3] )
+    {
+        //equal neighbours, only normalise so the result does not depend on t
+        x = _q1[0];
+        y = _q1[1];
+        z = _q1[2];
+        w = _q1[3];
+    }
+    else if( dot < 0.f )
     {
         x = _q1[0] * inv_t - _q2[0] * _t;
         y = _q1[1] * inv_t - _q2[1] * _t;
@@ -463,7 +465,13 @@ ae_void_t ae_linerp_qzw( ae_quaternionzw_t _q, const ae_quaternionzw_t _q1, cons
     ae_float_t z;
     ae_float_t w;
 
-    if( dot < 0.f )
+    if( _q1[0] == _q2[0] && _q1[1] == _q2[1] )
+    {
+        //equal neighbours, only normalise so the result does not depend on t
+        z = _q1[0];
+        w = _q1[1];
+    }
+    else if( dot < 0.f )
     {
         z = _q1[0] * inv_t - _q2[0] * _t;
         w = _q1[1] * inv_t - _q2[1] * _t;
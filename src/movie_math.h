@@ -123,6 +123,56 @@ AE_INTERNAL ae_float_t ae_fractional_f( ae_float_t value )
     return fractional;
 }
 //////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t ae_movie_make_transformation2d_affine( ae_float_t * _m00, ae_float_t * _m01, ae_float_t * _m10, ae_float_t * _m11, ae_float_t * _tx, ae_float_t * _ty
+    , ae_float_t _px, ae_float_t _py, ae_float_t _ax, ae_float_t _ay, ae_float_t _sx, ae_float_t _sy, ae_float_t _qz, ae_float_t _qw, ae_float_t _k0, ae_float_t _k1, ae_float_t _k2 )
+{
+    //anchor scale * rotate
+    ae_float_t r_z2 = _qz + _qz;
+    ae_float_t r_zz = 1.f - _qz * r_z2;
+    ae_float_t r_wz = _qw * r_z2;
+
+    ae_float_t a00 = _sx * r_zz;
+    ae_float_t a01 = _sx * -r_wz;
+    ae_float_t a10 = _sy * r_wz;
+    ae_float_t a11 = _sy * r_zz;
+
+    ae_float_t a_tx = -_ax * _sx;
+    ae_float_t a_ty = -_ay * _sy;
+
+    ae_float_t a20 = a_tx * r_zz + a_ty * r_wz;
+    ae_float_t a21 = a_tx * -r_wz + a_ty * r_zz;
+
+    //skew rotate inverse
+    ae_float_t i_k1 = -_k1;
+    ae_float_t i_z2 = i_k1 + i_k1;
+    ae_float_t i_zz = 1.f - i_k1 * i_z2;
+    ae_float_t i_wz = _k2 * i_z2;
+
+    ae_float_t b00 = a00 * i_zz + a01 * i_wz;
+    ae_float_t b01 = a00 * -i_wz + a01 * i_zz;
+    ae_float_t b10 = a10 * i_zz + a11 * i_wz;
+    ae_float_t b11 = a10 * -i_wz + a11 * i_zz;
+    ae_float_t b20 = a20 * i_zz + a21 * i_wz;
+    ae_float_t b21 = a20 * -i_wz + a21 * i_zz;
+
+    //skew
+    ae_float_t c01 = b00 * _k0 + b01;
+    ae_float_t c11 = b10 * _k0 + b11;
+    ae_float_t c21 = b20 * _k0 + b21;
+
+    //skew rotate
+    ae_float_t s_z2 = _k1 + _k1;
+    ae_float_t s_zz = 1.f - _k1 * s_z2;
+    ae_float_t s_wz = _k2 * s_z2;
+
+    *_m00 = b00 * s_zz + c01 * s_wz;
+    *_m01 = b00 * -s_wz + c01 * s_zz;
+    *_m10 = b10 * s_zz + c11 * s_wz;
+    *_m11 = b10 * -s_wz + c11 * s_zz;
+    *_tx = (b20 * s_zz + c21 * s_wz) + _px;
+    *_ty = (b20 * -s_wz + c21 * s_zz) + _py;
+}
+//////////////////////////////////////////////////////////////////////////
 ae_void_t ae_linerp_q( ae_quaternion_t _q, const ae_quaternion_t _q1, const ae_quaternion_t _q2, ae_float_t _t );
 ae_void_t ae_linerp_qzw( ae_quaternionzw_t _q, const ae_quaternionzw_t _q1, const ae_quaternionzw_t _q2, ae_float_t _t );
 //////////////////////////////////////////////////////////////////////////
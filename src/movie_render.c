@@ -0,0 +1,251 @@
+/******************************************************************************
+* libMOVIE Software License v1.0
+*
+* Copyright (c) 2016-2019, Yuriy Levchenko <irov13@mail.ru>
+* All rights reserved.
+*
+* You are granted a perpetual, non-exclusive, non-sublicensable, and
+* non-transferable license to use, install, execute, and perform the libMOVIE
+* software and derivative works solely for personal or internal
+* use. Without the written permission of Yuriy Levchenko, you may not (a) modify, translate,
+* adapt, or develop new applications using the libMOVIE or otherwise
+* create derivative works or improvements of the libMOVIE or (b) remove,
+* delete, alter, or obscure any trademarks or any copyright, trademark, patent,
+* or other intellectual property or proprietary rights notices on or in the
+* Software, including any copy thereof. Redistributions in binary or source
+* form must include this license and terms.
+*
+* THIS SOFTWARE IS PROVIDED BY YURIY LEVCHENKO "AS IS" AND ANY EXPRESS OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+* EVENT SHALL YURIY LEVCHENKO BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+* SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES, BUSINESS INTERRUPTION,
+* OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+* OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "movie/movie_render.h"
+#include "movie/movie_resource.h"
+
+#include "movie_memory.h"
+#include "movie_debug.h"
+#include "movie_struct.h"
+
+#ifndef AE_MOVIE_RENDER_BATCHES_MIN_CAPACITY
+#define AE_MOVIE_RENDER_BATCHES_MIN_CAPACITY 64U
+#endif
+
+#define AE_MOVIE_RENDER_BATCH_NONE (~0U)
+
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_initialize_movie_render_batches( const aeMovieInstance * _instance, aeMovieRenderBatches * _batches )
+{
+    _batches->instance = _instance;
+
+    _batches->batches = AE_NULLPTR;
+    _batches->batch_count = 0;
+    _batches->batch_capacity = 0;
+
+    _batches->draw_call_count = 0;
+    _batches->draw_call_saved = 0;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_finalize_movie_render_batches( aeMovieRenderBatches * _batches )
+{
+    const aeMovieInstance * instance = _batches->instance;
+
+    if( _batches->batches != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _batches->batches );
+    }
+
+    ae_initialize_movie_render_batches( instance, _batches );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __reserve_movie_render_batches( aeMovieRenderBatches * _batches, ae_uint32_t _count )
+{
+    if( _count <= _batches->batch_capacity )
+    {
+        return AE_TRUE;
+    }
+
+    const aeMovieInstance * instance = _batches->instance;
+
+    ae_uint32_t capacity = _batches->batch_capacity * 2U;
+
+    if( capacity < AE_MOVIE_RENDER_BATCHES_MIN_CAPACITY )
+    {
+        capacity = AE_MOVIE_RENDER_BATCHES_MIN_CAPACITY;
+    }
+
+    if( capacity < _count )
+    {
+        capacity = _count;
+    }
+
+    aeMovieRenderBatch * batches = AE_NEWN( instance, aeMovieRenderBatch, capacity );
+
+    AE_MOVIE_PANIC_MEMORY( batches, AE_FALSE );
+
+    ae_uint32_t index = 0;
+    for( ; index != _batches->batch_count; ++index )
+    {
+        batches[index] = _batches->batches[index];
+    }
+
+    if( _batches->batches != AE_NULLPTR )
+    {
+        AE_DELETEN( instance, _batches->batches );
+    }
+
+    _batches->batches = batches;
+    _batches->batch_capacity = capacity;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const aeMovieResource * __get_movie_render_draw_texture( const aeMovieRenderDraw * _draw )
+{
+    const aeMovieResource * resource = _draw->resource;
+
+    if( resource == AE_NULLPTR )
+    {
+        return AE_NULLPTR;
+    }
+
+    switch( resource->type )
+    {
+    case AE_MOVIE_RESOURCE_IMAGE:
+        {
+            const aeMovieResourceImage * resource_image = (const aeMovieResourceImage *)resource;
+
+            if( resource_image->atlas_image != AE_NULLPTR )
+            {
+                return (const aeMovieResource *)resource_image->atlas_image;
+            }
+
+            return resource;
+        }break;
+    case AE_MOVIE_RESOURCE_SOLID:
+        {
+            return AE_NULLPTR;
+        }break;
+    default:
+        {
+        }break;
+    }
+
+    return resource;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __is_movie_render_batch_compatible( const aeMovieRenderBatch * _batch, const aeMovieRenderDraw * _draw, const aeMovieResource * _texture )
+{
+    if( _batch->texture != _texture )
+    {
+        return AE_FALSE;
+    }
+
+    if( _batch->blend_mode != _draw->blend_mode )
+    {
+        return AE_FALSE;
+    }
+
+    if( _batch->camera_userdata != _draw->camera_userdata )
+    {
+        return AE_FALSE;
+    }
+
+    if( _batch->shader_userdata != _draw->shader_userdata )
+    {
+        return AE_FALSE;
+    }
+
+    if( _batch->track_matte_userdata != _draw->track_matte_userdata )
+    {
+        return AE_FALSE;
+    }
+
+    if( _batch->viewport != _draw->viewport )
+    {
+        return AE_FALSE;
+    }
+
+    if( _batch->vertex_base != _draw->vertex_base )
+    {
+        return AE_FALSE;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_batch_movie_render_meshes( const aeMovieRenderMeshes * _meshes, aeMovieRenderBatches * _batches )
+{
+    _batches->batch_count = 0;
+    _batches->draw_call_count = 0;
+    _batches->draw_call_saved = 0;
+
+    ae_uint32_t batch_current = AE_MOVIE_RENDER_BATCH_NONE;
+
+    ae_uint32_t draw_index = 0;
+    for( ; draw_index != _meshes->draw_count; ++draw_index )
+    {
+        const aeMovieRenderDraw * draw = _meshes->draws + draw_index;
+
+        ae_bool_t geometry = (draw->index_count != 0) ? AE_TRUE : AE_FALSE;
+
+        const aeMovieResource * texture = __get_movie_render_draw_texture( draw );
+
+        if( geometry == AE_TRUE && batch_current != AE_MOVIE_RENDER_BATCH_NONE && __is_movie_render_batch_compatible( _batches->batches + batch_current, draw, texture ) == AE_TRUE )
+        {
+            aeMovieRenderBatch * batch = _batches->batches + batch_current;
+
+            batch->draw_count += 1;
+            batch->vertex_count += draw->vertex_count;
+            batch->index_count += draw->index_count;
+
+            ++_batches->draw_call_saved;
+
+            continue;
+        }
+
+        if( __reserve_movie_render_batches( _batches, _batches->batch_count + 1 ) == AE_FALSE )
+        {
+            return AE_FALSE;
+        }
+
+        aeMovieRenderBatch * batch = _batches->batches + _batches->batch_count;
+
+        batch->texture = texture;
+        batch->blend_mode = draw->blend_mode;
+        batch->camera_userdata = draw->camera_userdata;
+        batch->shader_userdata = draw->shader_userdata;
+        batch->track_matte_userdata = draw->track_matte_userdata;
+        batch->viewport = draw->viewport;
+        batch->draw_offset = draw_index;
+        batch->draw_count = 1;
+        batch->vertex_base = draw->vertex_base;
+        batch->vertex_offset = draw->vertex_offset;
+        batch->vertex_count = draw->vertex_count;
+        batch->index_offset = draw->index_offset;
+        batch->index_count = draw->index_count;
+
+        if( geometry == AE_TRUE )
+        {
+            ++_batches->draw_call_count;
+
+            batch_current = _batches->batch_count;
+        }
+        else
+        {
+            //host content is drawn here, nothing after it may join an earlier batch
+            batch_current = AE_MOVIE_RENDER_BATCH_NONE;
+        }
+
+        ++_batches->batch_count;
+    }
+
+    return AE_TRUE;
+}
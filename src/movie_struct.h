@@ -34,6 +34,7 @@
 #include "movie/movie_composition.h"
 
 #include "movie_bezier.h"
+#include "movie_transformation.h"
 
 //////////////////////////////////////////////////////////////////////////
 typedef struct aeMovieBezierWarp
@@ -90,12 +91,14 @@ struct aeMovieInstance
 {
     ae_bool_t use_hash;
     ae_uint32_t hashmask[5];
+    ae_uint32_t hashmask_repeat[10];
 
     ae_movie_alloc_t memory_alloc;
     ae_movie_alloc_n_t memory_alloc_n;
     ae_movie_free_t memory_free;
     ae_movie_free_n_t memory_free_n;
     ae_movie_strncmp_t strncmp;
+    ae_bool_t use_name_hash;
     ae_movie_logger_t logger;
     ae_userdata_t instance_userdata;
 
@@ -143,6 +146,10 @@ struct aeMovieCompositionAnimation
 
     ae_uint32_t work_area_frame_begin;
     ae_uint32_t work_area_frame_end;
+
+    ae_bool_t camera_sampled;
+    ae_uint32_t camera_frame;
+    ae_float_t camera_t;
 };
 //////////////////////////////////////////////////////////////////////////
 struct aeMovieSubComposition
@@ -154,24 +161,33 @@ struct aeMovieSubComposition
     aeMovieCompositionAnimation * animation;
 
     ae_userdata_t subcomposition_userdata;
+
+    ae_uint32_t update_node_offset;
+    ae_uint32_t update_node_count;
 };
 //////////////////////////////////////////////////////////////////////////
 struct aeMovieNode
 {
+    //filter fields of the update and mesh loops share the first cache line
     const aeMovieLayerData * layer_data;
 
     struct aeMovieNode * relative_node;
     struct aeMovieNode * track_matte_node;
 
-    const ae_viewport_t * viewport;
-
     const aeMovieSubComposition * subcomposition;
 
+    ae_bool_t active;
+    ae_bool_t ignore;
+    ae_bool_t enable;
+    ae_bool_t incessantly;
+
+    ae_color_channel_t opacity;
+    ae_color_channel_t extra_opacity;
+
     ae_float_t start_time;
     ae_float_t in_time;
     ae_float_t out_time;
 
-    ae_frame_t start_frame;
     ae_frame_t in_frame;
     ae_frame_t out_frame;
 
@@ -180,10 +196,6 @@ struct aeMovieNode
     ae_frame_t current_frame;
     ae_float_t current_frame_t;
 
-    ae_bool_t active;
-    ae_bool_t ignore;
-    ae_bool_t enable;
-    ae_bool_t incessantly;
     ae_bool_t immutable_matrix;
     ae_bool_t immutable_color;
 
@@ -195,18 +207,93 @@ struct aeMovieNode
     ae_float_t composition_opacity;
 
     ae_color_t color;
-    ae_color_channel_t opacity;
-    ae_color_channel_t extra_opacity;
+
+    ae_blend_mode_t blend_mode;
+};
+//////////////////////////////////////////////////////////////////////////
+//parallel to aeMovieComposition::nodes, touched only by matrix updates, cursors last since only a resample reads them
+typedef struct aeMovieNodeSampling
+{
+    ae_uint32_t hold_begin;
+    ae_uint32_t hold_end;
+    ae_bool_t hold;
+    ae_bool_t hold_matrix;
+    ae_uint32_t hold_relative_revision;
+
+    ae_uint32_t matrix_revision;
+    ae_uint32_t matrix_skip_count;
+
+    ae_bool_t matrix_sampled;
+    ae_uint32_t matrix_frame;
+    ae_bool_t matrix_interpolate;
+    ae_float_t matrix_t;
+    ae_uint32_t matrix_relative_revision;
+    ae_uint32_t matrix_notify_revision;
+
+    aeMovieLayerTransformationCursors cursors;
+} aeMovieNodeSampling;
+//////////////////////////////////////////////////////////////////////////
+//parallel to aeMovieComposition::nodes, touched only by setup, provider callbacks and emitted meshes
+typedef struct aeMovieNodeCold
+{
+    ae_frame_t start_frame;
 
     ae_float_t volume;
 
-    ae_blend_mode_t blend_mode;
+    const ae_viewport_t * viewport;
 
     ae_userdata_t element_userdata;
     ae_userdata_t camera_userdata;
     ae_userdata_t shader_userdata;
     ae_userdata_t track_matte_userdata;
-};
+} aeMovieNodeCold;
+//////////////////////////////////////////////////////////////////////////
+//inputs of the last computed render geometry, see geometry_revision in aeMovieRenderMesh
+//two per node, the mesh queries and the track matte pass may pick different geometry for the same node
+typedef struct aeMovieNodeGeometry
+{
+    ae_uint32_t revision;
+    ae_uint32_t type;
+    ae_constvoidptr_t source;
+    const ae_vector2_t * uvs;
+    const aeMovieResource * resource;
+    ae_uint32_t frame;
+    ae_float_t t;
+    ae_uint32_t matrix_revision;
+    ae_matrix34_t matrix;
+} aeMovieNodeGeometry;
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieNodeInterval
+{
+    ae_float_t in_time;
+    ae_float_t out_time;
+
+    ae_uint32_t alive_slot;
+    ae_uint32_t visit_stamp;
+
+    ae_bool_t always;
+} aeMovieNodeInterval;
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieNodeIntervalIndex
+{
+    ae_uint32_t offset;
+    ae_uint32_t count;
+
+    ae_uint32_t * in_order;
+    ae_uint32_t * out_order;
+    ae_uint32_t * alive;
+    ae_uint32_t * active;
+    ae_uint32_t * visit;
+
+    ae_uint32_t in_cursor;
+    ae_uint32_t out_cursor;
+    ae_uint32_t alive_count;
+    ae_uint32_t active_count;
+    ae_uint32_t visit_stamp;
+
+    ae_float_t sweep_time;
+    ae_bool_t sweep_valid;
+} aeMovieNodeIntervalIndex;
 //////////////////////////////////////////////////////////////////////////
 struct aeMovieComposition
 {
@@ -221,7 +308,17 @@ struct aeMovieComposition
 
     ae_uint32_t node_count;
     aeMovieNode * nodes;
+    aeMovieNodeSampling * node_samplings;
+    aeMovieNodeCold * node_colds;
+    aeMovieNodeGeometry * node_geometries;
     aeMovieNode ** update_nodes;
+    ae_uint32_t * update_node_enumerators;
+    ae_uint32_t * update_node_deeps;
+    ae_uint32_t update_node_count;
+
+    aeMovieNodeInterval * update_node_intervals;
+    ae_uint32_t * update_node_interval_orders;
+    aeMovieNodeIntervalIndex * update_node_interval_indices;
 
     aeMovieNode * scene_effect_node;
     ae_userdata_t scene_effect_userdata;
@@ -233,6 +330,11 @@ struct aeMovieComposition
     ae_userdata_t provider_userdata;
 };
 //////////////////////////////////////////////////////////////////////////
+struct aeMovieCompositionTemplate
+{
+    aeMovieComposition * composition;
+};
+//////////////////////////////////////////////////////////////////////////
 typedef struct aeMovieCompositionCameraImuttable
 {
     ae_float_t target_x;
@@ -275,6 +377,41 @@ struct aeMovieCompositionCamera
     aeMovieCompositionCameraTimeline * timeline;
 };
 //////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieCompositionMatrixCacheEntry
+{
+    ae_uint32_t * slot;
+    ae_matrix34_t matrix;
+} aeMovieCompositionMatrixCacheEntry;
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieCompositionMatrixCache
+{
+    ae_uint32_t capacity;
+    ae_uint32_t count;
+    ae_uint32_t evict;
+
+    ae_uint32_t * layer_offsets;
+    ae_uint32_t * slots;
+    aeMovieCompositionMatrixCacheEntry * entries;
+
+    ae_uint32_t hits;
+    ae_uint32_t misses;
+    ae_uint32_t evictions;
+} aeMovieCompositionMatrixCache;
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieCompositionNameEntry
+{
+    ae_uint32_t hash;
+    ae_uint32_t node_index;
+    ae_uint32_t subcomposition_index;
+} aeMovieCompositionNameEntry;
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieCompositionNameIndex
+{
+    ae_uint32_t bucket_mask;
+    ae_uint32_t * buckets;
+    aeMovieCompositionNameEntry * entries;
+} aeMovieCompositionNameIndex;
+//////////////////////////////////////////////////////////////////////////
 struct aeMovieCompositionData
 {
     ae_string_t name;
@@ -301,6 +438,10 @@ struct aeMovieCompositionData
 
     ae_uint32_t layer_count;
     const aeMovieLayerData * layers;
+
+    aeMovieCompositionMatrixCache * matrix_cache;
+
+    aeMovieCompositionNameIndex name_index;
 };
 //////////////////////////////////////////////////////////////////////////
 struct aeMovieData
@@ -322,6 +463,9 @@ struct aeMovieData
 
     ae_uint32_t composition_count;
     const aeMovieCompositionData * compositions;
+
+    //compositions and templates created from this data and not deleted yet, timelines can't be baked under them
+    ae_uint32_t composition_live_count;
 };
 //////////////////////////////////////////////////////////////////////////
 struct aeMovieLayerData
@@ -512,6 +656,16 @@ struct aeMovieLayerCache
     ae_userdata_t * mesh_uv_cache_userdata;
 };
 //////////////////////////////////////////////////////////////////////////
+//strided destination for render vertices, plain arrays or an interleaved vertex buffer
+typedef struct aeMovieRenderVertexStream
+{
+    ae_uint8_t * position;
+    ae_uint32_t position_stride;
+
+    ae_uint8_t * uv;
+    ae_uint32_t uv_stride;
+} aeMovieRenderVertexStream;
+//////////////////////////////////////////////////////////////////////////
 #define AE_RESULT( Function, Args ) { ae_result_t result = (Function) Args; if( result != AE_RESULT_SUCCESSFUL ) { return result;}}
 #define AE_SUCCESSFUL( Function, Args ) { ae_bool_t successful = (Function) Args; if( successful == AE_FALSE ) {return AE_FALSE;}}
 #define AE_RESULT_PANIC_MEMORY( Memory ) AE_MOVIE_PANIC_MEMORY( Memory, AE_RESULT_INVALID_MEMORY )
@@ -33,20 +33,94 @@
 #include "movie_math.h"
 
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __unhash_movie_layer_transformation_timeline( const aeMovieInstance * _instance, ae_uint32_t _iterator, ae_voidptr_t _timeline, ae_uint32_t _size )
+AE_INTERNAL ae_void_t __unhash_movie_layer_transformation_timeline( const aeMovieInstance * _instance, ae_uint32_t _iterator, ae_uint32_t * _timeline, ae_uint32_t _count )
 {
-    const ae_uint32_t * hashmask = _instance->hashmask;
+    //mask window rotated to the timeline start, period of five words
+    const ae_uint32_t * hashmask = _instance->hashmask_repeat + (_iterator % 5U);
 
-    ae_uint32_t * it_timeline = (ae_uint32_t *)_timeline;
-    ae_uint32_t * it_timeline_end = (ae_uint32_t *)_timeline + (_size >> 2);
-    for( ; it_timeline != it_timeline_end; ++it_timeline )
+    ae_uint32_t hashmask0 = hashmask[0];
+    ae_uint32_t hashmask1 = hashmask[1];
+    ae_uint32_t hashmask2 = hashmask[2];
+    ae_uint32_t hashmask3 = hashmask[3];
+    ae_uint32_t hashmask4 = hashmask[4];
+
+    ae_uint32_t count_period = _count - _count % 5U;
+
+    ae_uint32_t index = 0U;
+
+    for( ; index != count_period; index += 5U )
+    {
+        _timeline[index + 0] ^= hashmask0;
+        _timeline[index + 1] ^= hashmask1;
+        _timeline[index + 2] ^= hashmask2;
+        _timeline[index + 3] ^= hashmask3;
+        _timeline[index + 4] ^= hashmask4;
+    }
+
+    for( ; index != _count; ++index )
+    {
+        _timeline[index] ^= hashmask[index - count_period];
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct aeMovieLayerTransformationTimelineSeek
+{
+    ae_uint32_t index;
+    ae_uint32_t offset;
+} aeMovieLayerTransformationTimelineSeek;
+//////////////////////////////////////////////////////////////////////////
+static const ae_uint32_t property_block_offset_static[3] = {1U, 3U, 2U};
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __get_movie_layer_transformation_timeline_seek_capacity( ae_uint32_t _blockCount )
+{
+    if( _blockCount < AE_MOVIE_TIMELINE_SEEK_MIN_BLOCKS )
     {
-        ae_uint32_t hashmask_index = (_iterator++) % 5U;
+        return 0U;
+    }
+
+    ae_uint32_t seek_capacity = (_blockCount + AE_MOVIE_TIMELINE_SEEK_STRIDE - 1U) / AE_MOVIE_TIMELINE_SEEK_STRIDE;
+
+    return seek_capacity;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_uint32_t __make_movie_layer_transformation_timeline_seek( aeMovieLayerTransformationTimelineSeek * _seeks, const ae_uint32_t * _stream, ae_uint32_t _count )
+{
+    ae_uint32_t block_count = 0U;
+    ae_uint32_t seek_count = 0U;
+
+    ae_uint32_t property_index = 0U;
+
+    //one entry every AE_MOVIE_TIMELINE_SEEK_STRIDE blocks, sampling walks the rest
+    const ae_uint32_t * it_stream = _stream;
+    const ae_uint32_t * it_stream_end = _stream + _count;
+    while( it_stream < it_stream_end )
+    {
+        if( block_count % AE_MOVIE_TIMELINE_SEEK_STRIDE == 0U )
+        {
+            aeMovieLayerTransformationTimelineSeek * seek = _seeks + seek_count++;
+
+            seek->index = property_index;
+            seek->offset = (ae_uint32_t)(it_stream - _stream);
+        }
+
+        ae_uint32_t zp_block_type_count_data = *(it_stream++);
 
-        ae_uint32_t hash = hashmask[hashmask_index];
+        ae_uint32_t zp_block_type = zp_block_type_count_data >> 24U;
+        ae_uint32_t zp_block_count = zp_block_type_count_data & 0x00FFFFFF;
 
-        *it_timeline ^= hash;
+        it_stream += (zp_block_type == 3U) ? zp_block_count : property_block_offset_static[zp_block_type & 3U];
+
+        property_index += zp_block_count;
+
+        ++block_count;
     }
+
+    if( block_count < AE_MOVIE_TIMELINE_SEEK_MIN_BLOCKS )
+    {
+        return 0U;
+    }
+
+    return seek_count;
 }
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_constvoidptr_t __load_movie_layer_transformation_timeline( aeMovieStream * _stream, const ae_char_t * _doc )
@@ -58,20 +132,90 @@ AE_INTERNAL ae_constvoidptr_t __load_movie_layer_transformation_timeline( aeMovi
 
     ae_uint32_t hashmask_iterator = AE_READ8( _stream );
 
-    ae_voidptr_t timeline = AE_NEWV( _stream->instance, size, _doc );
+    const aeMovieInstance * instance = _stream->instance;
+
+    ae_uint32_t count = size >> 2;
+
+    //seek count, word count, the blocks, then the seek table sized for the most blocks, each is at least two words
+    ae_uint32_t seek_capacity = __get_movie_layer_transformation_timeline_seek_capacity( count >> 1U );
+
+    ae_size_t timeline_size = sizeof( ae_uint32_t ) * 2U + size + sizeof( aeMovieLayerTransformationTimelineSeek ) * seek_capacity;
+
+    ae_uint32_t * timeline = (ae_uint32_t *)AE_NEWV( instance, timeline_size, _doc );
 
     AE_MOVIE_PANIC_MEMORY( timeline, AE_NULLPTR );
 
-    AE_READV( _stream, timeline, (ae_size_t)size );
+    ae_uint32_t * timeline_stream = timeline + 2;
+
+    AE_READV( _stream, timeline_stream, (ae_size_t)size );
+
+    if( instance->use_hash == AE_TRUE )
+    {
+        __unhash_movie_layer_transformation_timeline( instance, hashmask_iterator, timeline_stream, count );
+    }
+
+    timeline[0] = 0U;
+    timeline[1] = count;
 
-    if( _stream->instance->use_hash == AE_TRUE )
+    if( seek_capacity != 0U )
     {
-        __unhash_movie_layer_transformation_timeline( _stream->instance, hashmask_iterator, timeline, size );
+        aeMovieLayerTransformationTimelineSeek * seeks = (aeMovieLayerTransformationTimelineSeek *)(ae_voidptr_t)(timeline_stream + count);
+
+        timeline[0] = __make_movie_layer_transformation_timeline_seek( seeks, timeline_stream, count );
     }
 
     return timeline;
 }
 //////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const ae_uint32_t * __get_movie_layer_transformation_property_stream( ae_constvoidptr_t _property )
+{
+    const ae_uint32_t * property_ae_uint32_t = (const ae_uint32_t *)_property;
+
+    return property_ae_uint32_t + 2U;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const ae_uint32_t * __seek_movie_layer_transformation_property( ae_constvoidptr_t _property, ae_uint32_t _index, ae_uint32_t * _propertyIndex )
+{
+    const ae_uint32_t * property_ae_uint32_t = (const ae_uint32_t *)_property;
+
+    ae_uint32_t seek_count = property_ae_uint32_t[0];
+    ae_uint32_t stream_count = property_ae_uint32_t[1];
+
+    const ae_uint32_t * property_stream = property_ae_uint32_t + 2U;
+
+    if( seek_count == 0U )
+    {
+        *_propertyIndex = 0U;
+
+        return property_stream;
+    }
+
+    const aeMovieLayerTransformationTimelineSeek * seeks = (const aeMovieLayerTransformationTimelineSeek *)(ae_constvoidptr_t)(property_stream + stream_count);
+
+    ae_uint32_t seek_begin = 0U;
+    ae_uint32_t seek_end = seek_count;
+
+    while( seek_end - seek_begin > 1U )
+    {
+        ae_uint32_t seek_middle = (seek_begin + seek_end) >> 1U;
+
+        if( seeks[seek_middle].index <= _index )
+        {
+            seek_begin = seek_middle;
+        }
+        else
+        {
+            seek_end = seek_middle;
+        }
+    }
+
+    const aeMovieLayerTransformationTimelineSeek * seek = seeks + seek_begin;
+
+    *_propertyIndex = seek->index;
+
+    return property_stream + seek->offset;
+}
+//////////////////////////////////////////////////////////////////////////
 static const ae_float_t one_div_index256[] =
 {0.f, 1.f / 1.f, 1.f / 2.f, 1.f / 3.f, 1.f / 4.f, 1.f / 5.f, 1.f / 6.f, 1.f / 7.f, 1.f / 8.f, 1.f / 9.f
 , 1.f / 10.f, 1.f / 11.f, 1.f / 12.f, 1.f / 13.f, 1.f / 14.f, 1.f / 15.f, 1.f / 16.f, 1.f / 17.f, 1.f / 18.f, 1.f / 19.f
@@ -128,15 +272,15 @@ static const ae_float_t index256_to_float[] =
 , 240.f, 241.f, 242.f, 243.f, 244.f, 245.f, 246.f, 247.f, 248.f, 249.f
 , 250.f, 251.f, 252.f, 253.f, 254.f, 255.f, 256.f, 257.f, 258.f, 259.f};
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_fixed( ae_constvoidptr_t _property, ae_uint32_t _index )
+AE_INTERNAL const ae_uint32_t * __walk_movie_layer_transformation_property( const ae_uint32_t * _block, ae_uint32_t * _propertyIndex, ae_uint32_t _index )
 {
     ae_uint32_t property_block_offset[4] = {1U, 3U, 2U, 0U};
 
-    ae_uint32_t property_index = 0U;
+    ae_uint32_t property_index = *_propertyIndex;
 
-    const ae_uint32_t * property_ae_uint32_t = (const ae_uint32_t *)_property;
+    const ae_uint32_t * property_ae_uint32_t = _block;
 
-    ae_uint32_t zp_block_type_count_data = *(property_ae_uint32_t++);
+    ae_uint32_t zp_block_type_count_data = *property_ae_uint32_t;
 
     ae_uint32_t zp_block_type = zp_block_type_count_data >> 24U;
     ae_uint32_t zp_block_count = zp_block_type_count_data & 0x00FFFFFF;
@@ -145,17 +289,29 @@ AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_fixed( ae_const
     {
         property_block_offset[3] = zp_block_count;
 
-        property_ae_uint32_t += property_block_offset[zp_block_type];
+        property_ae_uint32_t += property_block_offset[zp_block_type] + 1U;
 
         property_index += zp_block_count;
 
-        ae_uint32_t zp_block_type_count_data_next = *(property_ae_uint32_t++);
+        ae_uint32_t zp_block_type_count_data_next = *property_ae_uint32_t;
 
         zp_block_type = zp_block_type_count_data_next >> 24U;
         zp_block_count = zp_block_type_count_data_next & 0x00FFFFFF;
     }
 
-    const ae_float_t * property_ae_float_t = (const ae_float_t *)(ae_constvoidptr_t)(property_ae_uint32_t);
+    *_propertyIndex = property_index;
+
+    return property_ae_uint32_t;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_float_t __decode_movie_layer_transformation_property( const ae_uint32_t * _block, ae_uint32_t _propertyIndex, ae_uint32_t _index )
+{
+    ae_uint32_t zp_block_type_count_data = *_block;
+
+    ae_uint32_t zp_block_type = zp_block_type_count_data >> 24U;
+    ae_uint32_t zp_block_count = zp_block_type_count_data & 0x00FFFFFF;
+
+    const ae_float_t * property_ae_float_t = (const ae_float_t *)(ae_constvoidptr_t)(_block + 1);
 
     switch( zp_block_type )
     {
@@ -171,7 +327,7 @@ AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_fixed( ae_const
             ae_float_t block_begin = property_ae_float_t[1];
             ae_float_t block_end = property_ae_float_t[2];
 
-            ae_uint32_t block_index = _index - property_index;
+            ae_uint32_t block_index = _index - _propertyIndex;
             ae_float_t block_index_f = (ae_float_t)block_index;
 
             ae_float_t block_t = block_index_f * block_inv;
@@ -187,7 +343,7 @@ AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_fixed( ae_const
 
             const ae_float_t block_inv = one_div_index256[zp_block_count - 1];
 
-            ae_uint32_t block_index = _index - property_index;
+            ae_uint32_t block_index = _index - _propertyIndex;
             const ae_float_t block_index_f = index256_to_float[block_index];
 
             ae_float_t block_t = block_index_f * block_inv;
@@ -198,7 +354,7 @@ AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_fixed( ae_const
         }break;
     case 3:
         {
-            ae_uint32_t block_index = _index - property_index;
+            ae_uint32_t block_index = _index - _propertyIndex;
 
             ae_float_t block_value = property_ae_float_t[block_index];
 
@@ -217,9 +373,105 @@ AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_fixed( ae_const
     return 0.f;
 }
 //////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_fixed( ae_constvoidptr_t _property, ae_uint32_t _index )
+{
+    ae_uint32_t property_index;
+
+    const ae_uint32_t * property_seek = __seek_movie_layer_transformation_property( _property, _index, &property_index );
+
+    const ae_uint32_t * property_block = __walk_movie_layer_transformation_property( property_seek, &property_index, _index );
+
+    ae_float_t value = __decode_movie_layer_transformation_property( property_block, property_index, _index );
+
+    return value;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __decode_movie_layer_transformation_property2( const ae_uint32_t * _block, ae_uint32_t _propertyIndex, ae_uint32_t _index, ae_float_t * _value0, ae_float_t * _value1 )
+{
+    ae_uint32_t zp_block_count = *_block & 0x00FFFFFF;
+
+    *_value0 = __decode_movie_layer_transformation_property( _block, _propertyIndex, _index );
+
+    if( _index + 1U < _propertyIndex + zp_block_count )
+    {
+        *_value1 = __decode_movie_layer_transformation_property( _block, _propertyIndex, _index + 1U );
+
+        return;
+    }
+
+    ae_uint32_t property_index_next = _propertyIndex;
+
+    const ae_uint32_t * property_block_next = __walk_movie_layer_transformation_property( _block, &property_index_next, _index + 1U );
+
+    *_value1 = __decode_movie_layer_transformation_property( property_block_next, property_index_next, _index + 1U );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __get_movie_layer_transformation_property_fixed2( ae_constvoidptr_t _property, ae_uint32_t _index, ae_float_t * _value0, ae_float_t * _value1 )
+{
+    ae_uint32_t property_index;
+
+    const ae_uint32_t * property_seek = __seek_movie_layer_transformation_property( _property, _index, &property_index );
+
+    const ae_uint32_t * property_block = __walk_movie_layer_transformation_property( property_seek, &property_index, _index );
+
+    __decode_movie_layer_transformation_property2( property_block, property_index, _index, _value0, _value1 );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL const ae_uint32_t * __cursor_movie_layer_transformation_property( ae_constvoidptr_t _property, aeMovieLayerTransformationCursor * _cursor, ae_uint32_t _index, ae_uint32_t * _propertyIndex )
+{
+    const ae_uint32_t * property_stream = __get_movie_layer_transformation_property_stream( _property );
+
+    ae_uint32_t property_index = _cursor->index;
+
+    const ae_uint32_t * property_seek = property_stream + _cursor->offset;
+
+    if( _index < property_index )
+    {
+        property_seek = __seek_movie_layer_transformation_property( _property, _index, &property_index );
+    }
+    else if( _index - property_index > AE_MOVIE_TIMELINE_CURSOR_MAX_JUMP )
+    {
+        ae_uint32_t zp_block_count = *property_seek & 0x00FFFFFF;
+
+        if( _index >= property_index + zp_block_count )
+        {
+            property_seek = __seek_movie_layer_transformation_property( _property, _index, &property_index );
+        }
+    }
+
+    const ae_uint32_t * property_block = __walk_movie_layer_transformation_property( property_seek, &property_index, _index );
+
+    _cursor->offset = (ae_uint32_t)(property_block - property_stream);
+    _cursor->index = property_index;
+
+    *_propertyIndex = property_index;
+
+    return property_block;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_cursor( ae_constvoidptr_t _property, aeMovieLayerTransformationCursor * _cursor, ae_uint32_t _index )
+{
+    ae_uint32_t property_index;
+
+    const ae_uint32_t * property_block = __cursor_movie_layer_transformation_property( _property, _cursor, _index, &property_index );
+
+    ae_float_t value = __decode_movie_layer_transformation_property( property_block, property_index, _index );
+
+    return value;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_void_t __get_movie_layer_transformation_property_cursor2( ae_constvoidptr_t _property, aeMovieLayerTransformationCursor * _cursor, ae_uint32_t _index, ae_float_t * _value0, ae_float_t * _value1 )
+{
+    ae_uint32_t property_index;
+
+    const ae_uint32_t * property_block = __cursor_movie_layer_transformation_property( _property, _cursor, _index, &property_index );
+
+    __decode_movie_layer_transformation_property2( property_block, property_index, _index, _value0, _value1 );
+}
+//////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_initial( ae_constvoidptr_t _property )
 {
-    const ae_uint32_t * property_ae_uint32_t = (const ae_uint32_t *)_property;
+    const ae_uint32_t * property_ae_uint32_t = __get_movie_layer_transformation_property_stream( _property );
 
     ae_uint32_t zp_block_type_count_data = *(property_ae_uint32_t++);
 
@@ -272,8 +524,31 @@ AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_initial( ae_con
 //////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_interpolate( ae_constvoidptr_t _property, ae_uint32_t _index, ae_float_t _t )
 {
-    ae_float_t data_0 = __get_movie_layer_transformation_property_fixed( _property, _index + 0 );
-    ae_float_t data_1 = __get_movie_layer_transformation_property_fixed( _property, _index + 1 );
+    ae_float_t data_0;
+    ae_float_t data_1;
+    __get_movie_layer_transformation_property_fixed2( _property, _index, &data_0, &data_1 );
+
+    //equal neighbours keep the exact value whatever t, constant blocks reuse it
+    if( data_0 == data_1 )
+    {
+        return data_0;
+    }
+
+    ae_float_t data = ae_linerp_f1( data_0, data_1, _t );
+
+    return data;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_float_t __get_movie_layer_transformation_property_interpolate_cursor( ae_constvoidptr_t _property, aeMovieLayerTransformationCursor * _cursor, ae_uint32_t _index, ae_float_t _t )
+{
+    ae_float_t data_0;
+    ae_float_t data_1;
+    __get_movie_layer_transformation_property_cursor2( _property, _cursor, _index, &data_0, &data_1 );
+
+    if( data_0 == data_1 )
+    {
+        return data_0;
+    }
 
     ae_float_t data = ae_linerp_f1( data_0, data_1, _t );
 
@@ -438,31 +713,35 @@ AE_INTERNAL ae_result_t __load_movie_layer_transformation3d( aeMovieStream * _st
     return AE_RESULT_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation_interpolate_identity( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation_interpolate_identity( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     AE_UNUSED( _out );
     AE_UNUSED( _transformation );
+    AE_UNUSED( _cursors );
     AE_UNUSED( _index );
     AE_UNUSED( _t );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation_fixed_identity( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation_fixed_identity( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     AE_UNUSED( _out );
     AE_UNUSED( _transformation );
+    AE_UNUSED( _cursors );
     AE_UNUSED( _index );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation_interpolate_immutable( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation_interpolate_immutable( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
+    AE_UNUSED( _cursors );
     AE_UNUSED( _index );
     AE_UNUSED( _t );
 
     ae_copy_m34( _out, *_transformation->immutable_matrix );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation_fixed_immutable( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation_fixed_immutable( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
+    AE_UNUSED( _cursors );
     AE_UNUSED( _index );
 
     ae_copy_m34( _out, *_transformation->immutable_matrix );
@@ -478,7 +757,27 @@ AE_CALLBACK ae_void_t __make_layer_transformation_fixed_immutable( ae_matrix34_t
 		Transformation->timeline->Name,\
 		_index + Index )
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+#define AE_INTERPOLATE_CURSOR_PROPERTY( Transformation, Name, OutName )\
+	OutName = (Transformation->timeline == AE_NULLPTR || Transformation->timeline->Name == AE_NULLPTR) ? Transformation->immutable.Name : __get_movie_layer_transformation_property_interpolate_cursor(\
+		Transformation->timeline->Name,\
+		&_cursors->Name,\
+		_index, _t )
+//////////////////////////////////////////////////////////////////////////
+#define AE_FIXED_CURSOR_PROPERTY( Transformation, Name, Index, OutName)\
+	OutName = (Transformation->timeline == AE_NULLPTR || Transformation->timeline->Name == AE_NULLPTR) ? Transformation->immutable.Name : __get_movie_layer_transformation_property_cursor(\
+		Transformation->timeline->Name,\
+		&_cursors->Name,\
+		_index + Index )
+//////////////////////////////////////////////////////////////////////////
+#define AE_FIXED2_PROPERTY( Transformation, Name, OutName0, OutName1 )\
+	if( Transformation->timeline == AE_NULLPTR || Transformation->timeline->Name == AE_NULLPTR ) { OutName0 = Transformation->immutable.Name; OutName1 = Transformation->immutable.Name; }\
+	else { __get_movie_layer_transformation_property_fixed2( Transformation->timeline->Name, _index, &OutName0, &OutName1 ); }
+//////////////////////////////////////////////////////////////////////////
+#define AE_FIXED2_CURSOR_PROPERTY( Transformation, Name, OutName0, OutName1 )\
+	if( Transformation->timeline == AE_NULLPTR || Transformation->timeline->Name == AE_NULLPTR ) { OutName0 = Transformation->immutable.Name; OutName1 = Transformation->immutable.Name; }\
+	else { __get_movie_layer_transformation_property_cursor2( Transformation->timeline->Name, &_cursors->Name, _index, &OutName0, &OutName1 ); }
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -488,33 +787,30 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate( ae_matrix34_t _
     ae_quaternionzw_t quaternion;
     ae_skew_t skew;
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_y, position[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_y, scale[1] );
 
     ae_quaternionzw_t q1;
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 0, q1[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 0, q1[1] );
-
     ae_quaternionzw_t q2;
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 1, q2[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 1, q2[1] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation2d, quaternion_z, q1[0], q2[0] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation2d, quaternion_w, q1[1], q2[1] );
 
     ae_linerp_qzw( quaternion, q1, q2, _t );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew, skew[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew_quaternion_z, skew[1] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew_quaternion_w, skew[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew, skew[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_z, skew[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_w, skew[2] );
 
     ae_movie_make_transformation2d_m34( _out, position, anchor_point, scale, quaternion, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_fq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_fq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -524,26 +820,26 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_fq( ae_matrix34_
     ae_quaternionzw_t quaternion;
     ae_skew_t skew;
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_y, position[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_y, scale[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew, skew[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew_quaternion_z, skew[1] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew_quaternion_w, skew[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew, skew[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_z, skew[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_w, skew[2] );
 
     ae_movie_make_transformation2d_m34( _out, position, anchor_point, scale, quaternion, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __make_layer_transformation2d_interpolate_wskfq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_INTERNAL ae_void_t __make_layer_transformation2d_interpolate_wskfq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -552,22 +848,22 @@ AE_INTERNAL ae_void_t __make_layer_transformation2d_interpolate_wskfq( ae_matrix
     ae_vector2_t scale;
     ae_quaternionzw_t quaternion;
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_y, position[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_y, scale[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
 
     ae_movie_make_transformation2d_m34wsk( _out, position, anchor_point, scale, quaternion );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_INTERNAL ae_void_t __make_layer_transformation2d_fixed( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_INTERNAL ae_void_t __make_layer_transformation2d_fixed( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -577,26 +873,26 @@ AE_INTERNAL ae_void_t __make_layer_transformation2d_fixed( ae_matrix34_t _out, c
     ae_quaternionzw_t quaternion;
     ae_skew_t skew;
 
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation2d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_y, 0, position[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation2d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_y, 0, scale[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, skew, 0, skew[0] );
-    AE_FIXED_PROPERTY( transformation2d, skew_quaternion_z, 0, skew[1] );
-    AE_FIXED_PROPERTY( transformation2d, skew_quaternion_w, 0, skew[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, skew, 0, skew[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, skew_quaternion_z, 0, skew[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, skew_quaternion_w, 0, skew[2] );
 
     ae_movie_make_transformation2d_m34( _out, position, anchor_point, scale, quaternion, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -605,23 +901,23 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wq( ae_matrix34_
     ae_vector2_t scale;
     ae_skew_t skew;
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_y, position[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_y, scale[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew, skew[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew_quaternion_z, skew[1] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, skew_quaternion_w, skew[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew, skew[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_z, skew[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_w, skew[2] );
 
     ae_movie_make_transformation2d_m34wq( _out, position, anchor_point, scale, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -630,23 +926,23 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wq( ae_matrix34_t _out
     ae_vector2_t scale;
     ae_skew_t skew;
 
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation2d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_y, 0, position[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation2d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_y, 0, scale[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, skew, 0, skew[0] );
-    AE_FIXED_PROPERTY( transformation2d, skew_quaternion_z, 0, skew[1] );
-    AE_FIXED_PROPERTY( transformation2d, skew_quaternion_w, 0, skew[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, skew, 0, skew[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, skew_quaternion_z, 0, skew[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, skew_quaternion_w, 0, skew[2] );
 
     ae_movie_make_transformation2d_m34wq( _out, position, anchor_point, scale, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -654,19 +950,19 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wskq( ae_matrix3
     ae_vector2_t position;
     ae_vector2_t scale;
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_y, position[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_y, scale[1] );
 
     ae_movie_make_transformation2d_m34wskq( _out, position, anchor_point, scale );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -674,19 +970,19 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wskq( ae_matrix34_t _o
     ae_vector2_t position;
     ae_vector2_t scale;
 
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation2d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_y, 0, position[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation2d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_y, 0, scale[1] );
 
     ae_movie_make_transformation2d_m34wskq( _out, position, anchor_point, scale );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -695,29 +991,26 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_interpolate_wsk( ae_matrix34
     ae_vector2_t scale;
     ae_quaternionzw_t quaternion;
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_y, anchor_point[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_y, position[1] );
 
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation2d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_y, scale[1] );
 
     ae_quaternionzw_t q1;
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 0, q1[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 0, q1[1] );
-
     ae_quaternionzw_t q2;
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 1, q2[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 1, q2[1] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation2d, quaternion_z, q1[0], q2[0] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation2d, quaternion_w, q1[1], q2[1] );
 
     ae_linerp_qzw( quaternion, q1, q2, _t );
 
     ae_movie_make_transformation2d_m34wsk( _out, position, anchor_point, scale, quaternion );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
 
@@ -726,22 +1019,22 @@ AE_CALLBACK ae_void_t __make_layer_transformation2d_fixed_wsk( ae_matrix34_t _ou
     ae_vector2_t scale;
     ae_quaternionzw_t quaternion;
 
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_y, 0, anchor_point[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation2d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, position_y, 0, position[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation2d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_y, 0, scale[1] );
 
-    AE_FIXED_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_z, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_w, 0, quaternion[1] );
 
     ae_movie_make_transformation2d_m34wsk( _out, position, anchor_point, scale, quaternion );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -751,31 +1044,31 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed( ae_matrix34_t _out, c
     ae_quaternion_t quaternion;
     ae_skew_t skew;
 
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation3d, position_y, 0, position[1] );
-    AE_FIXED_PROPERTY( transformation3d, position_z, 0, position[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_z, 0, position[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation3d, scale_y, 0, scale[1] );
-    AE_FIXED_PROPERTY( transformation3d, scale_z, 0, scale[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_z, 0, scale[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
 
-    AE_FIXED_PROPERTY( transformation3d, skew, 0, skew[0] );
-    AE_FIXED_PROPERTY( transformation3d, skew_quaternion_z, 0, skew[1] );
-    AE_FIXED_PROPERTY( transformation3d, skew_quaternion_w, 0, skew[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, skew, 0, skew[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, skew_quaternion_z, 0, skew[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, skew_quaternion_w, 0, skew[2] );
 
     ae_movie_make_transformation3d_m34( _out, position, anchor_point, scale, quaternion, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -784,26 +1077,26 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wq( ae_matrix34_t _out
     ae_vector3_t scale;
     ae_skew_t skew;
 
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation3d, position_y, 0, position[1] );
-    AE_FIXED_PROPERTY( transformation3d, position_z, 0, position[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_z, 0, position[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation3d, scale_y, 0, scale[1] );
-    AE_FIXED_PROPERTY( transformation3d, scale_z, 0, scale[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_z, 0, scale[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, skew, 0, skew[0] );
-    AE_FIXED_PROPERTY( transformation3d, skew_quaternion_z, 0, skew[1] );
-    AE_FIXED_PROPERTY( transformation3d, skew_quaternion_w, 0, skew[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, skew, 0, skew[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, skew_quaternion_z, 0, skew[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, skew_quaternion_w, 0, skew[2] );
 
     ae_movie_make_transformation3d_m34wq( _out, position, anchor_point, scale, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -812,26 +1105,26 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wq( ae_matrix34_
     ae_vector3_t scale;
     ae_skew_t skew;
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_y, position[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_z, position[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_z, position[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_y, scale[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_z, scale[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_z, scale[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew, skew[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew_quaternion_z, skew[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew_quaternion_w, skew[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew, skew[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew_quaternion_z, skew[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew_quaternion_w, skew[2] );
 
     ae_movie_make_transformation3d_m34wq( _out, position, anchor_point, scale, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -839,22 +1132,22 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wskq( ae_matrix3
     ae_vector3_t position;
     ae_vector3_t scale;
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_y, position[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_z, position[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_z, position[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_y, scale[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_z, scale[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_z, scale[2] );
 
     ae_movie_make_transformation3d_m34wskq( _out, position, anchor_point, scale );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wskq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -862,22 +1155,22 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wskq( ae_matrix34_t _o
     ae_vector3_t position;
     ae_vector3_t scale;
 
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation3d, position_y, 0, position[1] );
-    AE_FIXED_PROPERTY( transformation3d, position_z, 0, position[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_z, 0, position[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation3d, scale_y, 0, scale[1] );
-    AE_FIXED_PROPERTY( transformation3d, scale_z, 0, scale[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_z, 0, scale[2] );
 
     ae_movie_make_transformation3d_m34wskq( _out, position, anchor_point, scale );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -886,36 +1179,31 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wsk( ae_matrix34
     ae_vector3_t scale;
     ae_quaternion_t quaternion;
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_y, position[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_z, position[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_z, position[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_y, scale[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_z, scale[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_z, scale[2] );
 
     ae_quaternion_t q1;
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 0, q1[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 0, q1[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 0, q1[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 0, q1[3] );
-
     ae_quaternion_t q2;
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 1, q2[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 1, q2[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 1, q2[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 1, q2[3] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_x, q1[0], q2[0] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_y, q1[1], q2[1] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_z, q1[2], q2[2] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_w, q1[3], q2[3] );
 
     ae_linerp_q( quaternion, q1, q2, _t );
 
     ae_movie_make_transformation3d_m34wsk( _out, position, anchor_point, scale, quaternion );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wskfq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wskfq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -924,27 +1212,27 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_wskfq( ae_matrix
     ae_vector3_t scale;
     ae_quaternion_t quaternion;
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_y, position[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_z, position[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_z, position[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_y, scale[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_z, scale[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_z, scale[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
 
     ae_movie_make_transformation3d_m34wsk( _out, position, anchor_point, scale, quaternion );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wsk( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -953,27 +1241,27 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_fixed_wsk( ae_matrix34_t _ou
     ae_vector3_t scale;
     ae_quaternion_t quaternion;
 
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
-    AE_FIXED_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_x, 0, anchor_point[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_y, 0, anchor_point[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, anchor_point_z, 0, anchor_point[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, position_x, 0, position[0] );
-    AE_FIXED_PROPERTY( transformation3d, position_y, 0, position[1] );
-    AE_FIXED_PROPERTY( transformation3d, position_z, 0, position[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_x, 0, position[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_y, 0, position[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, position_z, 0, position[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, scale_x, 0, scale[0] );
-    AE_FIXED_PROPERTY( transformation3d, scale_y, 0, scale[1] );
-    AE_FIXED_PROPERTY( transformation3d, scale_z, 0, scale[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_x, 0, scale[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_y, 0, scale[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, scale_z, 0, scale[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
 
     ae_movie_make_transformation3d_m34wsk( _out, position, anchor_point, scale, quaternion );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_fq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_fq( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -983,31 +1271,31 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate_fq( ae_matrix34_
     ae_quaternion_t quaternion;
     ae_skew_t skew;
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_y, position[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_z, position[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_z, position[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_y, scale[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_z, scale[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_z, scale[2] );
 
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_x, 0, quaternion[0] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_y, 0, quaternion[1] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_z, 0, quaternion[2] );
+    AE_FIXED_CURSOR_PROPERTY( transformation3d, quaternion_w, 0, quaternion[3] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew, skew[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew_quaternion_z, skew[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew_quaternion_w, skew[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew, skew[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew_quaternion_z, skew[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew_quaternion_w, skew[2] );
 
     ae_movie_make_transformation3d_m34( _out, position, anchor_point, scale, quaternion, skew );
 }
 //////////////////////////////////////////////////////////////////////////
-AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t )
+AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t )
 {
     const aeMovieLayerTransformation3D * transformation3d = (const aeMovieLayerTransformation3D *)_transformation;
 
@@ -1017,35 +1305,30 @@ AE_CALLBACK ae_void_t __make_layer_transformation3d_interpolate( ae_matrix34_t _
     ae_quaternion_t quaternion;
     ae_skew_t skew;
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_x, anchor_point[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_y, anchor_point[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, anchor_point_z, anchor_point[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_x, position[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_y, position[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, position_z, position[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_x, position[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_y, position[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, position_z, position[2] );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_x, scale[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_y, scale[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, scale_z, scale[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_x, scale[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_y, scale[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, scale_z, scale[2] );
 
     ae_quaternion_t q1;
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 0, q1[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 0, q1[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 0, q1[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 0, q1[3] );
-
     ae_quaternion_t q2;
-    AE_FIXED_PROPERTY( transformation3d, quaternion_x, 1, q2[0] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_y, 1, q2[1] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_z, 1, q2[2] );
-    AE_FIXED_PROPERTY( transformation3d, quaternion_w, 1, q2[3] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_x, q1[0], q2[0] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_y, q1[1], q2[1] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_z, q1[2], q2[2] );
+    AE_FIXED2_CURSOR_PROPERTY( transformation3d, quaternion_w, q1[3], q2[3] );
 
     ae_linerp_q( quaternion, q1, q2, _t );
 
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew, skew[0] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew_quaternion_z, skew[1] );
-    AE_INTERPOLATE_PROPERTY( transformation3d, skew_quaternion_w, skew[2] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew, skew[0] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew_quaternion_z, skew[1] );
+    AE_INTERPOLATE_CURSOR_PROPERTY( transformation3d, skew_quaternion_w, skew[2] );
 
     ae_movie_make_transformation3d_m34( _out, position, anchor_point, scale, quaternion, skew );
 }
@@ -1323,6 +1606,27 @@ ae_result_t ae_movie_load_camera_transformation( aeMovieStream * _stream, aeMovi
     return AE_RESULT_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
+ae_void_t ae_movie_delete_camera_transformation( const aeMovieInstance * _instance, const aeMovieCompositionCamera * _camera )
+{
+    if( _camera->timeline != AE_NULLPTR )
+    {
+        aeMovieCompositionCameraTimeline * timeline = _camera->timeline;
+
+        AE_DELETE( _instance, timeline->target_x );
+        AE_DELETE( _instance, timeline->target_y );
+        AE_DELETE( _instance, timeline->target_z );
+        AE_DELETE( _instance, timeline->position_x );
+        AE_DELETE( _instance, timeline->position_y );
+        AE_DELETE( _instance, timeline->position_z );
+        AE_DELETE( _instance, timeline->quaternion_x );
+        AE_DELETE( _instance, timeline->quaternion_y );
+        AE_DELETE( _instance, timeline->quaternion_z );
+        AE_DELETE( _instance, timeline->quaternion_w );
+
+        AE_DELETE( _instance, _camera->timeline );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
 AE_INTERNAL ae_void_t __delete_layer_transformation2d( const aeMovieInstance * _instance, const aeMovieLayerTransformation2D * _transformation )
 {
     if( _transformation->timeline != AE_NULLPTR )
@@ -1394,18 +1698,510 @@ ae_void_t ae_movie_delete_layer_transformation( const aeMovieInstance * _instanc
     }
 }
 //////////////////////////////////////////////////////////////////////////
-ae_void_t ae_movie_make_layer_matrix( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_bool_t _interpolate, ae_uint32_t _index, ae_float_t _t )
+AE_INTERNAL ae_bool_t __bake_movie_layer_transformation_timeline( const aeMovieInstance * _instance, ae_constvoidptr_t * _property, ae_uint32_t _frameCount, ae_size_t _budget, ae_size_t * _used )
 {
+    if( *_property == AE_NULLPTR )
+    {
+        return AE_TRUE;
+    }
+
+    if( _frameCount > 0x00FFFFFF )
+    {
+        return AE_FALSE;
+    }
+
+    const ae_uint32_t * property_stream = __get_movie_layer_transformation_property_stream( *_property );
+
+    //constant runs stay type 0 blocks so holds survive, every other run becomes one raw block
+    ae_uint32_t bake_count = 0U;
+    ae_uint32_t bake_block_count = 0U;
+    ae_bool_t bake_expand = AE_FALSE;
+    ae_bool_t bake_raw = AE_FALSE;
+
+    ae_uint32_t property_index = 0U;
+    const ae_uint32_t * it_block = property_stream;
+    while( property_index < _frameCount )
+    {
+        ae_uint32_t zp_block_type_count_data = *it_block;
+
+        ae_uint32_t zp_block_type = zp_block_type_count_data >> 24U;
+        ae_uint32_t zp_block_count = zp_block_type_count_data & 0x00FFFFFF;
+
+        ae_uint32_t block_frame_count = (zp_block_count < _frameCount - property_index) ? zp_block_count : _frameCount - property_index;
+
+        if( zp_block_type == 0U )
+        {
+            bake_count += 2U;
+            bake_raw = AE_FALSE;
+
+            ++bake_block_count;
+        }
+        else
+        {
+            if( bake_raw == AE_FALSE )
+            {
+                bake_count += 1U;
+                bake_raw = AE_TRUE;
+
+                ++bake_block_count;
+            }
+
+            bake_count += block_frame_count;
+
+            if( zp_block_type != 3U )
+            {
+                bake_expand = AE_TRUE;
+            }
+        }
+
+        it_block += 1U + ((zp_block_type == 3U) ? zp_block_count : property_block_offset_static[zp_block_type & 3U]);
+
+        property_index += zp_block_count;
+    }
+
+    if( bake_expand == AE_FALSE )
+    {
+        return AE_TRUE;
+    }
+
+    ae_uint32_t seek_capacity = __get_movie_layer_transformation_timeline_seek_capacity( bake_block_count );
+
+    ae_size_t bake_size = sizeof( ae_uint32_t ) * (2U + bake_count) + sizeof( aeMovieLayerTransformationTimelineSeek ) * seek_capacity;
+
+    if( *_used + bake_size > _budget )
+    {
+        return AE_FALSE;
+    }
+
+    ae_uint32_t * timeline_bake = (ae_uint32_t *)AE_NEWV( _instance, bake_size, "timeline_bake" );
+
+    if( timeline_bake == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_uint32_t * bake_stream = timeline_bake + 2;
+
+    ae_uint32_t * it_bake = bake_stream;
+    ae_uint32_t * bake_raw_header = AE_NULLPTR;
+
+    property_index = 0U;
+    it_block = property_stream;
+    while( property_index < _frameCount )
+    {
+        ae_uint32_t zp_block_type_count_data = *it_block;
+
+        ae_uint32_t zp_block_type = zp_block_type_count_data >> 24U;
+        ae_uint32_t zp_block_count = zp_block_type_count_data & 0x00FFFFFF;
+
+        ae_uint32_t block_frame_count = (zp_block_count < _frameCount - property_index) ? zp_block_count : _frameCount - property_index;
+
+        if( zp_block_type == 0U )
+        {
+            *(it_bake++) = (0U << 24U) | block_frame_count;
+            *(it_bake++) = it_block[1];
+
+            bake_raw_header = AE_NULLPTR;
+        }
+        else
+        {
+            if( bake_raw_header == AE_NULLPTR )
+            {
+                bake_raw_header = it_bake++;
+
+                *bake_raw_header = (3U << 24U);
+            }
+
+            *bake_raw_header += block_frame_count;
+
+            ae_float_t * bake_values = (ae_float_t *)(ae_voidptr_t)it_bake;
+
+            for( ae_uint32_t index = 0U; index != block_frame_count; ++index )
+            {
+                bake_values[index] = __decode_movie_layer_transformation_property( it_block, property_index, property_index + index );
+            }
+
+            it_bake += block_frame_count;
+        }
+
+        it_block += 1U + ((zp_block_type == 3U) ? zp_block_count : property_block_offset_static[zp_block_type & 3U]);
+
+        property_index += zp_block_count;
+    }
+
+    timeline_bake[0] = 0U;
+    timeline_bake[1] = bake_count;
+
+    if( seek_capacity != 0U )
+    {
+        aeMovieLayerTransformationTimelineSeek * seeks = (aeMovieLayerTransformationTimelineSeek *)(ae_voidptr_t)(bake_stream + bake_count);
+
+        timeline_bake[0] = __make_movie_layer_transformation_timeline_seek( seeks, bake_stream, bake_count );
+    }
+
+    AE_DELETE( _instance, *_property );
+
+    *_property = timeline_bake;
+    *_used += bake_size;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __bake_movie_layer_transformation_timelines( const aeMovieInstance * _instance, ae_constvoidptr_t * const * _properties, ae_uint32_t _count, ae_uint32_t _frameCount, ae_size_t _budget, ae_size_t * _used )
+{
+    ae_constvoidptr_t * const * it_property = _properties;
+    ae_constvoidptr_t * const * it_property_end = _properties + _count;
+    for( ; it_property != it_property_end; ++it_property )
+    {
+        if( __bake_movie_layer_transformation_timeline( _instance, *it_property, _frameCount, _budget, _used ) == AE_FALSE )
+        {
+            return AE_FALSE;
+        }
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_movie_bake_layer_transformation( const aeMovieInstance * _instance, aeMovieLayerTransformation * _transformation, ae_bool_t _threeD, ae_uint32_t _frameCount, ae_size_t _budget, ae_size_t * _used )
+{
+    aeMovieLayerColorTimeline * timeline_color = &_transformation->timeline_color;
+
+    ae_constvoidptr_t * color_properties[] = {
+        &timeline_color->color_r, &timeline_color->color_g, &timeline_color->color_b,
+        &_transformation->timeline_opacity
+    };
+
+    if( __bake_movie_layer_transformation_timelines( _instance, color_properties, sizeof( color_properties ) / sizeof( color_properties[0] ), _frameCount, _budget, _used ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( _threeD == AE_FALSE )
+    {
+        aeMovieLayerTransformation2D * transformation2d = (aeMovieLayerTransformation2D *)_transformation;
+
+        if( transformation2d->timeline == AE_NULLPTR )
+        {
+            return AE_TRUE;
+        }
+
+        aeMovieLayerTransformation2DTimeline * timeline = transformation2d->timeline;
+
+        ae_constvoidptr_t * properties[] = {
+            &timeline->anchor_point_x, &timeline->anchor_point_y,
+            &timeline->position_x, &timeline->position_y,
+            &timeline->scale_x, &timeline->scale_y,
+            &timeline->quaternion_z, &timeline->quaternion_w,
+            &timeline->skew, &timeline->skew_quaternion_z, &timeline->skew_quaternion_w
+        };
+
+        ae_bool_t result = __bake_movie_layer_transformation_timelines( _instance, properties, sizeof( properties ) / sizeof( properties[0] ), _frameCount, _budget, _used );
+
+        return result;
+    }
+    else
+    {
+        aeMovieLayerTransformation3D * transformation3d = (aeMovieLayerTransformation3D *)_transformation;
+
+        if( transformation3d->timeline == AE_NULLPTR )
+        {
+            return AE_TRUE;
+        }
+
+        aeMovieLayerTransformation3DTimeline * timeline = transformation3d->timeline;
+
+        ae_constvoidptr_t * properties[] = {
+            &timeline->anchor_point_x, &timeline->anchor_point_y, &timeline->anchor_point_z,
+            &timeline->position_x, &timeline->position_y, &timeline->position_z,
+            &timeline->scale_x, &timeline->scale_y, &timeline->scale_z,
+            &timeline->quaternion_x, &timeline->quaternion_y, &timeline->quaternion_z, &timeline->quaternion_w,
+            &timeline->skew, &timeline->skew_quaternion_z, &timeline->skew_quaternion_w
+        };
+
+        ae_bool_t result = __bake_movie_layer_transformation_timelines( _instance, properties, sizeof( properties ) / sizeof( properties[0] ), _frameCount, _budget, _used );
+
+        return result;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_movie_bake_camera_transformation( const aeMovieInstance * _instance, aeMovieCompositionCamera * _camera, ae_uint32_t _frameCount, ae_size_t _budget, ae_size_t * _used )
+{
+    if( _camera->timeline == AE_NULLPTR )
+    {
+        return AE_TRUE;
+    }
+
+    aeMovieCompositionCameraTimeline * timeline = _camera->timeline;
+
+    ae_constvoidptr_t * properties[] = {
+        &timeline->target_x, &timeline->target_y, &timeline->target_z,
+        &timeline->position_x, &timeline->position_y, &timeline->position_z,
+        &timeline->quaternion_x, &timeline->quaternion_y, &timeline->quaternion_z, &timeline->quaternion_w
+    };
+
+    ae_bool_t result = __bake_movie_layer_transformation_timelines( _instance, properties, sizeof( properties ) / sizeof( properties[0] ), _frameCount, _budget, _used );
+
+    return result;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __hold_movie_layer_transformation_property( ae_constvoidptr_t _property, aeMovieLayerTransformationCursor * _cursor, ae_uint32_t _index, ae_uint32_t * _begin, ae_uint32_t * _end )
+{
+    if( _property == AE_NULLPTR )
+    {
+        return AE_TRUE;
+    }
+
+    ae_uint32_t property_index;
+
+    const ae_uint32_t * property_block = __cursor_movie_layer_transformation_property( _property, _cursor, _index, &property_index );
+
+    ae_uint32_t zp_block_type_count_data = *property_block;
+
+    ae_uint32_t zp_block_type = zp_block_type_count_data >> 24U;
+    ae_uint32_t zp_block_count = zp_block_type_count_data & 0x00FFFFFF;
+
+    ae_uint32_t block_begin = property_index;
+    ae_uint32_t block_end = property_index + zp_block_count - 1U;
+
+    if( zp_block_type != 0U )
+    {
+        *_begin = block_begin;
+        *_end = block_end;
+
+        return AE_FALSE;
+    }
+
+    if( *_begin < block_begin )
+    {
+        *_begin = block_begin;
+    }
+
+    if( *_end > block_end )
+    {
+        *_end = block_end;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+#define AE_HOLD_CURSOR_PROPERTY( Transformation, Name )\
+	if( Transformation->timeline != AE_NULLPTR && __hold_movie_layer_transformation_property( Transformation->timeline->Name, &_cursors->Name, _index, _begin, _end ) == AE_FALSE ) { return AE_FALSE; }
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __get_movie_layer_transformation2d_hold( const aeMovieLayerTransformation2D * _transformation2d, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_uint32_t * _begin, ae_uint32_t * _end )
+{
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, anchor_point_x );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, anchor_point_y );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, position_x );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, position_y );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, scale_x );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, scale_y );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, quaternion_z );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, quaternion_w );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, skew );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, skew_quaternion_z );
+    AE_HOLD_CURSOR_PROPERTY( _transformation2d, skew_quaternion_w );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_INTERNAL ae_bool_t __get_movie_layer_transformation3d_hold( const aeMovieLayerTransformation3D * _transformation3d, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_uint32_t * _begin, ae_uint32_t * _end )
+{
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, anchor_point_x );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, anchor_point_y );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, anchor_point_z );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, position_x );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, position_y );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, position_z );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, scale_x );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, scale_y );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, scale_z );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, quaternion_x );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, quaternion_y );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, quaternion_z );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, quaternion_w );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, skew );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, skew_quaternion_z );
+    AE_HOLD_CURSOR_PROPERTY( _transformation3d, skew_quaternion_w );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_movie_get_layer_transformation_hold( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_bool_t _threeD, ae_uint32_t _index, ae_uint32_t * _begin, ae_uint32_t * _end )
+{
+    *_begin = 0U;
+    *_end = ~0U;
+
+    if( __hold_movie_layer_transformation_property( _transformation->timeline_color.color_r, &_cursors->color_r, _index, _begin, _end ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __hold_movie_layer_transformation_property( _transformation->timeline_color.color_g, &_cursors->color_g, _index, _begin, _end ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __hold_movie_layer_transformation_property( _transformation->timeline_color.color_b, &_cursors->color_b, _index, _begin, _end ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( __hold_movie_layer_transformation_property( _transformation->timeline_opacity, &_cursors->opacity, _index, _begin, _end ) == AE_FALSE )
+    {
+        return AE_FALSE;
+    }
+
+    if( _threeD == AE_FALSE )
+    {
+        ae_bool_t hold = __get_movie_layer_transformation2d_hold( (const aeMovieLayerTransformation2D *)_transformation, _cursors, _index, _begin, _end );
+
+        return hold;
+    }
+    else
+    {
+        ae_bool_t hold = __get_movie_layer_transformation3d_hold( (const aeMovieLayerTransformation3D *)_transformation, _cursors, _index, _begin, _end );
+
+        return hold;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_movie_clear_layer_transformation_cursors( aeMovieLayerTransformationCursors * _cursors )
+{
+    aeMovieLayerTransformationCursor * it_cursor = (aeMovieLayerTransformationCursor *)_cursors;
+    aeMovieLayerTransformationCursor * it_cursor_end = it_cursor + sizeof( aeMovieLayerTransformationCursors ) / sizeof( aeMovieLayerTransformationCursor );
+    for( ; it_cursor != it_cursor_end; ++it_cursor )
+    {
+        it_cursor->offset = 0U;
+        it_cursor->index = 0U;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_movie_make_layer_matrix( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_bool_t _interpolate, ae_uint32_t _index, ae_float_t _t )
+{
+    if( _interpolate == AE_TRUE )
+    {
+        (*_transformation->transforamtion_interpolate_matrix)(_out, _transformation, _cursors, _index, _t);
+    }
+    else
+    {
+        (*_transformation->transforamtion_fixed_matrix)(_out, _transformation, _cursors, _index);
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+ae_bool_t ae_movie_gather_layer_transformation2d_batch( aeMovieLayerTransformation2DBatch * _batch, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_bool_t _interpolate, ae_uint32_t _index, ae_float_t _t, ae_uint32_t * _slot )
+{
+    ae_uint32_t identity_property_mask = _transformation->identity_property_mask;
+    ae_uint32_t immutable_property_mask = _transformation->immutable_property_mask;
+
+    if( (identity_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL ||
+        (immutable_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL )
+    {
+        return AE_FALSE;
+    }
+
+    if( _batch->count == AE_MOVIE_TRANSFORMATION_BATCH_SIZE )
+    {
+        return AE_FALSE;
+    }
+
+    const aeMovieLayerTransformation2D * transformation2d = (const aeMovieLayerTransformation2D *)_transformation;
+
+    ae_uint32_t slot = _batch->count++;
+
     if( _interpolate == AE_TRUE )
     {
-        (*_transformation->transforamtion_interpolate_matrix)(_out, _transformation, _index, _t);
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_x, _batch->anchor_point_x[slot] );
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, anchor_point_y, _batch->anchor_point_y[slot] );
+
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_x, _batch->position_x[slot] );
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, position_y, _batch->position_y[slot] );
+
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_x, _batch->scale_x[slot] );
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, scale_y, _batch->scale_y[slot] );
+
+        if( (identity_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL_QUATERNION) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL_QUATERNION ||
+            (immutable_property_mask & AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL_QUATERNION) == AE_MOVIE_PROPERTY_TRANSFORM_SUPER_ALL_QUATERNION )
+        {
+            _batch->quaternion_z[slot] = transformation2d->immutable.quaternion_z;
+            _batch->quaternion_w[slot] = transformation2d->immutable.quaternion_w;
+        }
+        else
+        {
+            ae_quaternionzw_t q1;
+            ae_quaternionzw_t q2;
+            AE_FIXED2_CURSOR_PROPERTY( transformation2d, quaternion_z, q1[0], q2[0] );
+            AE_FIXED2_CURSOR_PROPERTY( transformation2d, quaternion_w, q1[1], q2[1] );
+
+            ae_quaternionzw_t quaternion;
+            ae_linerp_qzw( quaternion, q1, q2, _t );
+
+            _batch->quaternion_z[slot] = quaternion[0];
+            _batch->quaternion_w[slot] = quaternion[1];
+        }
+
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew, _batch->skew[slot] );
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_z, _batch->skew_quaternion_z[slot] );
+        AE_INTERPOLATE_CURSOR_PROPERTY( transformation2d, skew_quaternion_w, _batch->skew_quaternion_w[slot] );
     }
     else
     {
-        (*_transformation->transforamtion_fixed_matrix)(_out, _transformation, _index);
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_x, 0, _batch->anchor_point_x[slot] );
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, anchor_point_y, 0, _batch->anchor_point_y[slot] );
+
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, position_x, 0, _batch->position_x[slot] );
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, position_y, 0, _batch->position_y[slot] );
+
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_x, 0, _batch->scale_x[slot] );
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, scale_y, 0, _batch->scale_y[slot] );
+
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_z, 0, _batch->quaternion_z[slot] );
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, quaternion_w, 0, _batch->quaternion_w[slot] );
+
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, skew, 0, _batch->skew[slot] );
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, skew_quaternion_z, 0, _batch->skew_quaternion_z[slot] );
+        AE_FIXED_CURSOR_PROPERTY( transformation2d, skew_quaternion_w, 0, _batch->skew_quaternion_w[slot] );
+    }
+
+    *_slot = slot;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_movie_make_layer_transformation2d_batch( aeMovieLayerTransformation2DBatch * _batch )
+{
+    ae_uint32_t count = _batch->count;
+
+    //no branches and no cross-slot dependencies, compilers vectorize this loop
+    for( ae_uint32_t slot = 0; slot != count; ++slot )
+    {
+        ae_movie_make_transformation2d_affine( _batch->matrix_00 + slot, _batch->matrix_01 + slot, _batch->matrix_10 + slot, _batch->matrix_11 + slot, _batch->matrix_30 + slot, _batch->matrix_31 + slot
+            , _batch->position_x[slot], _batch->position_y[slot]
+            , _batch->anchor_point_x[slot], _batch->anchor_point_y[slot]
+            , _batch->scale_x[slot], _batch->scale_y[slot]
+            , _batch->quaternion_z[slot], _batch->quaternion_w[slot]
+            , _batch->skew[slot], _batch->skew_quaternion_z[slot], _batch->skew_quaternion_w[slot] );
     }
 }
 //////////////////////////////////////////////////////////////////////////
+ae_void_t ae_movie_get_layer_transformation2d_batch_matrix( ae_matrix34_t _out, const aeMovieLayerTransformation2DBatch * _batch, ae_uint32_t _slot )
+{
+    _out[0 * 3 + 0] = _batch->matrix_00[_slot];
+    _out[0 * 3 + 1] = _batch->matrix_01[_slot];
+    _out[0 * 3 + 2] = 0.f;
+
+    _out[1 * 3 + 0] = _batch->matrix_10[_slot];
+    _out[1 * 3 + 1] = _batch->matrix_11[_slot];
+    _out[1 * 3 + 2] = 0.f;
+
+    _out[2 * 3 + 0] = 0.f;
+    _out[2 * 3 + 1] = 0.f;
+    _out[2 * 3 + 2] = 1.f;
+
+    _out[3 * 3 + 0] = _batch->matrix_30[_slot];
+    _out[3 * 3 + 1] = _batch->matrix_31[_slot];
+    _out[3 * 3 + 2] = 0.f;
+}
+//////////////////////////////////////////////////////////////////////////
 ae_void_t ae_movie_make_camera_transformation( ae_vector3_t _target, ae_vector3_t _position, ae_quaternion_t _quaternion, const aeMovieCompositionCamera * _camera, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
 {
     if( _interpolate == AE_TRUE )
@@ -1419,16 +2215,11 @@ ae_void_t ae_movie_make_camera_transformation( ae_vector3_t _target, ae_vector3_
         AE_INTERPOLATE_PROPERTY( _camera, position_z, _position[2] );
 
         ae_quaternion_t q1;
-        AE_FIXED_PROPERTY( _camera, quaternion_x, 0, q1[0] );
-        AE_FIXED_PROPERTY( _camera, quaternion_y, 0, q1[1] );
-        AE_FIXED_PROPERTY( _camera, quaternion_z, 0, q1[2] );
-        AE_FIXED_PROPERTY( _camera, quaternion_w, 0, q1[3] );
-
         ae_quaternion_t q2;
-        AE_FIXED_PROPERTY( _camera, quaternion_x, 1, q2[0] );
-        AE_FIXED_PROPERTY( _camera, quaternion_y, 1, q2[1] );
-        AE_FIXED_PROPERTY( _camera, quaternion_z, 1, q2[2] );
-        AE_FIXED_PROPERTY( _camera, quaternion_w, 1, q2[3] );
+        AE_FIXED2_PROPERTY( _camera, quaternion_x, q1[0], q2[0] );
+        AE_FIXED2_PROPERTY( _camera, quaternion_y, q1[1], q2[1] );
+        AE_FIXED2_PROPERTY( _camera, quaternion_z, q1[2], q2[2] );
+        AE_FIXED2_PROPERTY( _camera, quaternion_w, q1[3], q2[3] );
 
         ae_linerp_q( _quaternion, q1, q2, _t );
     }
@@ -1449,7 +2240,7 @@ ae_void_t ae_movie_make_camera_transformation( ae_vector3_t _target, ae_vector3_
     }
 }
 //////////////////////////////////////////////////////////////////////////
-ae_color_channel_t ae_movie_make_layer_color_r( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
+ae_color_channel_t ae_movie_make_layer_color_r( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
 {
     if( _transformation->timeline_color.color_r == AE_NULLPTR )
     {
@@ -1460,7 +2251,7 @@ ae_color_channel_t ae_movie_make_layer_color_r( const aeMovieLayerTransformation
 
     if( _interpolate == AE_TRUE )
     {
-        value = __get_movie_layer_transformation_property_interpolate( _transformation->timeline_color.color_r, _index, _t );
+        value = __get_movie_layer_transformation_property_interpolate_cursor( _transformation->timeline_color.color_r, &_cursors->color_r, _index, _t );
     }
     else
     {
@@ -1470,14 +2261,14 @@ ae_color_channel_t ae_movie_make_layer_color_r( const aeMovieLayerTransformation
         }
         else
         {
-            value = __get_movie_layer_transformation_property_fixed( _transformation->timeline_color.color_r, _index );
+            value = __get_movie_layer_transformation_property_cursor( _transformation->timeline_color.color_r, &_cursors->color_r, _index );
         }
     }
 
     return value;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_color_channel_t ae_movie_make_layer_color_g( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
+ae_color_channel_t ae_movie_make_layer_color_g( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
 {
     if( _transformation->timeline_color.color_g == AE_NULLPTR )
     {
@@ -1488,7 +2279,7 @@ ae_color_channel_t ae_movie_make_layer_color_g( const aeMovieLayerTransformation
 
     if( _interpolate == AE_TRUE )
     {
-        value = __get_movie_layer_transformation_property_interpolate( _transformation->timeline_color.color_g, _index, _t );
+        value = __get_movie_layer_transformation_property_interpolate_cursor( _transformation->timeline_color.color_g, &_cursors->color_g, _index, _t );
     }
     else
     {
@@ -1498,14 +2289,14 @@ ae_color_channel_t ae_movie_make_layer_color_g( const aeMovieLayerTransformation
         }
         else
         {
-            value = __get_movie_layer_transformation_property_fixed( _transformation->timeline_color.color_g, _index );
+            value = __get_movie_layer_transformation_property_cursor( _transformation->timeline_color.color_g, &_cursors->color_g, _index );
         }
     }
 
     return value;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_color_channel_t ae_movie_make_layer_color_b( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
+ae_color_channel_t ae_movie_make_layer_color_b( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
 {
     if( _transformation->timeline_color.color_b == AE_NULLPTR )
     {
@@ -1516,7 +2307,7 @@ ae_color_channel_t ae_movie_make_layer_color_b( const aeMovieLayerTransformation
 
     if( _interpolate == AE_TRUE )
     {
-        value = __get_movie_layer_transformation_property_interpolate( _transformation->timeline_color.color_b, _index, _t );
+        value = __get_movie_layer_transformation_property_interpolate_cursor( _transformation->timeline_color.color_b, &_cursors->color_b, _index, _t );
     }
     else
     {
@@ -1526,14 +2317,14 @@ ae_color_channel_t ae_movie_make_layer_color_b( const aeMovieLayerTransformation
         }
         else
         {
-            value = __get_movie_layer_transformation_property_fixed( _transformation->timeline_color.color_b, _index );
+            value = __get_movie_layer_transformation_property_cursor( _transformation->timeline_color.color_b, &_cursors->color_b, _index );
         }
     }
 
     return value;
 }
 //////////////////////////////////////////////////////////////////////////
-ae_color_channel_t ae_movie_make_layer_opacity( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
+ae_color_channel_t ae_movie_make_layer_opacity( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
 {
     if( _transformation->timeline_opacity == AE_NULLPTR )
     {
@@ -1544,7 +2335,7 @@ ae_color_channel_t ae_movie_make_layer_opacity( const aeMovieLayerTransformation
 
     if( _interpolate == AE_TRUE )
     {
-        value = __get_movie_layer_transformation_property_interpolate( _transformation->timeline_opacity, _index, _t );
+        value = __get_movie_layer_transformation_property_interpolate_cursor( _transformation->timeline_opacity, &_cursors->opacity, _index, _t );
     }
     else
     {
@@ -1554,13 +2345,65 @@ ae_color_channel_t ae_movie_make_layer_opacity( const aeMovieLayerTransformation
         }
         else
         {
-            value = __get_movie_layer_transformation_property_fixed( _transformation->timeline_opacity, _index );
+            value = __get_movie_layer_transformation_property_cursor( _transformation->timeline_opacity, &_cursors->opacity, _index );
         }
     }
 
     return value;
 }
 //////////////////////////////////////////////////////////////////////////
+#define AE_COLOR_CHANNEL_INTERPOLATE( Timeline, Cursor, Immutable, OutName )\
+	OutName = (Timeline == AE_NULLPTR) ? Immutable : __get_movie_layer_transformation_property_interpolate_cursor( Timeline, &_cursors->Cursor, _index, _t )
+//////////////////////////////////////////////////////////////////////////
+#define AE_COLOR_CHANNEL_FIXED( Timeline, Cursor, Immutable, OutName )\
+	OutName = (Timeline == AE_NULLPTR) ? Immutable : __get_movie_layer_transformation_property_cursor( Timeline, &_cursors->Cursor, _index )
+//////////////////////////////////////////////////////////////////////////
+#define AE_COLOR_CHANNEL_INITIAL( Timeline, Initial, Immutable, OutName )\
+	OutName = (Timeline == AE_NULLPTR) ? Immutable : Initial
+//////////////////////////////////////////////////////////////////////////
+ae_void_t ae_movie_make_layer_color( ae_color_t * _color, ae_color_channel_t * _opacity, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t )
+{
+    const aeMovieLayerColorTimeline * timeline_color = &_transformation->timeline_color;
+    const aeMovieLayerColorImuttable * immutable_color = &_transformation->immutable_color;
+
+    ae_uint32_t static_property_mask = _transformation->immutable_property_mask | _transformation->identity_property_mask;
+
+    if( (static_property_mask & AE_MOVIE_PROPERTY_COLOR_SUPER_ALL) == AE_MOVIE_PROPERTY_COLOR_SUPER_ALL )
+    {
+        _color->r = immutable_color->color_r;
+        _color->g = immutable_color->color_g;
+        _color->b = immutable_color->color_b;
+
+        *_opacity = _transformation->immutable_opacity;
+
+        return;
+    }
+
+    if( _interpolate == AE_TRUE )
+    {
+        AE_COLOR_CHANNEL_INTERPOLATE( timeline_color->color_r, color_r, immutable_color->color_r, _color->r );
+        AE_COLOR_CHANNEL_INTERPOLATE( timeline_color->color_g, color_g, immutable_color->color_g, _color->g );
+        AE_COLOR_CHANNEL_INTERPOLATE( timeline_color->color_b, color_b, immutable_color->color_b, _color->b );
+        AE_COLOR_CHANNEL_INTERPOLATE( _transformation->timeline_opacity, opacity, _transformation->immutable_opacity, *_opacity );
+    }
+    else if( _index == 0 )
+    {
+        const aeMovieLayerColorImuttable * initial_color = &_transformation->initial_color;
+
+        AE_COLOR_CHANNEL_INITIAL( timeline_color->color_r, initial_color->color_r, immutable_color->color_r, _color->r );
+        AE_COLOR_CHANNEL_INITIAL( timeline_color->color_g, initial_color->color_g, immutable_color->color_g, _color->g );
+        AE_COLOR_CHANNEL_INITIAL( timeline_color->color_b, initial_color->color_b, immutable_color->color_b, _color->b );
+        AE_COLOR_CHANNEL_INITIAL( _transformation->timeline_opacity, _transformation->initial_opacity, _transformation->immutable_opacity, *_opacity );
+    }
+    else
+    {
+        AE_COLOR_CHANNEL_FIXED( timeline_color->color_r, color_r, immutable_color->color_r, _color->r );
+        AE_COLOR_CHANNEL_FIXED( timeline_color->color_g, color_g, immutable_color->color_g, _color->g );
+        AE_COLOR_CHANNEL_FIXED( timeline_color->color_b, color_b, immutable_color->color_b, _color->b );
+        AE_COLOR_CHANNEL_FIXED( _transformation->timeline_opacity, opacity, _transformation->immutable_opacity, *_opacity );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
 ae_void_t ae_movie_make_layer_transformation2d_interpolate( ae_vector2_t _anchor_point, ae_vector2_t _position, ae_vector2_t _scale, ae_quaternionzw_t _quaternion, ae_skew_t _skew, const aeMovieLayerTransformation2D * _transformation2d, ae_uint32_t _index, ae_float_t _t )
 {
     AE_INTERPOLATE_PROPERTY( _transformation2d, anchor_point_x, _anchor_point[0] );
@@ -1573,12 +2416,9 @@ ae_void_t ae_movie_make_layer_transformation2d_interpolate( ae_vector2_t _anchor
     AE_INTERPOLATE_PROPERTY( _transformation2d, scale_y, _scale[1] );
 
     ae_quaternionzw_t q1;
-    AE_FIXED_PROPERTY( _transformation2d, quaternion_z, 0, q1[0] );
-    AE_FIXED_PROPERTY( _transformation2d, quaternion_w, 0, q1[1] );
-
     ae_quaternionzw_t q2;
-    AE_FIXED_PROPERTY( _transformation2d, quaternion_z, 1, q2[0] );
-    AE_FIXED_PROPERTY( _transformation2d, quaternion_w, 1, q2[1] );
+    AE_FIXED2_PROPERTY( _transformation2d, quaternion_z, q1[0], q2[0] );
+    AE_FIXED2_PROPERTY( _transformation2d, quaternion_w, q1[1], q2[1] );
 
     ae_linerp_qzw( _quaternion, q1, q2, _t );
 
@@ -164,10 +164,64 @@ typedef struct aeMovieLayerColorTimeline
     ae_constvoidptr_t color_b;
 }aeMovieLayerColorTimeline;
 
+typedef struct aeMovieLayerTransformationCursor
+{
+    ae_uint32_t offset;
+    ae_uint32_t index;
+} aeMovieLayerTransformationCursor;
+
+typedef struct aeMovieLayerTransformationCursors
+{
+    aeMovieLayerTransformationCursor anchor_point_x;
+    aeMovieLayerTransformationCursor anchor_point_y;
+    aeMovieLayerTransformationCursor anchor_point_z;
+    aeMovieLayerTransformationCursor position_x;
+    aeMovieLayerTransformationCursor position_y;
+    aeMovieLayerTransformationCursor position_z;
+    aeMovieLayerTransformationCursor scale_x;
+    aeMovieLayerTransformationCursor scale_y;
+    aeMovieLayerTransformationCursor scale_z;
+    aeMovieLayerTransformationCursor quaternion_x;
+    aeMovieLayerTransformationCursor quaternion_y;
+    aeMovieLayerTransformationCursor quaternion_z;
+    aeMovieLayerTransformationCursor quaternion_w;
+    aeMovieLayerTransformationCursor skew;
+    aeMovieLayerTransformationCursor skew_quaternion_z;
+    aeMovieLayerTransformationCursor skew_quaternion_w;
+    aeMovieLayerTransformationCursor color_r;
+    aeMovieLayerTransformationCursor color_g;
+    aeMovieLayerTransformationCursor color_b;
+    aeMovieLayerTransformationCursor opacity;
+} aeMovieLayerTransformationCursors;
+
+typedef struct aeMovieLayerTransformation2DBatch
+{
+    ae_uint32_t count;
+
+    ae_float_t anchor_point_x[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t anchor_point_y[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t position_x[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t position_y[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t scale_x[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t scale_y[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t quaternion_z[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t quaternion_w[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t skew[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t skew_quaternion_z[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t skew_quaternion_w[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+
+    ae_float_t matrix_00[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t matrix_01[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t matrix_10[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t matrix_11[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t matrix_30[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+    ae_float_t matrix_31[AE_MOVIE_TRANSFORMATION_BATCH_SIZE];
+} aeMovieLayerTransformation2DBatch;
+
 struct aeMovieLayerTransformation;
 
-typedef ae_void_t( *ae_movie_make_layer_transformation_intepolate_t )(ae_matrix34_t _out, const struct aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_float_t _t);
-typedef ae_void_t( *ae_movie_make_layer_transformation_fixed_t )(ae_matrix34_t _out, const struct aeMovieLayerTransformation * _transformation, ae_uint32_t _index);
+typedef ae_void_t( *ae_movie_make_layer_transformation_intepolate_t )(ae_matrix34_t _out, const struct aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_float_t _t);
+typedef ae_void_t( *ae_movie_make_layer_transformation_fixed_t )(ae_matrix34_t _out, const struct aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index);
 
 #define AE_MOVIE_LAYER_TRANSFORMATION_BASE()\
     ae_uint32_t immutable_property_mask;\
@@ -206,11 +260,20 @@ typedef struct aeMovieLayerTransformation3D
 ae_result_t ae_movie_load_layer_transformation( aeMovieStream * _stream, aeMovieLayerTransformation * _transformation, ae_bool_t _threeD );
 ae_result_t ae_movie_load_camera_transformation( aeMovieStream * _stream, aeMovieCompositionCamera * _camera );
 ae_void_t ae_movie_delete_layer_transformation( const aeMovieInstance * _instance, const aeMovieLayerTransformation * _transformation, ae_bool_t _threeD );
-ae_color_channel_t ae_movie_make_layer_color_r( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
-ae_color_channel_t ae_movie_make_layer_color_g( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
-ae_color_channel_t ae_movie_make_layer_color_b( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
-ae_color_channel_t ae_movie_make_layer_opacity( const aeMovieLayerTransformation * _transformation, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
-ae_void_t ae_movie_make_layer_matrix( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, ae_bool_t _interpolate, ae_uint32_t _index, ae_float_t _t );
+ae_void_t ae_movie_delete_camera_transformation( const aeMovieInstance * _instance, const aeMovieCompositionCamera * _camera );
+ae_bool_t ae_movie_bake_layer_transformation( const aeMovieInstance * _instance, aeMovieLayerTransformation * _transformation, ae_bool_t _threeD, ae_uint32_t _frameCount, ae_size_t _budget, ae_size_t * _used );
+ae_bool_t ae_movie_bake_camera_transformation( const aeMovieInstance * _instance, aeMovieCompositionCamera * _camera, ae_uint32_t _frameCount, ae_size_t _budget, ae_size_t * _used );
+ae_bool_t ae_movie_get_layer_transformation_hold( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_bool_t _threeD, ae_uint32_t _index, ae_uint32_t * _begin, ae_uint32_t * _end );
+ae_void_t ae_movie_clear_layer_transformation_cursors( aeMovieLayerTransformationCursors * _cursors );
+ae_color_channel_t ae_movie_make_layer_color_r( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
+ae_color_channel_t ae_movie_make_layer_color_g( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
+ae_color_channel_t ae_movie_make_layer_color_b( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
+ae_color_channel_t ae_movie_make_layer_opacity( const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
+ae_void_t ae_movie_make_layer_color( ae_color_t * _color, ae_color_channel_t * _opacity, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
+ae_bool_t ae_movie_gather_layer_transformation2d_batch( aeMovieLayerTransformation2DBatch * _batch, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_bool_t _interpolate, ae_uint32_t _index, ae_float_t _t, ae_uint32_t * _slot );
+ae_void_t ae_movie_make_layer_transformation2d_batch( aeMovieLayerTransformation2DBatch * _batch );
+ae_void_t ae_movie_get_layer_transformation2d_batch_matrix( ae_matrix34_t _out, const aeMovieLayerTransformation2DBatch * _batch, ae_uint32_t _slot );
+ae_void_t ae_movie_make_layer_matrix( ae_matrix34_t _out, const aeMovieLayerTransformation * _transformation, aeMovieLayerTransformationCursors * _cursors, ae_bool_t _interpolate, ae_uint32_t _index, ae_float_t _t );
 ae_void_t ae_movie_make_camera_transformation( ae_vector3_t _target, ae_vector3_t _position, ae_quaternion_t _quaternion, const aeMovieCompositionCamera * _camera, ae_uint32_t _index, ae_bool_t _interpolate, ae_float_t _t );
 
 ae_void_t ae_movie_make_layer_transformation2d_interpolate( ae_vector2_t _anchor_point, ae_vector2_t _position, ae_vector2_t _scale, ae_quaternionzw_t _quaternion, ae_skew_t _skew, const aeMovieLayerTransformation2D * _transformation2d, ae_uint32_t _index, ae_float_t _t );
@@ -0,0 +1,20 @@
+execute_process(COMMAND ${TEST_INDEXED} ${TEST_SOURCE_DIR} play
+    OUTPUT_VARIABLE indexed_trace
+    RESULT_VARIABLE indexed_result)
+
+execute_process(COMMAND ${TEST_FULL_VISIT} ${TEST_SOURCE_DIR} play
+    OUTPUT_VARIABLE full_visit_trace
+    RESULT_VARIABLE full_visit_result)
+
+if(NOT indexed_result EQUAL 0 OR NOT full_visit_result EQUAL 0)
+    message(FATAL_ERROR "interval index: play trace failed")
+endif()
+
+if(NOT indexed_trace STREQUAL full_visit_trace)
+    message(FATAL_ERROR "interval index: play trace differs from the full visit")
+endif()
+
+string(REGEX MATCHALL "\n" trace_lines "${indexed_trace}")
+list(LENGTH trace_lines trace_line_count)
+
+message(STATUS "interval index: ${trace_line_count} play steps match the full visit")
@@ -0,0 +1,367 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_path = "examples/resources/Bridge/Bridge.aem";
+
+//the examples export no camera, one is spliced in front of the flag terminator of the first composition
+#define TEST_CAMERA_FLAG_TERMINATOR_OFFSET 1835U
+#define TEST_CAMERA_FRAME_COUNT 91U
+#define TEST_CAMERA_STREAM_MAX 256U
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_camera_writer_t
+{
+    ae_uint8_t buffer[TEST_CAMERA_STREAM_MAX];
+    ae_size_t size;
+} test_camera_writer_t;
+//////////////////////////////////////////////////////////////////////////
+static void __write_camera_bytes( test_camera_writer_t * _writer, const void * _data, ae_size_t _size )
+{
+    memcpy( _writer->buffer + _writer->size, _data, _size );
+
+    _writer->size += _size;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_camera_u8( test_camera_writer_t * _writer, ae_uint8_t _value )
+{
+    __write_camera_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_camera_u32( test_camera_writer_t * _writer, ae_uint32_t _value )
+{
+    __write_camera_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_camera_f32( test_camera_writer_t * _writer, ae_float_t _value )
+{
+    __write_camera_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_camera_linear_timeline( test_camera_writer_t * _writer, ae_float_t _begin, ae_float_t _end )
+{
+    //one linear block over the whole composition, the bake expands it into frames
+    __write_camera_u32( _writer, sizeof( ae_uint32_t ) * 4U );
+    __write_camera_u8( _writer, 0U );
+
+    __write_camera_u32( _writer, (1U << 24U) | TEST_CAMERA_FRAME_COUNT );
+    __write_camera_f32( _writer, 1.f / (ae_float_t)(TEST_CAMERA_FRAME_COUNT - 1U) );
+    __write_camera_f32( _writer, _begin );
+    __write_camera_f32( _writer, _end );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_camera( test_camera_writer_t * _writer )
+{
+    _writer->size = 0;
+
+    //composition flag: camera
+    __write_camera_u8( _writer, 5U );
+
+    //exported camera
+    __write_camera_u8( _writer, 1U );
+
+    __write_camera_u8( _writer, 6U );
+    __write_camera_bytes( _writer, "Camera", 6U );
+
+    __write_camera_f32( _writer, 1000.f );
+    __write_camera_f32( _writer, 45.f );
+
+    //target and position x animate, target and position y z are immutable, the quaternion is identity
+    ae_uint32_t immutable_property_mask = 0x00000002U | 0x00000004U | 0x00000020U | 0x00000040U;
+    ae_uint32_t identity_property_mask = 0x00001000U | 0x00002000U | 0x00004000U | 0x00008000U;
+
+    __write_camera_u32( _writer, immutable_property_mask );
+    __write_camera_u32( _writer, identity_property_mask );
+
+    __write_camera_linear_timeline( _writer, 0.f, 900.f );
+    __write_camera_f32( _writer, 20.f );
+    __write_camera_f32( _writer, 0.f );
+
+    __write_camera_linear_timeline( _writer, 100.f, -800.f );
+    __write_camera_f32( _writer, 30.f );
+    __write_camera_f32( _writer, -1000.f );
+}
+//////////////////////////////////////////////////////////////////////////
+static aeMovieData * __load_movie_data_camera( const aeMovieInstance * _instance, const ae_char_t * _path, ae_uint8_t ** _buffer )
+{
+    FILE * f = fopen( _path, "rb" );
+
+    if( f == NULL )
+    {
+        return AE_NULLPTR;
+    }
+
+    fseek( f, 0, SEEK_END );
+    ae_size_t file_size = (ae_size_t)ftell( f );
+    fseek( f, 0, SEEK_SET );
+
+    test_camera_writer_t writer;
+    __write_camera( &writer );
+
+    ae_uint8_t * buffer = (ae_uint8_t *)malloc( file_size + writer.size );
+
+    ae_size_t read_size = fread( buffer, 1, file_size, f );
+
+    fclose( f );
+
+    if( read_size != file_size || buffer[TEST_CAMERA_FLAG_TERMINATOR_OFFSET] != 0U )
+    {
+        free( buffer );
+
+        return AE_NULLPTR;
+    }
+
+    memmove( buffer + TEST_CAMERA_FLAG_TERMINATOR_OFFSET + writer.size, buffer + TEST_CAMERA_FLAG_TERMINATOR_OFFSET, file_size - TEST_CAMERA_FLAG_TERMINATOR_OFFSET );
+    memcpy( buffer + TEST_CAMERA_FLAG_TERMINATOR_OFFSET, writer.buffer, writer.size );
+
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    aeMovieStream * movieStream = ae_create_movie_stream_memory( _instance, buffer, &__memory_copy, AE_NULLPTR );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        free( buffer );
+
+        return AE_NULLPTR;
+    }
+
+    *_buffer = buffer;
+
+    return movieData;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_camera_t
+{
+    ae_uint32_t update_count;
+    ae_vector3_t target;
+    ae_vector3_t position;
+} test_camera_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_camera_provider( const aeMovieCameraProviderCallbackData * _callbackData, ae_userdataptr_t _cd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _callbackData );
+
+    *_cd = _ud;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_camera_update( const aeMovieCameraUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_camera_t * camera = (test_camera_t *)_ud;
+
+    ++camera->update_count;
+
+    camera->target[0] = _callbackData->target[0];
+    camera->target[1] = _callbackData->target[1];
+    camera->target[2] = _callbackData->target[2];
+
+    camera->position[0] = _callbackData->position[0];
+    camera->position[1] = _callbackData->position[1];
+    camera->position[2] = _callbackData->position[2];
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __play_movie_camera( const aeMovieData * _movieData, ae_float_t * _samples, ae_uint32_t _count )
+{
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( _movieData, 0 );
+
+    test_camera_t camera;
+    camera.update_count = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.camera_provider = &__movie_camera_provider;
+    movieCompositionProviders.camera_update = &__movie_camera_update;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, movieCompositionData, AE_TRUE, &movieCompositionProviders, &camera );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    ae_bool_t successful = AE_TRUE;
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t index = 0;
+    for( ; index != _count; ++index )
+    {
+        ae_update_movie_composition( movieComposition, index == 0 ? 0.f : frame_duration * 0.5f );
+
+        ae_uint32_t update_count = camera.update_count;
+
+        //the same frame and fraction does not sample the camera again
+        ae_update_movie_composition( movieComposition, 0.f );
+
+        if( camera.update_count != update_count || update_count != index + 1U )
+        {
+            printf( "camera: sample %u updated %u times\n", index, camera.update_count );
+
+            successful = AE_FALSE;
+        }
+
+        _samples[index * 2 + 0] = camera.target[0];
+        _samples[index * 2 + 1] = camera.position[0];
+    }
+
+    //the last frame has no next one to interpolate into, it is held
+    ae_update_movie_composition( movieComposition, frame_duration * 0.5f );
+
+    if( camera.target[0] != 900.f || camera.position[0] != -800.f || camera.target[1] != 20.f || camera.position[2] != -1000.f )
+    {
+        printf( "camera: end of composition %f %f\n", camera.target[0], camera.position[0] );
+
+        successful = AE_FALSE;
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    return successful;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    char full_example_file_path[256];
+    sprintf( full_example_file_path, "%s/../%s"
+        , argv[1]
+        , test_example_file_path
+    );
+
+    ae_uint8_t * movieBuffer;
+    aeMovieData * movieData = __load_movie_data_camera( movieInstance, full_example_file_path, &movieBuffer );
+
+    if( movieData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, 0 );
+
+    if( ae_get_movie_composition_data_frame_count( movieCompositionData ) != TEST_CAMERA_FRAME_COUNT )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t sample_count = TEST_CAMERA_FRAME_COUNT * 2U - 1U;
+
+    ae_float_t * samples_compressed = (ae_float_t *)malloc( sizeof( ae_float_t ) * 2U * sample_count );
+    ae_float_t * samples_baked = (ae_float_t *)malloc( sizeof( ae_float_t ) * 2U * sample_count );
+
+    if( __play_movie_camera( movieData, samples_compressed, sample_count ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t index = 0;
+    for( ; index != TEST_CAMERA_FRAME_COUNT; ++index )
+    {
+        ae_float_t target_x = samples_compressed[index * 4 + 0];
+        ae_float_t position_x = samples_compressed[index * 4 + 1];
+
+        if( target_x < (ae_float_t)index * 10.f - 0.01f || target_x > (ae_float_t)index * 10.f + 0.01f ||
+            position_x < 100.f - (ae_float_t)index * 10.f - 0.01f || position_x > 100.f - (ae_float_t)index * 10.f + 0.01f )
+        {
+            printf( "camera: frame %u sampled %f %f\n", index, target_x, position_x );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    ae_size_t used = 0;
+    if( ae_bake_movie_composition_camera_data( movieData, movieCompositionData, (ae_size_t)~0U, &used ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    //both animated properties expand into one float per frame
+    if( used != 2U * sizeof( ae_uint32_t ) * (3U + TEST_CAMERA_FRAME_COUNT) )
+    {
+        printf( "camera: baked %u bytes\n", (ae_uint32_t)used );
+
+        return EXIT_FAILURE;
+    }
+
+    if( __play_movie_camera( movieData, samples_baked, sample_count ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( memcmp( samples_compressed, samples_baked, sizeof( ae_float_t ) * 2U * sample_count ) != 0 )
+    {
+        printf( "camera: baked camera mismatch\n" );
+
+        return EXIT_FAILURE;
+    }
+
+    printf( "camera: %u samples, %u bytes baked\n", sample_count, (ae_uint32_t)used );
+
+    free( samples_compressed );
+    free( samples_baked );
+
+    ae_delete_movie_data( movieData );
+
+    free( movieBuffer );
+
+    ae_delete_movie_instance( movieInstance );
+
+    return EXIT_SUCCESS;
+}
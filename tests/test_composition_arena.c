@@ -0,0 +1,249 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+//one composition block and one setup scratch freed before create returns
+static const ae_uint32_t test_composition_arena_create_max_alloc = 2;
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_composition_arena_alloc_count;
+static ae_uint32_t test_composition_arena_live_count;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    ++test_composition_arena_alloc_count;
+    ++test_composition_arena_live_count;
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ++test_composition_arena_alloc_count;
+    ++test_composition_arena_live_count;
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    if( _ptr != AE_NULLPTR ) {
+        --test_composition_arena_live_count;
+    }
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    if( _ptr != AE_NULLPTR ) {
+        --test_composition_arena_live_count;
+    }
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_composition_arena( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData )
+{
+    ae_uint32_t errors = 0;
+
+    const ae_char_t * composition_name = ae_get_movie_composition_data_name( _compositionData );
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    ae_uint32_t live_begin = test_composition_arena_live_count;
+    ae_uint32_t alloc_begin = test_composition_arena_alloc_count;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_uint32_t create_alloc = test_composition_arena_alloc_count - alloc_begin;
+    ae_uint32_t create_live = test_composition_arena_live_count - live_begin;
+
+    if( create_alloc > test_composition_arena_create_max_alloc || create_live != 1 )
+    {
+        printf( "composition arena: '%s' create %u allocations, %u live\n", composition_name, create_alloc, create_live );
+
+        ++errors;
+    }
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t alloc_play = test_composition_arena_alloc_count;
+
+    ae_uint32_t step = 0;
+    for( ; step != 4000 && ae_is_play_movie_composition( movieComposition ) == AE_TRUE; ++step )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+    }
+
+    if( test_composition_arena_alloc_count != alloc_play )
+    {
+        printf( "composition arena: '%s' update allocated\n", composition_name );
+
+        ++errors;
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    if( test_composition_arena_live_count != live_begin )
+    {
+        printf( "composition arena: '%s' delete left %u allocations\n", composition_name, test_composition_arena_live_count - live_begin );
+
+        ++errors;
+    }
+
+    const aeMovieCompositionTemplate * compositionTemplate = ae_create_movie_composition_template( _movieData, _compositionData, AE_TRUE );
+
+    if( compositionTemplate == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    alloc_begin = test_composition_arena_alloc_count;
+
+    const aeMovieComposition * cloneComposition = ae_create_movie_composition_from_template( compositionTemplate, &movieCompositionProviders, AE_NULLPTR );
+
+    if( cloneComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_uint32_t clone_alloc = test_composition_arena_alloc_count - alloc_begin;
+
+    if( clone_alloc != 1 )
+    {
+        printf( "composition arena: '%s' clone %u allocations\n", composition_name, clone_alloc );
+
+        ++errors;
+    }
+
+    ae_delete_movie_composition( cloneComposition );
+    ae_delete_movie_composition_template( compositionTemplate );
+
+    if( test_composition_arena_live_count != live_begin )
+    {
+        printf( "composition arena: '%s' template left %u allocations\n", composition_name, test_composition_arena_live_count - live_begin );
+
+        ++errors;
+    }
+
+    printf( "composition arena: '%s' create %u allocations, clone %u\n", composition_name, create_alloc, clone_alloc );
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_composition_arena( movieData, movieCompositionData );
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "composition arena: %u compositions, %u errors\n", composition_total, errors );
+
+    if( errors != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,586 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+static const ae_uint32_t test_composition_template_clone_count = 3;
+static const ae_uint32_t test_composition_template_jumps = 100;
+static const ae_uint32_t test_composition_template_spawn_count = 50;
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_allocator_t
+{
+    ae_uint32_t live;
+
+    //allocations left before the next one fails, ~0U never fails
+    ae_uint32_t fail_after;
+} test_allocator_t;
+//////////////////////////////////////////////////////////////////////////
+static ae_voidptr_t __test_allocator_malloc( test_allocator_t * _allocator, ae_size_t _size )
+{
+    if( _allocator->fail_after != ~0U )
+    {
+        if( _allocator->fail_after == 0 )
+        {
+            return AE_NULLPTR;
+        }
+
+        --_allocator->fail_after;
+    }
+
+    ++_allocator->live;
+
+    return malloc( _size );
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __test_allocator_free( test_allocator_t * _allocator, ae_constvoidptr_t _ptr )
+{
+    if( _ptr == AE_NULLPTR )
+    {
+        return;
+    }
+
+    --_allocator->live;
+
+    free( (ae_voidptr_t)_ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    return __test_allocator_malloc( (test_allocator_t *)_userdata, _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    ae_size_t total = _size * _count;
+    return __test_allocator_malloc( (test_allocator_t *)_userdata, total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    __test_allocator_free( (test_allocator_t *)_data, _ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    __test_allocator_free( (test_allocator_t *)_data, _ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_composition_template_trace_t
+{
+    ae_uint32_t hash;
+    ae_uint32_t provided;
+    ae_uint32_t deleted;
+} test_composition_template_trace_t;
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __trace_bytes( test_composition_template_trace_t * _trace, ae_constvoidptr_t _data, ae_size_t _size )
+{
+    const ae_uint8_t * it_byte = (const ae_uint8_t *)_data;
+    const ae_uint8_t * it_byte_end = it_byte + _size;
+    for( ; it_byte != it_byte_end; ++it_byte )
+    {
+        _trace->hash = (_trace->hash ^ *it_byte) * 16777619U;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, &_callbackData->index, sizeof( _callbackData->index ) );
+    __trace_bytes( trace, &_callbackData->layer_data, sizeof( _callbackData->layer_data ) );
+    __trace_bytes( trace, &_callbackData->incessantly, sizeof( _callbackData->incessantly ) );
+    __trace_bytes( trace, &_callbackData->immutable_matrix, sizeof( _callbackData->immutable_matrix ) );
+    __trace_bytes( trace, _callbackData->matrix, sizeof( ae_matrix34_t ) );
+    __trace_bytes( trace, &_callbackData->color, sizeof( _callbackData->color ) );
+    __trace_bytes( trace, &_callbackData->opacity, sizeof( _callbackData->opacity ) );
+    __trace_bytes( trace, &_callbackData->track_matte_layer, sizeof( _callbackData->track_matte_layer ) );
+
+    ++trace->provided;
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_node_deleter( const aeMovieNodeDeleterCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, &_callbackData->index, sizeof( _callbackData->index ) );
+    __trace_bytes( trace, &_callbackData->element_userdata, sizeof( _callbackData->element_userdata ) );
+
+    ++trace->deleted;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_node_update( const aeMovieNodeUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, &_callbackData->index, sizeof( _callbackData->index ) );
+    __trace_bytes( trace, &_callbackData->element_userdata, sizeof( _callbackData->element_userdata ) );
+    __trace_bytes( trace, &_callbackData->state, sizeof( _callbackData->state ) );
+
+    if( _callbackData->state == AE_MOVIE_STATE_UPDATE_BEGIN || _callbackData->state == AE_MOVIE_STATE_UPDATE_PROCESS )
+    {
+        __trace_bytes( trace, _callbackData->matrix, sizeof( ae_matrix34_t ) );
+        __trace_bytes( trace, &_callbackData->color, sizeof( _callbackData->color ) );
+        __trace_bytes( trace, &_callbackData->opacity, sizeof( _callbackData->opacity ) );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_camera_provider( const aeMovieCameraProviderCallbackData * _callbackData, ae_userdataptr_t _cd, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, _callbackData->target, sizeof( ae_vector3_t ) );
+    __trace_bytes( trace, _callbackData->position, sizeof( ae_vector3_t ) );
+
+    ++trace->provided;
+
+    *_cd = (ae_userdata_t)trace;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_camera_deleter( const aeMovieCameraDeleterCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    AE_UNUSED( _callbackData );
+
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    ++trace->deleted;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_track_matte_provider( const aeMovieTrackMatteProviderCallbackData * _callbackData, ae_userdataptr_t _tmd, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, &_callbackData->index, sizeof( _callbackData->index ) );
+    __trace_bytes( trace, &_callbackData->element_userdata, sizeof( _callbackData->element_userdata ) );
+    __trace_bytes( trace, _callbackData->matrix, sizeof( ae_matrix34_t ) );
+    __trace_bytes( trace, &_callbackData->mesh->vertexCount, sizeof( _callbackData->mesh->vertexCount ) );
+
+    ++trace->provided;
+
+    *_tmd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_track_matte_deleter( const aeMovieTrackMatteDeleterCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, &_callbackData->track_matte_userdata, sizeof( _callbackData->track_matte_userdata ) );
+
+    ++trace->deleted;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_subcomposition_provider( const aeMovieSubCompositionProviderCallbackData * _callbackData, ae_userdataptr_t _scd, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, &_callbackData->layer_data, sizeof( _callbackData->layer_data ) );
+    __trace_bytes( trace, &_callbackData->composition_data, sizeof( _callbackData->composition_data ) );
+
+    ++trace->provided;
+
+    *_scd = (ae_userdata_t)(ae_size_t)trace->provided;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_subcomposition_deleter( const aeMovieSubCompositionDeleterCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_composition_template_trace_t * trace = (test_composition_template_trace_t *)_ud;
+
+    __trace_bytes( trace, &_callbackData->subcomposition_userdata, sizeof( _callbackData->subcomposition_userdata ) );
+
+    ++trace->deleted;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __trace_composition_meshes( test_composition_template_trace_t * _trace, const aeMovieComposition * _composition )
+{
+    ae_uint32_t mesh_iterator = 0;
+
+    aeMovieRenderMesh mesh;
+    while( ae_compute_movie_mesh( _composition, &mesh_iterator, &mesh ) == AE_TRUE )
+    {
+        __trace_bytes( _trace, &mesh_iterator, sizeof( mesh_iterator ) );
+        __trace_bytes( _trace, &mesh.element_userdata, sizeof( mesh.element_userdata ) );
+        __trace_bytes( _trace, &mesh.vertexCount, sizeof( mesh.vertexCount ) );
+        __trace_bytes( _trace, mesh.position, sizeof( ae_vector3_t ) * mesh.vertexCount );
+        __trace_bytes( _trace, &mesh.color, sizeof( mesh.color ) );
+        __trace_bytes( _trace, &mesh.opacity, sizeof( mesh.opacity ) );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __play_composition_trace( test_composition_template_trace_t * _trace, const aeMovieComposition * _composition )
+{
+    ae_play_movie_composition( _composition, 0.f );
+
+    ae_uint32_t step = 0;
+    for( ; step != 4000 && ae_is_play_movie_composition( _composition ) == AE_TRUE; ++step )
+    {
+        ae_update_movie_composition( _composition, 0.0137f );
+
+        __trace_composition_meshes( _trace, _composition );
+    }
+
+    ae_time_t duration = ae_get_movie_composition_duration( _composition );
+
+    ae_uint32_t seed = 1;
+
+    ae_uint32_t jump = 0;
+    for( ; jump != test_composition_template_jumps; ++jump )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        ae_time_t time = duration * (ae_float_t)((seed >> 8) & 0xffff) / 65536.f;
+
+        ae_set_movie_composition_time( _composition, time );
+
+        __trace_composition_meshes( _trace, _composition );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __initialize_composition_template_providers( aeMovieCompositionProviders * _providers )
+{
+    ae_initialize_movie_composition_providers( _providers );
+
+    _providers->node_provider = &__movie_node_provider;
+    _providers->node_deleter = &__movie_node_deleter;
+    _providers->node_update = &__movie_node_update;
+    _providers->camera_provider = &__movie_camera_provider;
+    _providers->camera_deleter = &__movie_camera_deleter;
+    _providers->track_matte_provider = &__movie_track_matte_provider;
+    _providers->track_matte_deleter = &__movie_track_matte_deleter;
+    _providers->subcomposition_provider = &__movie_subcomposition_provider;
+    _providers->subcomposition_deleter = &__movie_subcomposition_deleter;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider_fail( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _callbackData );
+    AE_UNUSED( _nd );
+    AE_UNUSED( _ud );
+
+    return AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_composition_template_failure( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, test_allocator_t * _allocator )
+{
+    ae_uint32_t errors = 0;
+
+    ae_uint32_t live = _allocator->live;
+
+    //every allocation of the template and of a clone fails in turn, nothing may stay behind
+    ae_uint32_t fail_after = 0;
+    for( ;; ++fail_after )
+    {
+        _allocator->fail_after = fail_after;
+
+        const aeMovieCompositionTemplate * compositionTemplate = ae_create_movie_composition_template( _movieData, _compositionData, AE_TRUE );
+
+        _allocator->fail_after = ~0U;
+
+        if( compositionTemplate == AE_NULLPTR )
+        {
+            if( _allocator->live != live )
+            {
+                printf( "composition template: '%s' template leaked when allocation %u failed\n", ae_get_movie_composition_data_name( _compositionData ), fail_after );
+
+                ++errors;
+
+                live = _allocator->live;
+            }
+
+            continue;
+        }
+
+        aeMovieCompositionProviders movieCompositionProviders;
+        ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+        ae_uint32_t template_live = _allocator->live;
+
+        _allocator->fail_after = 0;
+
+        const aeMovieComposition * clone = ae_create_movie_composition_from_template( compositionTemplate, &movieCompositionProviders, AE_NULLPTR );
+
+        _allocator->fail_after = ~0U;
+
+        if( clone != AE_NULLPTR || _allocator->live != template_live )
+        {
+            printf( "composition template: '%s' clone leaked when allocation failed\n", ae_get_movie_composition_data_name( _compositionData ) );
+
+            ++errors;
+        }
+
+        //a failing provider must release the clone, and a composition made directly as well
+        movieCompositionProviders.node_provider = &__movie_node_provider_fail;
+
+        const aeMovieComposition * failed_clone = ae_create_movie_composition_from_template( compositionTemplate, &movieCompositionProviders, AE_NULLPTR );
+        const aeMovieComposition * failed_composition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+        if( failed_clone != AE_NULLPTR || failed_composition != AE_NULLPTR || _allocator->live != template_live )
+        {
+            printf( "composition template: '%s' composition leaked when a provider failed\n", ae_get_movie_composition_data_name( _compositionData ) );
+
+            ++errors;
+        }
+
+        ae_delete_movie_composition_template( compositionTemplate );
+
+        break;
+    }
+
+    if( _allocator->live != live )
+    {
+        ++errors;
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_composition_template( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData )
+{
+    ae_uint32_t errors = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    __initialize_composition_template_providers( &movieCompositionProviders );
+
+    test_composition_template_trace_t reference;
+    reference.hash = 2166136261U;
+    reference.provided = 0;
+    reference.deleted = 0;
+
+    const aeMovieComposition * referenceComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, &reference );
+
+    if( referenceComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    __play_composition_trace( &reference, referenceComposition );
+
+    ae_delete_movie_composition( referenceComposition );
+
+    const aeMovieCompositionTemplate * compositionTemplate = ae_create_movie_composition_template( _movieData, _compositionData, AE_TRUE );
+
+    if( compositionTemplate == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    test_composition_template_trace_t clone_traces[8];
+    const aeMovieComposition * clones[8];
+
+    ae_uint32_t clone_index = 0;
+    for( ; clone_index != test_composition_template_clone_count; ++clone_index )
+    {
+        test_composition_template_trace_t * trace = clone_traces + clone_index;
+
+        trace->hash = 2166136261U;
+        trace->provided = 0;
+        trace->deleted = 0;
+
+        clones[clone_index] = ae_create_movie_composition_from_template( compositionTemplate, &movieCompositionProviders, trace );
+
+        if( clones[clone_index] == AE_NULLPTR )
+        {
+            return 1;
+        }
+    }
+
+    //clones own all their state
+    ae_delete_movie_composition_template( compositionTemplate );
+
+    for( clone_index = 0; clone_index != test_composition_template_clone_count; ++clone_index )
+    {
+        test_composition_template_trace_t * trace = clone_traces + clone_index;
+
+        __play_composition_trace( trace, clones[clone_index] );
+
+        ae_delete_movie_composition( clones[clone_index] );
+
+        if( trace->hash != reference.hash || trace->provided != reference.provided || trace->deleted != reference.deleted )
+        {
+            printf( "composition template: '%s' clone %u differs\n", ae_get_movie_composition_data_name( _compositionData ), clone_index );
+
+            ++errors;
+        }
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __measure_composition_template( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData )
+{
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * spawns[64];
+
+    clock_t create_begin = clock();
+
+    ae_uint32_t spawn_index = 0;
+    for( ; spawn_index != test_composition_template_spawn_count; ++spawn_index )
+    {
+        spawns[spawn_index] = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+    }
+
+    clock_t create_end = clock();
+
+    for( spawn_index = 0; spawn_index != test_composition_template_spawn_count; ++spawn_index )
+    {
+        ae_delete_movie_composition( spawns[spawn_index] );
+    }
+
+    clock_t clone_begin = clock();
+
+    const aeMovieCompositionTemplate * compositionTemplate = ae_create_movie_composition_template( _movieData, _compositionData, AE_TRUE );
+
+    for( spawn_index = 0; spawn_index != test_composition_template_spawn_count; ++spawn_index )
+    {
+        spawns[spawn_index] = ae_create_movie_composition_from_template( compositionTemplate, &movieCompositionProviders, AE_NULLPTR );
+    }
+
+    clock_t clone_end = clock();
+
+    for( spawn_index = 0; spawn_index != test_composition_template_spawn_count; ++spawn_index )
+    {
+        ae_delete_movie_composition( spawns[spawn_index] );
+    }
+
+    ae_delete_movie_composition_template( compositionTemplate );
+
+    double create_us = (double)(create_end - create_begin) * 1000000.0 / (double)CLOCKS_PER_SEC;
+    double clone_us = (double)(clone_end - clone_begin) * 1000000.0 / (double)CLOCKS_PER_SEC;
+
+    printf( "composition template: '%s' %u spawns, create %.1f us, template and clone %.1f us\n"
+        , ae_get_movie_composition_data_name( _compositionData )
+        , test_composition_template_spawn_count
+        , create_us
+        , clone_us
+    );
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    test_allocator_t allocator;
+    allocator.live = 0;
+    allocator.fail_after = ~0U;
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , &allocator );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_composition_template( movieData, movieCompositionData );
+            errors += __test_composition_template_failure( movieData, movieCompositionData, &allocator );
+
+            if( ae_is_movie_composition_data_master( movieCompositionData ) == AE_TRUE )
+            {
+                __measure_composition_template( movieData, movieCompositionData );
+            }
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "composition template: %u compositions, %u errors\n", composition_total, errors );
+
+    if( errors != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,411 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+static const ae_uint32_t test_compute_movie_meshes_jumps = 50;
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_compute_movie_meshes_alloc_count;
+static ae_uint32_t test_compute_movie_meshes_live_count;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    ++test_compute_movie_meshes_alloc_count;
+    ++test_compute_movie_meshes_live_count;
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ++test_compute_movie_meshes_alloc_count;
+    ++test_compute_movie_meshes_live_count;
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    if( _ptr != AE_NULLPTR ) {
+        --test_compute_movie_meshes_live_count;
+    }
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    if( _ptr != AE_NULLPTR ) {
+        --test_compute_movie_meshes_live_count;
+    }
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __compare_composition_meshes( const aeMovieComposition * _composition, aeMovieRenderMesh * _mesh, aeMovieRenderMeshes * _meshes )
+{
+    if( ae_compute_movie_meshes( _composition, _meshes ) == AE_FALSE )
+    {
+        return 1;
+    }
+
+    ae_uint32_t errors = 0;
+
+    ae_uint32_t vertex_offset = 0;
+    ae_uint32_t index_offset = 0;
+
+    ae_uint32_t draw_index = 0;
+
+    ae_uint32_t mesh_iterator = 0;
+    while( ae_compute_movie_mesh( _composition, &mesh_iterator, _mesh ) == AE_TRUE )
+    {
+        if( draw_index == _meshes->draw_count )
+        {
+            return errors + 1;
+        }
+
+        const aeMovieRenderDraw * draw = _meshes->draws + draw_index++;
+
+        if( draw->layer_type != _mesh->layer_type
+            || draw->blend_mode != _mesh->blend_mode
+            || draw->resource != _mesh->resource
+            || draw->vertex_offset != vertex_offset
+            || draw->vertex_count != _mesh->vertexCount
+            || draw->index_offset != index_offset
+            || draw->index_count != _mesh->indexCount
+            || draw->vertex_base > draw->vertex_offset
+            || draw->uv_cache_userdata != _mesh->uv_cache_userdata
+            || memcmp( &draw->color, &_mesh->color, sizeof( ae_color_t ) ) != 0
+            || draw->opacity != _mesh->opacity
+            || draw->camera_userdata != _mesh->camera_userdata
+            || draw->track_matte_mode != _mesh->track_matte_mode
+            || draw->track_matte_userdata != _mesh->track_matte_userdata
+            || draw->viewport != _mesh->viewport
+            || draw->shader_userdata != _mesh->shader_userdata
+            || draw->element_userdata != _mesh->element_userdata )
+        {
+            ++errors;
+
+            continue;
+        }
+
+        vertex_offset += _mesh->vertexCount;
+        index_offset += _mesh->indexCount;
+
+        if( _mesh->vertexCount == 0 )
+        {
+            continue;
+        }
+
+        if( memcmp( _meshes->positions + draw->vertex_offset, _mesh->position, sizeof( ae_vector3_t ) * _mesh->vertexCount ) != 0
+            || memcmp( _meshes->uvs + draw->vertex_offset, _mesh->uv, sizeof( ae_vector2_t ) * _mesh->vertexCount ) != 0 )
+        {
+            ++errors;
+
+            continue;
+        }
+
+        ae_uint32_t index = 0;
+        for( ; index != _mesh->indexCount; ++index )
+        {
+            ae_uint32_t packed = draw->vertex_base + _meshes->indices[draw->index_offset + index];
+
+            if( packed != draw->vertex_offset + _mesh->indices[index] )
+            {
+                ++errors;
+
+                break;
+            }
+        }
+    }
+
+    if( draw_index != _meshes->draw_count || vertex_offset != _meshes->vertex_count || index_offset != _meshes->index_count )
+    {
+        ++errors;
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_compute_movie_meshes( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, aeMovieRenderMesh * _mesh, aeMovieRenderMeshes * _meshes )
+{
+    ae_uint32_t errors = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t step = 0;
+    for( ; step != 4000 && ae_is_play_movie_composition( movieComposition ) == AE_TRUE; ++step )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+
+        errors += __compare_composition_meshes( movieComposition, _mesh, _meshes );
+    }
+
+    ae_time_t duration = ae_get_movie_composition_duration( movieComposition );
+
+    ae_uint32_t seed = 1;
+
+    ae_uint32_t jump = 0;
+    for( ; jump != test_compute_movie_meshes_jumps; ++jump )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        ae_time_t time = duration * (ae_float_t)((seed >> 8) & 0xffff) / 65536.f;
+
+        ae_set_movie_composition_time( movieComposition, time );
+
+        errors += __compare_composition_meshes( movieComposition, _mesh, _meshes );
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    if( errors != 0 )
+    {
+        printf( "compute movie meshes: '%s' %u frames differ\n", ae_get_movie_composition_data_name( _compositionData ), errors );
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_compute_movie_meshes_host_t
+{
+    ae_vector3_t * positions;
+    ae_vector2_t * uvs;
+    ae_uint16_t * indices;
+
+    ae_uint32_t capacity;
+} test_compute_movie_meshes_host_t;
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __measure_compute_movie_meshes( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, aeMovieRenderMesh * _mesh, aeMovieRenderMeshes * _meshes, test_compute_movie_meshes_host_t * _host )
+{
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    ae_play_movie_composition( movieComposition, 0.f );
+    ae_set_movie_composition_loop( movieComposition, AE_TRUE );
+
+    ae_uint32_t frame_count = 200;
+
+    clock_t mesh_time = 0;
+    clock_t meshes_time = 0;
+
+    ae_uint32_t mesh_draws = 0;
+    ae_uint32_t meshes_draws = 0;
+
+    ae_uint32_t alloc_count = test_compute_movie_meshes_alloc_count;
+
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count; ++frame )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+
+        clock_t mesh_begin = clock();
+
+        //what a host does today to upload once per frame: copy and rebase each mesh by hand
+        ae_uint32_t vertex_count = 0;
+        ae_uint32_t index_count = 0;
+
+        ae_uint32_t mesh_iterator = 0;
+        while( ae_compute_movie_mesh( movieComposition, &mesh_iterator, _mesh ) == AE_TRUE )
+        {
+            if( vertex_count + _mesh->vertexCount > _host->capacity || index_count + _mesh->indexCount > _host->capacity )
+            {
+                continue;
+            }
+
+            memcpy( _host->positions + vertex_count, _mesh->position, sizeof( ae_vector3_t ) * _mesh->vertexCount );
+            memcpy( _host->uvs + vertex_count, _mesh->uv, sizeof( ae_vector2_t ) * _mesh->vertexCount );
+
+            ae_uint32_t index = 0;
+            for( ; index != _mesh->indexCount; ++index )
+            {
+                _host->indices[index_count + index] = (ae_uint16_t)(vertex_count + _mesh->indices[index]);
+            }
+
+            vertex_count += _mesh->vertexCount;
+            index_count += _mesh->indexCount;
+
+            ++mesh_draws;
+        }
+
+        clock_t mesh_end = clock();
+
+        ae_compute_movie_meshes( movieComposition, _meshes );
+
+        clock_t meshes_end = clock();
+
+        meshes_draws += _meshes->draw_count;
+
+        mesh_time += mesh_end - mesh_begin;
+        meshes_time += meshes_end - mesh_end;
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    double mesh_us = (double)mesh_time * 1000000.0 / (double)CLOCKS_PER_SEC / (double)frame_count;
+    double meshes_us = (double)meshes_time * 1000000.0 / (double)CLOCKS_PER_SEC / (double)frame_count;
+
+    printf( "compute movie meshes: '%s' per mesh and copy %.2f us/frame (%u), whole frame %.2f us/frame (%u), %u buffer allocations\n"
+        , ae_get_movie_composition_data_name( _compositionData )
+        , mesh_us
+        , mesh_draws
+        , meshes_us
+        , meshes_draws
+        , test_compute_movie_meshes_alloc_count - alloc_count
+    );
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieRenderMesh * mesh = (aeMovieRenderMesh *)malloc( sizeof( aeMovieRenderMesh ) );
+
+    test_compute_movie_meshes_host_t host;
+    host.capacity = 64 * 1024;
+    host.positions = (ae_vector3_t *)malloc( sizeof( ae_vector3_t ) * host.capacity );
+    host.uvs = (ae_vector2_t *)malloc( sizeof( ae_vector2_t ) * host.capacity );
+    host.indices = (ae_uint16_t *)malloc( sizeof( ae_uint16_t ) * host.capacity );
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            aeMovieRenderMeshes meshes;
+            ae_initialize_movie_render_meshes( movieInstance, &meshes );
+
+            errors += __test_compute_movie_meshes( movieData, movieCompositionData, mesh, &meshes );
+
+            if( ae_is_movie_composition_data_master( movieCompositionData ) == AE_TRUE )
+            {
+                __measure_compute_movie_meshes( movieData, movieCompositionData, mesh, &meshes, &host );
+            }
+
+            ae_uint32_t live_count = test_compute_movie_meshes_live_count;
+
+            ae_finalize_movie_render_meshes( &meshes );
+
+            if( meshes.positions != AE_NULLPTR || meshes.draw_count != 0 || live_count - test_compute_movie_meshes_live_count != 4 )
+            {
+                printf( "compute movie meshes: '%s' finalize released %u buffers\n", ae_get_movie_composition_data_name( movieCompositionData ), live_count - test_compute_movie_meshes_live_count );
+
+                ++errors;
+            }
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "compute movie meshes: %u compositions, %u errors\n", composition_total, errors );
+
+    free( mesh );
+    free( host.positions );
+    free( host.uvs );
+    free( host.indices );
+
+    if( errors != 0 || test_compute_movie_meshes_live_count != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
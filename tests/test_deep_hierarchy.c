@@ -0,0 +1,304 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const ae_uint32_t test_deep_hierarchy_chain_count = 4;
+static const ae_uint32_t test_deep_hierarchy_chain_length = 1024;
+static const ae_uint32_t test_deep_hierarchy_frame_count = 10;
+static const ae_uint32_t test_deep_hierarchy_repeat = 8;
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_writer_t
+{
+    ae_uint8_t * buffer;
+    ae_size_t size;
+} test_writer_t;
+//////////////////////////////////////////////////////////////////////////
+static void __write_bytes( test_writer_t * _writer, const void * _data, ae_size_t _size )
+{
+    memcpy( _writer->buffer + _writer->size, _data, _size );
+
+    _writer->size += _size;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_u8( test_writer_t * _writer, ae_uint8_t _value )
+{
+    __write_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_u32( test_writer_t * _writer, ae_uint32_t _value )
+{
+    __write_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_f32( test_writer_t * _writer, ae_float_t _value )
+{
+    __write_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_size( test_writer_t * _writer, ae_uint32_t _value )
+{
+    if( _value < 255 )
+    {
+        __write_u8( _writer, (ae_uint8_t)_value );
+
+        return;
+    }
+
+    __write_u8( _writer, 255 );
+
+    if( _value < 65535 )
+    {
+        ae_uint16_t value16 = (ae_uint16_t)_value;
+        __write_bytes( _writer, &value16, sizeof( value16 ) );
+
+        return;
+    }
+
+    ae_uint16_t value65535 = 65535;
+    __write_bytes( _writer, &value65535, sizeof( value65535 ) );
+
+    __write_u32( _writer, _value );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_string( test_writer_t * _writer, const ae_char_t * _value )
+{
+    ae_uint32_t length = (ae_uint32_t)strlen( _value );
+
+    __write_size( _writer, length );
+    __write_bytes( _writer, _value, length );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_deep_hierarchy_movie( test_writer_t * _writer )
+{
+    ae_uint32_t layer_count = test_deep_hierarchy_chain_count * test_deep_hierarchy_chain_length;
+
+    ae_float_t frame_duration = 1.f / 30.f;
+
+    __write_bytes( _writer, "AEM1", 4 );
+    __write_u32( _writer, AE_MOVIE_SDK_MAJOR_VERSION );
+    __write_u32( _writer, AE_MOVIE_SDK_MINOR_VERSION );
+    __write_u32( _writer, 0 );
+
+    __write_string( _writer, "DeepHierarchy" );
+    __write_u8( _writer, 0 );
+
+    //atlases, resources
+    __write_size( _writer, 0 );
+    __write_size( _writer, 0 );
+
+    __write_size( _writer, 1 );
+
+    __write_string( _writer, "DeepHierarchy" );
+    __write_u8( _writer, 1 );
+    __write_f32( _writer, 1024.f );
+    __write_f32( _writer, 1024.f );
+    __write_f32( _writer, frame_duration * (ae_float_t)test_deep_hierarchy_frame_count );
+    __write_f32( _writer, frame_duration );
+    __write_f32( _writer, 30.f );
+    __write_u8( _writer, 0 );
+
+    __write_size( _writer, layer_count );
+
+    //children are written before their parents
+    ae_uint32_t position = 0;
+    for( ; position != layer_count; ++position )
+    {
+        ae_uint32_t chain = position % test_deep_hierarchy_chain_count;
+        ae_uint32_t deep = test_deep_hierarchy_chain_length - 1 - position / test_deep_hierarchy_chain_count;
+
+        ae_uint32_t layer_index = chain * test_deep_hierarchy_chain_length + deep + 1;
+
+        ae_char_t layer_name[32];
+        sprintf( layer_name, "c%u_d%u", chain, deep );
+
+        __write_string( _writer, layer_name );
+        __write_size( _writer, layer_index );
+        __write_u8( _writer, 0 );
+        __write_u8( _writer, 0 );
+        __write_u8( _writer, AE_MOVIE_LAYER_TYPE_NULL );
+        __write_size( _writer, test_deep_hierarchy_frame_count );
+
+        //extensions
+        __write_u8( _writer, 0 );
+
+        //no resource
+        __write_u8( _writer, 1 );
+        __write_size( _writer, 0 );
+
+        __write_size( _writer, deep == 0 ? 0 : layer_index - 1 );
+
+        __write_f32( _writer, 0.f );
+        __write_f32( _writer, frame_duration * (ae_float_t)test_deep_hierarchy_frame_count );
+        __write_f32( _writer, 0.f );
+        __write_f32( _writer, frame_duration * (ae_float_t)test_deep_hierarchy_frame_count );
+
+        __write_u8( _writer, 0 );
+        __write_u8( _writer, 0 );
+        __write_u8( _writer, 0 );
+        __write_u8( _writer, 0 );
+
+        //options
+        __write_u32( _writer, 0 );
+
+        __write_size( _writer, 1 );
+        __write_f32( _writer, 1.f );
+
+        //every property immutable, all but position x are identity
+        __write_u32( _writer, 0xFFFFFFFF );
+        __write_u32( _writer, 0xFFFFFFFF ^ 0x00000010 );
+        __write_f32( _writer, 1.f );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_deep_hierarchy_errors;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    ae_uint32_t chain;
+    ae_uint32_t deep;
+    if( sscanf( ae_get_movie_layer_data_name( _callbackData->layer_data ), "c%u_d%u", &chain, &deep ) != 2 )
+    {
+        ++test_deep_hierarchy_errors;
+
+        return AE_FALSE;
+    }
+
+    //each level adds one unit of translation to its parent
+    if( _callbackData->matrix[9] != (ae_float_t)(deep + 1) )
+    {
+        ++test_deep_hierarchy_errors;
+    }
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+    AE_UNUSED( argv );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    test_writer_t writer;
+    writer.buffer = (ae_uint8_t *)malloc( 128 * test_deep_hierarchy_chain_count * test_deep_hierarchy_chain_length + 256 );
+    writer.size = 0;
+
+    __write_deep_hierarchy_movie( &writer );
+
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+    aeMovieStream * movieStream = ae_create_movie_stream_memory( movieInstance, writer.buffer, &__memory_copy, AE_NULLPTR );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        printf( "deep hierarchy: load result %d\n", load_movie_data_result );
+
+        return EXIT_FAILURE;
+    }
+
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( movieData, "DeepHierarchy" );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+
+    clock_t clock_begin = clock();
+
+    ae_uint32_t repeat = 0;
+    for( ; repeat != test_deep_hierarchy_repeat; ++repeat )
+    {
+        const aeMovieComposition * movieComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+        if( movieComposition == AE_NULLPTR )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_delete_movie_composition( movieComposition );
+    }
+
+    clock_t clock_end = clock();
+
+    if( test_deep_hierarchy_errors != 0 )
+    {
+        printf( "deep hierarchy: %u nodes with wrong matrix\n", test_deep_hierarchy_errors );
+
+        return EXIT_FAILURE;
+    }
+
+    double us = (double)(clock_end - clock_begin) * 1000000.0 / (double)CLOCKS_PER_SEC / (double)test_deep_hierarchy_repeat;
+
+    printf( "deep hierarchy: %u chains of %u layers, create %.3f us/composition\n", test_deep_hierarchy_chain_count, test_deep_hierarchy_chain_length, us );
+
+    ae_delete_movie_data( movieData );
+
+    ae_delete_movie_instance( movieInstance );
+
+    free( writer.buffer );
+
+    return EXIT_SUCCESS;
+}
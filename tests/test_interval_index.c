@@ -0,0 +1,407 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_path = "examples/resources/Peacock/Peacock.aem";
+static const ae_char_t * test_example_composition_name = "Peacock_React";
+
+static const ae_uint32_t test_interval_index_jumps = 400;
+
+static const ae_char_t * test_trace_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __hash_bytes( ae_uint32_t _hash, ae_constvoidptr_t _data, ae_size_t _size )
+{
+    const ae_uint8_t * it_byte = (const ae_uint8_t *)_data;
+    const ae_uint8_t * it_byte_end = it_byte + _size;
+    for( ; it_byte != it_byte_end; ++it_byte )
+    {
+        _hash = (_hash ^ *it_byte) * 16777619U;
+    }
+
+    return _hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_node_update_hash;
+static ae_uint32_t test_node_count;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    if( test_node_count <= _callbackData->index )
+    {
+        test_node_count = _callbackData->index + 1U;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_node_update( const aeMovieNodeUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    test_node_update_hash = __hash_bytes( test_node_update_hash, &_callbackData->index, sizeof( _callbackData->index ) );
+    test_node_update_hash = __hash_bytes( test_node_update_hash, &_callbackData->state, sizeof( _callbackData->state ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __hash_movie_composition_meshes( const aeMovieComposition * _composition )
+{
+    ae_uint32_t hash = test_node_update_hash;
+
+    ae_uint32_t iterator = 0;
+    aeMovieRenderMesh movieRenderMesh;
+    while( ae_compute_movie_mesh( _composition, &iterator, &movieRenderMesh ) == AE_TRUE )
+    {
+        hash = __hash_bytes( hash, movieRenderMesh.position, sizeof( ae_vector3_t ) * movieRenderMesh.vertexCount );
+
+        hash = (hash ^ (ae_uint32_t)(movieRenderMesh.opacity * 255.f)) * 16777619U;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __seek_movie_composition( const aeMovieComposition * _composition, ae_time_t _time )
+{
+    //rewind first, the seek then sweeps forward from the composition begin
+    ae_set_movie_composition_time( _composition, 0.f );
+
+    test_node_update_hash = 2166136261U;
+
+    ae_set_movie_composition_time( _composition, _time );
+
+    ae_uint32_t hash = __hash_movie_composition_meshes( _composition );
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __step_movie_composition( const aeMovieComposition * _composition, ae_time_t _timing )
+{
+    test_node_update_hash = 2166136261U;
+
+    ae_update_movie_composition( _composition, _timing );
+
+    ae_uint32_t hash = __hash_movie_composition_meshes( _composition );
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __trace_movie_composition_play( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, const aeMovieCompositionProviders * _providers )
+{
+    test_node_count = 0;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, _providers, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_time_t duration = ae_get_movie_composition_data_duration( _compositionData );
+    ae_time_t timing = ae_get_movie_composition_data_frame_duration( _compositionData ) * 0.37f;
+
+    ae_uint32_t step_count = (ae_uint32_t)(duration / timing) + 1U;
+
+    //the full visit build prints the same trace, the test compares both
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    const ae_char_t * name = ae_get_movie_composition_data_name( _compositionData );
+
+    ae_uint32_t step = 0;
+    for( ; step != step_count + step_count / 2U; ++step )
+    {
+        printf( "%s play %u %08x\n", name, step, __step_movie_composition( movieComposition, timing ) );
+    }
+
+    ae_set_movie_composition_loop( movieComposition, AE_TRUE );
+    ae_play_movie_composition( movieComposition, duration * 0.25f );
+
+    for( step = 0; step != step_count * 2U + step_count / 2U; ++step )
+    {
+        printf( "%s loop %u %08x\n", name, step, __step_movie_composition( movieComposition, timing ) );
+    }
+
+    ae_interrupt_movie_composition( movieComposition, AE_FALSE );
+
+    for( step = 0; step != step_count + step_count / 2U; ++step )
+    {
+        printf( "%s interrupt %u %08x\n", name, step, __step_movie_composition( movieComposition, timing ) );
+    }
+
+    ae_play_movie_composition( movieComposition, duration * 0.5f );
+
+    for( step = 0; step != step_count / 4U; ++step )
+    {
+        __step_movie_composition( movieComposition, timing );
+    }
+
+    ae_interrupt_movie_composition( movieComposition, AE_TRUE );
+
+    for( step = 0; step != step_count / 2U; ++step )
+    {
+        printf( "%s skip %u %08x\n", name, step, __step_movie_composition( movieComposition, timing ) );
+    }
+
+    //retimed nodes enter out of their baked order, the interval orders are sorted again
+    ae_uint32_t handle = 0;
+    for( ; handle != test_node_count; ++handle )
+    {
+        ae_time_t in = (handle % 2U == 0U) ? duration * 0.8f : duration * 0.4f;
+
+        ae_set_movie_composition_node_handle_in_out_time( movieComposition, handle, in, duration );
+    }
+
+    ae_set_movie_composition_loop( movieComposition, AE_FALSE );
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    for( step = 0; step != step_count; ++step )
+    {
+        printf( "%s retime %u %08x\n", name, step, __step_movie_composition( movieComposition, timing ) );
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static aeMovieData * __load_movie_data( const aeMovieInstance * _instance, const ae_char_t * _path )
+{
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    FILE * f = fopen( _path, "rb" );
+
+    if( f == NULL )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( _instance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    fclose( f );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return AE_NULLPTR;
+    }
+
+    return movieData;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __trace_movie_data_play( const aeMovieInstance * _instance, const ae_char_t * _testsPath, const aeMovieCompositionProviders * _providers )
+{
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_trace_file_paths ) / sizeof( test_trace_file_paths[0] ); ++file_index )
+    {
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , _testsPath
+            , test_trace_file_paths[file_index]
+        );
+
+        aeMovieData * movieData = __load_movie_data( _instance, full_example_file_path );
+
+        if( movieData == AE_NULLPTR )
+        {
+            return AE_FALSE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            if( __trace_movie_composition_play( movieData, movieCompositionData, _providers ) == AE_FALSE )
+            {
+                return AE_FALSE;
+            }
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+    movieCompositionProviders.node_update = &__movie_node_update;
+
+    //prints the play, loop and interrupt trace, the full visit build must print the same one
+    if( argc > 2 && strcmp( argv[2], "play" ) == 0 )
+    {
+        if( __trace_movie_data_play( movieInstance, argv[1], &movieCompositionProviders ) == AE_FALSE )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_delete_movie_instance( movieInstance );
+
+        return EXIT_SUCCESS;
+    }
+
+    char full_example_file_path[256];
+    sprintf( full_example_file_path, "%s/../%s"
+        , argv[1]
+        , test_example_file_path
+    );
+
+    aeMovieData * movieData = __load_movie_data( movieInstance, full_example_file_path );
+
+    if( movieData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t frame_count = ae_get_movie_composition_data_frame_count( movieCompositionData );
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    ae_uint32_t * frame_hashes = (ae_uint32_t *)malloc( sizeof( ae_uint32_t ) * frame_count );
+
+    //every reference frame comes from a fresh composition, its first update visit all nodes
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count; ++frame )
+    {
+        const aeMovieComposition * referenceComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+        if( referenceComposition == AE_NULLPTR )
+        {
+            return EXIT_FAILURE;
+        }
+
+        frame_hashes[frame] = __seek_movie_composition( referenceComposition, (ae_time_t)frame * frame_duration );
+
+        ae_delete_movie_composition( referenceComposition );
+    }
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    //forward and random seeks reuse the sweep state left by the previous ones
+    for( frame = 0; frame != frame_count; ++frame )
+    {
+        if( frame_hashes[frame] != __seek_movie_composition( movieComposition, (ae_time_t)frame * frame_duration ) )
+        {
+            printf( "interval index: frame %u mismatch\n", frame );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    ae_uint32_t seed = 1U;
+
+    ae_uint32_t jump = 0;
+    for( ; jump != test_interval_index_jumps; ++jump )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        frame = (seed >> 8) % frame_count;
+
+        if( frame_hashes[frame] != __seek_movie_composition( movieComposition, (ae_time_t)frame * frame_duration ) )
+        {
+            printf( "interval index: jump %u frame %u mismatch\n", jump, frame );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf( "interval index: %u frames, %u jumps\n", frame_count, test_interval_index_jumps );
+
+    free( frame_hashes );
+
+    ae_delete_movie_composition( movieComposition );
+
+    ae_delete_movie_data( movieData );
+
+    ae_delete_movie_instance( movieInstance );
+
+    return EXIT_SUCCESS;
+}
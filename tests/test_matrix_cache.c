@@ -0,0 +1,331 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_path = "examples/resources/Unicorn/Unicorn.aem";
+static const ae_char_t * test_example_composition_name = "Unicorn";
+
+static const ae_uint32_t test_matrix_cache_capacity = 512;
+static const ae_uint32_t test_matrix_cache_loop_frames = 30;
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_allocator_t
+{
+    ae_uint32_t live;
+
+    //allocations left before the next one fails, ~0U never fails
+    ae_uint32_t fail_after;
+} test_allocator_t;
+//////////////////////////////////////////////////////////////////////////
+static ae_voidptr_t __test_allocator_malloc( test_allocator_t * _allocator, ae_size_t _size )
+{
+    if( _allocator->fail_after != ~0U )
+    {
+        if( _allocator->fail_after == 0 )
+        {
+            return AE_NULLPTR;
+        }
+
+        --_allocator->fail_after;
+    }
+
+    ++_allocator->live;
+
+    return malloc( _size );
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __test_allocator_free( test_allocator_t * _allocator, ae_constvoidptr_t _ptr )
+{
+    if( _ptr == AE_NULLPTR )
+    {
+        return;
+    }
+
+    --_allocator->live;
+
+    free( (ae_voidptr_t)_ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    return __test_allocator_malloc( (test_allocator_t *)_userdata, _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    ae_size_t total = _size * _count;
+    return __test_allocator_malloc( (test_allocator_t *)_userdata, total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    __test_allocator_free( (test_allocator_t *)_data, _ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    __test_allocator_free( (test_allocator_t *)_data, _ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __hash_movie_composition_meshes( const aeMovieComposition * _composition )
+{
+    ae_uint32_t hash = 2166136261U;
+
+    ae_uint32_t iterator = 0;
+    aeMovieRenderMesh movieRenderMesh;
+    while( ae_compute_movie_mesh( _composition, &iterator, &movieRenderMesh ) == AE_TRUE )
+    {
+        const ae_uint8_t * it_byte = (const ae_uint8_t *)movieRenderMesh.position;
+        const ae_uint8_t * it_byte_end = it_byte + sizeof( ae_vector3_t ) * movieRenderMesh.vertexCount;
+        for( ; it_byte != it_byte_end; ++it_byte )
+        {
+            hash = (hash ^ *it_byte) * 16777619U;
+        }
+
+        hash = (hash ^ (ae_uint32_t)(movieRenderMesh.opacity * 255.f)) * 16777619U;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static aeMovieData * __load_movie_data( const aeMovieInstance * _instance, const ae_char_t * _testsPath )
+{
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    char full_example_file_path[256];
+    sprintf( full_example_file_path, "%s/../%s"
+        , _testsPath
+        , test_example_file_path
+    );
+
+    FILE * f = fopen( full_example_file_path, "rb" );
+
+    if( f == NULL )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( _instance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    fclose( f );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return AE_NULLPTR;
+    }
+
+    return movieData;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __test_matrix_cache_out_of_memory( const aeMovieInstance * _instance, test_allocator_t * _allocator, const ae_char_t * _testsPath )
+{
+    //fail every allocation of the enable in turn, deleting the data must give all of them back
+    ae_uint32_t fail_after = 0;
+    for( ;; ++fail_after )
+    {
+        ae_uint32_t live = _allocator->live;
+
+        aeMovieData * movieData = __load_movie_data( _instance, _testsPath );
+
+        if( movieData == AE_NULLPTR )
+        {
+            return AE_FALSE;
+        }
+
+        aeMovieCompositionData * movieCompositionData = (aeMovieCompositionData *)ae_get_movie_composition_data( movieData, test_example_composition_name );
+
+        _allocator->fail_after = fail_after;
+
+        ae_bool_t successful = ae_enable_movie_composition_data_matrix_cache( movieData, movieCompositionData, test_matrix_cache_capacity );
+
+        _allocator->fail_after = ~0U;
+
+        ae_delete_movie_data( movieData );
+
+        if( _allocator->live != live )
+        {
+            printf( "matrix cache: %u allocations leaked when allocation %u failed\n", _allocator->live - live, fail_after );
+
+            return AE_FALSE;
+        }
+
+        if( successful == AE_TRUE )
+        {
+            break;
+        }
+    }
+
+    printf( "matrix cache: %u allocation failures recovered\n", fail_after );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    test_allocator_t allocator;
+    allocator.live = 0;
+    allocator.fail_after = ~0U;
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , &allocator );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_matrix_cache_out_of_memory( movieInstance, &allocator, argv[1] ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieData * movieData = __load_movie_data( movieInstance, argv[1] );
+
+    if( movieData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionData * movieCompositionData = (aeMovieCompositionData *)ae_get_movie_composition_data( movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * referenceComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( referenceComposition == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t frame_count = ae_get_movie_composition_data_frame_count( movieCompositionData );
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    ae_uint32_t * frame_hashes = (ae_uint32_t *)malloc( sizeof( ae_uint32_t ) * frame_count );
+
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count; ++frame )
+    {
+        ae_set_movie_composition_time( referenceComposition, (ae_time_t)frame * frame_duration );
+
+        frame_hashes[frame] = __hash_movie_composition_meshes( referenceComposition );
+    }
+
+    ae_delete_movie_composition( referenceComposition );
+
+    if( ae_enable_movie_composition_data_matrix_cache( movieData, movieCompositionData, test_matrix_cache_capacity ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    //first pass over a short loop fills the cache, the second one is served from it
+    ae_uint32_t loop = 0;
+    for( ; loop != 2; ++loop )
+    {
+        for( frame = 0; frame != test_matrix_cache_loop_frames; ++frame )
+        {
+            ae_set_movie_composition_time( movieComposition, (ae_time_t)frame * frame_duration );
+
+            if( frame_hashes[frame] != __hash_movie_composition_meshes( movieComposition ) )
+            {
+                printf( "matrix cache: loop frame %u mismatch\n", frame );
+
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    aeMovieCompositionDataMatrixCacheStatistics statistics;
+    if( ae_get_movie_composition_data_matrix_cache_statistics( movieCompositionData, &statistics ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( statistics.hits == 0 || statistics.misses == 0 )
+    {
+        printf( "matrix cache: hits %u misses %u\n", statistics.hits, statistics.misses );
+
+        return EXIT_FAILURE;
+    }
+
+    //full playback overflows the cache and forces evictions
+    for( frame = 0; frame != frame_count; ++frame )
+    {
+        ae_set_movie_composition_time( movieComposition, (ae_time_t)frame * frame_duration );
+
+        if( frame_hashes[frame] != __hash_movie_composition_meshes( movieComposition ) )
+        {
+            printf( "matrix cache: frame %u mismatch\n", frame );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    ae_get_movie_composition_data_matrix_cache_statistics( movieCompositionData, &statistics );
+
+    if( statistics.evictions == 0 || statistics.count > statistics.capacity )
+    {
+        printf( "matrix cache: evictions %u count %u\n", statistics.evictions, statistics.count );
+
+        return EXIT_FAILURE;
+    }
+
+    printf( "matrix cache: %u frames, hits %u misses %u evictions %u\n", frame_count, statistics.hits, statistics.misses, statistics.evictions );
+
+    free( frame_hashes );
+
+    ae_delete_movie_composition( movieComposition );
+
+    ae_delete_movie_data( movieData );
+
+    ae_delete_movie_instance( movieInstance );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,236 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_path = "examples/resources/Unicorn/Unicorn.aem";
+static const ae_char_t * test_example_composition_name = "Unicorn";
+
+static const ae_uint32_t test_matrix_dirty_pause_frames = 10;
+
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_node_update_count;
+static ae_uint32_t test_node_changed_count;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_node_update( const aeMovieNodeUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    ++test_node_update_count;
+
+    if( _callbackData->matrix_changed == AE_TRUE )
+    {
+        ++test_node_changed_count;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __hash_movie_composition_meshes( const aeMovieComposition * _composition )
+{
+    ae_uint32_t hash = 2166136261U;
+
+    ae_uint32_t iterator = 0;
+    aeMovieRenderMesh movieRenderMesh;
+    while( ae_compute_movie_mesh( _composition, &iterator, &movieRenderMesh ) == AE_TRUE )
+    {
+        const ae_uint8_t * it_byte = (const ae_uint8_t *)movieRenderMesh.position;
+        const ae_uint8_t * it_byte_end = it_byte + sizeof( ae_vector3_t ) * movieRenderMesh.vertexCount;
+        for( ; it_byte != it_byte_end; ++it_byte )
+        {
+            hash = (hash ^ *it_byte) * 16777619U;
+        }
+
+        hash = (hash ^ (ae_uint32_t)(movieRenderMesh.opacity * 255.f)) * 16777619U;
+    }
+
+    return hash;
+}
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+    AE_UNUSED( argv );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+    char full_example_file_path[256];
+    sprintf( full_example_file_path, "%s/../%s"
+        , argv[1]
+        , test_example_file_path
+    );
+
+    FILE * f = fopen( full_example_file_path, "rb" );
+
+    if( f == NULL )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return EXIT_FAILURE;
+    }
+
+    fclose( f );
+
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+    movieCompositionProviders.node_update = &__movie_node_update;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t frame_count = ae_get_movie_composition_data_frame_count( movieCompositionData );
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t changed_total = 0;
+    ae_uint32_t resume_total = 0;
+
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count && ae_is_play_movie_composition( movieComposition ) == AE_TRUE; ++frame )
+    {
+        test_node_update_count = 0;
+        test_node_changed_count = 0;
+
+        ae_update_movie_composition( movieComposition, frame_duration );
+
+        changed_total += test_node_changed_count;
+
+        if( frame % test_matrix_dirty_pause_frames != 0 )
+        {
+            continue;
+        }
+
+        ae_pause_movie_composition( movieComposition );
+
+        ae_uint32_t hash = __hash_movie_composition_meshes( movieComposition );
+
+        //resume rescan the same frame, nothing is rebuilt or reported as changed
+        test_node_update_count = 0;
+        test_node_changed_count = 0;
+
+        ae_resume_movie_composition( movieComposition );
+
+        if( test_node_changed_count != 0 )
+        {
+            printf( "matrix dirty: frame %u resume reported %u changed of %u\n", frame, test_node_changed_count, test_node_update_count );
+
+            return EXIT_FAILURE;
+        }
+
+        if( hash != __hash_movie_composition_meshes( movieComposition ) )
+        {
+            printf( "matrix dirty: frame %u mismatch\n", frame );
+
+            return EXIT_FAILURE;
+        }
+
+        resume_total += test_node_update_count;
+    }
+
+    if( changed_total == 0 || resume_total == 0 )
+    {
+        printf( "matrix dirty: changed %u resumed %u\n", changed_total, resume_total );
+
+        return EXIT_FAILURE;
+    }
+
+    printf( "matrix dirty: %u frames, %u changed, %u resumed, %u rebuilds skipped\n", frame, changed_total, resume_total, ae_get_movie_composition_matrix_skip_count( movieComposition ) );
+
+    ae_delete_movie_composition( movieComposition );
+
+    ae_delete_movie_data( movieData );
+
+    ae_delete_movie_instance( movieInstance );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,373 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_path = "examples/resources/Unicorn/Unicorn.aem";
+static const ae_char_t * test_example_composition_name = "Unicorn";
+
+static const ae_char_t * test_interpolate_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __hash_movie_composition_meshes( const aeMovieComposition * _composition )
+{
+    ae_uint32_t hash = 2166136261U;
+
+    ae_uint32_t iterator = 0;
+    aeMovieRenderMesh movieRenderMesh;
+    while( ae_compute_movie_mesh( _composition, &iterator, &movieRenderMesh ) == AE_TRUE )
+    {
+        const ae_uint8_t * it_byte = (const ae_uint8_t *)movieRenderMesh.position;
+        const ae_uint8_t * it_byte_end = it_byte + sizeof( ae_vector3_t ) * movieRenderMesh.vertexCount;
+        for( ; it_byte != it_byte_end; ++it_byte )
+        {
+            hash = (hash ^ *it_byte) * 16777619U;
+        }
+
+        hash = (hash ^ (ae_uint32_t)(movieRenderMesh.opacity * 255.f)) * 16777619U;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static aeMovieData * __load_movie_data( const aeMovieInstance * _instance, const ae_char_t * _path )
+{
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    FILE * f = fopen( _path, "rb" );
+
+    if( f == NULL )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( _instance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    fclose( f );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return AE_NULLPTR;
+    }
+
+    return movieData;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __compare_movie_composition_meshes( const aeMovieComposition * _hold, const aeMovieComposition * _baseline )
+{
+    ae_uint32_t hold_iterator = 0;
+    ae_uint32_t baseline_iterator = 0;
+
+    aeMovieRenderMesh hold_mesh;
+    aeMovieRenderMesh baseline_mesh;
+    while( ae_compute_movie_mesh( _hold, &hold_iterator, &hold_mesh ) == AE_TRUE )
+    {
+        if( ae_compute_movie_mesh( _baseline, &baseline_iterator, &baseline_mesh ) == AE_FALSE )
+        {
+            return 1;
+        }
+
+        if( hold_mesh.vertexCount != baseline_mesh.vertexCount
+            || memcmp( hold_mesh.position, baseline_mesh.position, sizeof( ae_vector3_t ) * hold_mesh.vertexCount ) != 0
+            || hold_mesh.opacity != baseline_mesh.opacity )
+        {
+            return 1;
+        }
+    }
+
+    if( ae_compute_movie_mesh( _baseline, &baseline_iterator, &baseline_mesh ) == AE_TRUE )
+    {
+        return 1;
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_matrix_hold_interpolate( const aeMovieInstance * _instance, const ae_char_t * _path, ae_uint32_t * _skipCount )
+{
+    //baked timelines have no constant blocks, so they always take the per frame path
+    aeMovieData * movieDataHold = __load_movie_data( _instance, _path );
+    aeMovieData * movieDataBaseline = __load_movie_data( _instance, _path );
+
+    if( movieDataHold == AE_NULLPTR || movieDataBaseline == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_uint32_t errors = 0;
+
+    ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieDataHold );
+
+    ae_uint32_t composition_index = 0;
+    for( ; composition_index != composition_count; ++composition_index )
+    {
+        const aeMovieCompositionData * compositionDataBaseline = ae_get_movie_composition_data_by_index( movieDataBaseline, composition_index );
+
+        ae_size_t used = 0;
+        if( ae_bake_movie_composition_data( movieDataBaseline, compositionDataBaseline, (ae_size_t)~0U, &used ) == AE_FALSE )
+        {
+            return 1;
+        }
+    }
+
+    for( composition_index = 0; composition_index != composition_count; ++composition_index )
+    {
+        const aeMovieCompositionData * compositionDataHold = ae_get_movie_composition_data_by_index( movieDataHold, composition_index );
+        const aeMovieCompositionData * compositionDataBaseline = ae_get_movie_composition_data_by_index( movieDataBaseline, composition_index );
+
+        aeMovieCompositionProviders movieCompositionProviders;
+        ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+        const aeMovieComposition * compositionHold = ae_create_movie_composition( movieDataHold, compositionDataHold, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+        const aeMovieComposition * compositionBaseline = ae_create_movie_composition( movieDataBaseline, compositionDataBaseline, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+        if( compositionHold == AE_NULLPTR || compositionBaseline == AE_NULLPTR )
+        {
+            return 1;
+        }
+
+        ae_uint32_t mismatches = 0;
+
+        ae_play_movie_composition( compositionHold, 0.f );
+        ae_play_movie_composition( compositionBaseline, 0.f );
+
+        ae_uint32_t step = 0;
+        for( ; step != 4000 && ae_is_play_movie_composition( compositionHold ) == AE_TRUE; ++step )
+        {
+            ae_update_movie_composition( compositionHold, 0.0137f );
+            ae_update_movie_composition( compositionBaseline, 0.0137f );
+
+            mismatches += __compare_movie_composition_meshes( compositionHold, compositionBaseline );
+        }
+
+        ae_time_t duration = ae_get_movie_composition_duration( compositionHold );
+
+        srand( 1 );
+
+        ae_uint32_t jump = 0;
+        for( ; jump != 64; ++jump )
+        {
+            ae_time_t time = duration * (ae_time_t)(rand() % 4096) / 4096.f;
+
+            ae_set_movie_composition_time( compositionHold, time );
+            ae_set_movie_composition_time( compositionBaseline, time );
+
+            mismatches += __compare_movie_composition_meshes( compositionHold, compositionBaseline );
+        }
+
+        if( mismatches != 0 )
+        {
+            printf( "matrix hold: '%s' interpolated %u samples differ from the per frame path\n", ae_get_movie_composition_data_name( compositionDataHold ), mismatches );
+        }
+
+        errors += mismatches;
+
+        *_skipCount += ae_get_movie_composition_matrix_skip_count( compositionHold );
+
+        ae_delete_movie_composition( compositionHold );
+        ae_delete_movie_composition( compositionBaseline );
+    }
+
+    ae_delete_movie_data( movieDataHold );
+    ae_delete_movie_data( movieDataBaseline );
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+    AE_UNUSED( argv );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+    char full_example_file_path[256];
+    sprintf( full_example_file_path, "%s/../%s"
+        , argv[1]
+        , test_example_file_path
+    );
+
+    FILE * f = fopen( full_example_file_path, "rb" );
+
+    if( f == NULL )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return EXIT_FAILURE;
+    }
+
+    fclose( f );
+
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t frame_count = ae_get_movie_composition_data_frame_count( movieCompositionData );
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    ae_uint32_t * frame_hashes = (ae_uint32_t *)malloc( sizeof( ae_uint32_t ) * frame_count );
+
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count; ++frame )
+    {
+        ae_set_movie_composition_time( movieComposition, (ae_time_t)frame * frame_duration );
+
+        frame_hashes[frame] = __hash_movie_composition_meshes( movieComposition );
+    }
+
+    ae_uint32_t skip_count = ae_get_movie_composition_matrix_skip_count( movieComposition );
+
+    if( skip_count == 0 )
+    {
+        printf( "matrix hold: no rebuild skipped\n" );
+
+        return EXIT_FAILURE;
+    }
+
+    srand( 1 );
+
+    ae_uint32_t sample = 0;
+    for( ; sample != frame_count * 4; ++sample )
+    {
+        ae_uint32_t sample_frame = (ae_uint32_t)rand() % frame_count;
+
+        ae_set_movie_composition_time( movieComposition, (ae_time_t)sample_frame * frame_duration );
+
+        if( frame_hashes[sample_frame] != __hash_movie_composition_meshes( movieComposition ) )
+        {
+            printf( "matrix hold: frame %u mismatch\n", sample_frame );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf( "matrix hold: %u frames, %u rebuilds skipped\n", frame_count, ae_get_movie_composition_matrix_skip_count( movieComposition ) );
+
+    ae_uint32_t interpolate_errors = 0;
+    ae_uint32_t interpolate_skip_count = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_interpolate_file_paths ) / sizeof( test_interpolate_file_paths[0] ); ++file_index )
+    {
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_interpolate_file_paths[file_index]
+        );
+
+        interpolate_errors += __test_matrix_hold_interpolate( movieInstance, full_example_file_path, &interpolate_skip_count );
+    }
+
+    if( interpolate_errors != 0 || interpolate_skip_count == 0 )
+    {
+        printf( "matrix hold: interpolated %u errors, %u rebuilds skipped\n", interpolate_errors, interpolate_skip_count );
+
+        return EXIT_FAILURE;
+    }
+
+    printf( "matrix hold: interpolated equal to the per frame path, %u rebuilds skipped\n", interpolate_skip_count );
+
+    free( frame_hashes );
+
+    ae_delete_movie_composition( movieComposition );
+
+    ae_delete_movie_data( movieData );
+
+    ae_delete_movie_instance( movieInstance );
+
+    return EXIT_SUCCESS;
+}
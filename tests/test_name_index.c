@@ -0,0 +1,391 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+#define TEST_NAME_INDEX_MAX_NODES 4096
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_name_index_compare_count;
+//////////////////////////////////////////////////////////////////////////
+static ae_int32_t __caseless_strncmp( const ae_char_t * _src, const ae_char_t * _dst, ae_size_t _count )
+{
+    for( ; _count > 0; ++_src, ++_dst, --_count )
+    {
+        ae_int32_t src = tolower( (ae_uint8_t)*_src );
+        ae_int32_t dst = tolower( (ae_uint8_t)*_dst );
+
+        if( src != dst )
+        {
+            return src < dst ? -1 : 1;
+        }
+
+        if( src == 0 )
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_int32_t __counting_strncmp( ae_userdata_t _userdata, const ae_char_t * _src, const ae_char_t * _dst, ae_size_t _count )
+{
+    AE_UNUSED( _userdata );
+
+    ++test_name_index_compare_count;
+
+    return __caseless_strncmp( _src, _dst, _count );
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __test_name_equal( ae_bool_t _caseless, const ae_char_t * _src, const ae_char_t * _dst )
+{
+    if( _caseless == AE_TRUE )
+    {
+        return __caseless_strncmp( _src, _dst, AE_MOVIE_MAX_LAYER_NAME ) == 0 ? AE_TRUE : AE_FALSE;
+    }
+
+    return strcmp( _src, _dst ) == 0 ? AE_TRUE : AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_name_index_nodes_t
+{
+    ae_uint32_t count;
+    const ae_char_t * names[TEST_NAME_INDEX_MAX_NODES];
+} test_name_index_nodes_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    test_name_index_nodes_t * nodes = (test_name_index_nodes_t *)_ud;
+
+    if( _callbackData->index >= TEST_NAME_INDEX_MAX_NODES )
+    {
+        return AE_FALSE;
+    }
+
+    nodes->names[_callbackData->index] = ae_get_movie_layer_data_name( _callbackData->layer_data );
+
+    if( nodes->count <= _callbackData->index )
+    {
+        nodes->count = _callbackData->index + 1U;
+    }
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __render_name_index_nodes( const aeMovieComposition * _composition, ae_uint8_t * _rendered )
+{
+    memset( _rendered, 0, TEST_NAME_INDEX_MAX_NODES );
+
+    ae_uint32_t mesh_iterator = 0;
+
+    aeMovieRenderMesh mesh;
+    while( ae_compute_movie_mesh( _composition, &mesh_iterator, &mesh ) == AE_TRUE )
+    {
+        ae_size_t node_index = (ae_size_t)mesh.element_userdata - 1U;
+
+        _rendered[node_index] = 1;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_name_index_subcompositions_t
+{
+    const aeMovieComposition * composition;
+    ae_bool_t caseless;
+    ae_uint32_t errors;
+} test_name_index_subcompositions_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __visit_sub_composition( const aeMovieComposition * _composition, ae_uint32_t _index, const ae_char_t * _name, const aeMovieSubComposition * _subcomposition, ae_userdata_t _ud )
+{
+    AE_UNUSED( _index );
+
+    test_name_index_subcompositions_t * subcompositions = (test_name_index_subcompositions_t *)_ud;
+
+    const aeMovieSubComposition * found = ae_get_movie_sub_composition( _composition, _name );
+
+    //the first sub composition with this name is visited before any other
+    if( found == AE_NULLPTR || __test_name_equal( subcompositions->caseless, ae_get_movie_sub_composition_name( found ), _name ) == AE_FALSE || found > _subcomposition )
+    {
+        ++subcompositions->errors;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_name_index_composition( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _caseless )
+{
+    ae_uint32_t errors = 0;
+
+    test_name_index_nodes_t nodes;
+    nodes.count = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_FALSE, &movieCompositionProviders, &nodes );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_set_movie_composition_time( movieComposition, ae_get_movie_composition_duration( movieComposition ) * 0.5f );
+
+    ae_uint8_t baseline[TEST_NAME_INDEX_MAX_NODES];
+    __render_name_index_nodes( movieComposition, baseline );
+
+    ae_uint8_t rendered[TEST_NAME_INDEX_MAX_NODES];
+
+    ae_uint32_t index = 0;
+    for( ; index != nodes.count; ++index )
+    {
+        const ae_char_t * name = nodes.names[index];
+
+        ae_uint32_t first_index = 0;
+        while( __test_name_equal( _caseless, nodes.names[first_index], name ) == AE_FALSE )
+        {
+            ++first_index;
+        }
+
+        if( first_index != index )
+        {
+            continue;
+        }
+
+        test_name_index_compare_count = 0;
+
+        if( ae_has_movie_composition_node_any( movieComposition, name ) == AE_FALSE )
+        {
+            ++errors;
+        }
+
+        //a custom strncmp can't share the byte hash, lookups scan the nodes in order
+        if( _caseless == AE_TRUE && test_name_index_compare_count != first_index + 1U )
+        {
+            ++errors;
+        }
+
+        if( _caseless == AE_TRUE )
+        {
+            ae_char_t upper_name[AE_MOVIE_MAX_LAYER_NAME];
+
+            ae_uint32_t char_index = 0;
+            for( ; char_index != AE_MOVIE_MAX_LAYER_NAME - 1U && name[char_index] != '\0'; ++char_index )
+            {
+                upper_name[char_index] = (ae_char_t)toupper( (ae_uint8_t)name[char_index] );
+            }
+
+            upper_name[char_index] = '\0';
+
+            if( ae_has_movie_composition_node_any( movieComposition, upper_name ) == AE_FALSE )
+            {
+                ++errors;
+            }
+        }
+
+        ae_set_movie_composition_nodes_extra_opacity_any( movieComposition, name, 0.f );
+
+        __render_name_index_nodes( movieComposition, rendered );
+
+        ae_uint32_t node_index = 0;
+        for( ; node_index != nodes.count; ++node_index )
+        {
+            ae_uint8_t expected = __test_name_equal( _caseless, nodes.names[node_index], name ) == AE_TRUE ? 0 : baseline[node_index];
+
+            if( rendered[node_index] != expected )
+            {
+                ++errors;
+            }
+        }
+
+        ae_set_movie_composition_nodes_extra_opacity_any( movieComposition, name, 1.f );
+
+        ae_set_movie_composition_node_enable_any( movieComposition, name, AE_FALSE );
+
+        __render_name_index_nodes( movieComposition, rendered );
+
+        for( node_index = 0; node_index != nodes.count; ++node_index )
+        {
+            ae_uint8_t expected = node_index == first_index ? 0 : baseline[node_index];
+
+            if( rendered[node_index] != expected )
+            {
+                ++errors;
+            }
+        }
+
+        ae_set_movie_composition_node_enable_any( movieComposition, name, AE_TRUE );
+    }
+
+    test_name_index_compare_count = 0;
+
+    if( ae_has_movie_composition_node_any( movieComposition, "__test_name_index_missing__" ) == AE_TRUE )
+    {
+        ++errors;
+    }
+
+    if( _caseless == AE_TRUE && test_name_index_compare_count != nodes.count )
+    {
+        ++errors;
+    }
+
+    test_name_index_subcompositions_t subcompositions;
+    subcompositions.composition = movieComposition;
+    subcompositions.caseless = _caseless;
+    subcompositions.errors = 0;
+
+    ae_visit_movie_sub_composition( movieComposition, &__visit_sub_composition, &subcompositions );
+
+    errors += subcompositions.errors;
+
+    ae_delete_movie_composition( movieComposition );
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_name_index_instance( const ae_char_t * _testsPath, ae_movie_strncmp_t _strncmp, ae_bool_t _caseless, ae_uint32_t * _compositionTotal )
+{
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , _strncmp
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_uint32_t errors = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , _testsPath
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return 1;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return 1;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_name_index_composition( movieData, movieCompositionData, _caseless );
+
+            ++(*_compositionTotal);
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    errors += __test_name_index_instance( argv[1], (ae_movie_strncmp_t)AE_FUNCTION_NULL, AE_FALSE, &composition_total );
+    errors += __test_name_index_instance( argv[1], &__counting_strncmp, AE_TRUE, &composition_total );
+
+    printf( "name index: %u compositions, %u errors\n", composition_total, errors );
+
+    if( errors != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
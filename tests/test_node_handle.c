@@ -0,0 +1,428 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+#define TEST_NODE_HANDLE_MAX_NODES 4096
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_node_handle_compare_count;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_int32_t __counting_strncmp( ae_userdata_t _userdata, const ae_char_t * _src, const ae_char_t * _dst, ae_size_t _count )
+{
+    AE_UNUSED( _userdata );
+
+    ++test_node_handle_compare_count;
+
+    return strncmp( _src, _dst, _count );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_node_handle_nodes_t
+{
+    ae_uint32_t count;
+    const aeMovieLayerData * layers[TEST_NODE_HANDLE_MAX_NODES];
+} test_node_handle_nodes_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    test_node_handle_nodes_t * nodes = (test_node_handle_nodes_t *)_ud;
+
+    if( _callbackData->index >= TEST_NODE_HANDLE_MAX_NODES )
+    {
+        return AE_FALSE;
+    }
+
+    nodes->layers[_callbackData->index] = _callbackData->layer_data;
+
+    if( nodes->count <= _callbackData->index )
+    {
+        nodes->count = _callbackData->index + 1U;
+    }
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __has_node_handle_mesh_userdata( const aeMovieComposition * _composition, ae_userdata_t _userdata )
+{
+    ae_uint32_t mesh_iterator = 0;
+
+    aeMovieRenderMesh mesh;
+    while( ae_compute_movie_mesh( _composition, &mesh_iterator, &mesh ) == AE_TRUE )
+    {
+        if( mesh.element_userdata == _userdata )
+        {
+            return AE_TRUE;
+        }
+    }
+
+    return AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_node_handle_top_layer_t
+{
+    const aeMovieCompositionData * composition_data;
+    const aeMovieLayerData * layer;
+    ae_bool_t top;
+} test_node_handle_top_layer_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __find_node_handle_top_layer( const aeMovieCompositionData * _compositionData, const aeMovieLayerData * _layer, ae_userdata_t _ud )
+{
+    test_node_handle_top_layer_t * top_layer = (test_node_handle_top_layer_t *)_ud;
+
+    if( top_layer->layer == _layer && top_layer->composition_data == _compositionData )
+    {
+        top_layer->top = AE_TRUE;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __is_node_handle_top_layer( const aeMovieCompositionData * _compositionData, const aeMovieLayerData * _layer )
+{
+    test_node_handle_top_layer_t top_layer;
+    top_layer.composition_data = _compositionData;
+    top_layer.layer = _layer;
+    top_layer.top = AE_FALSE;
+
+    ae_visit_composition_layer_data( _compositionData, &__find_node_handle_top_layer, (ae_userdata_t)&top_layer );
+
+    return top_layer.top;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_node_handle_moved_count;
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_node_handle_composition( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData )
+{
+    ae_uint32_t errors = 0;
+
+    test_node_handle_nodes_t nodes;
+    nodes.count = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_FALSE, &movieCompositionProviders, &nodes );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_time_t composition_time = ae_get_movie_composition_duration( movieComposition ) * 0.5f;
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( _compositionData );
+
+    ae_set_movie_composition_time( movieComposition, composition_time );
+
+    test_node_handle_nodes_t reference_nodes;
+    reference_nodes.count = 0;
+
+    const aeMovieComposition * referenceComposition = ae_create_movie_composition( _movieData, _compositionData, AE_FALSE, &movieCompositionProviders, &reference_nodes );
+
+    if( referenceComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_set_movie_composition_time( referenceComposition, composition_time + frame_duration * 2.f );
+
+    ae_uint32_t index = 0;
+    for( ; index != nodes.count; ++index )
+    {
+        const aeMovieLayerData * layer = nodes.layers[index];
+
+        const ae_char_t * name = ae_get_movie_layer_data_name( layer );
+        aeMovieLayerTypeEnum type = ae_get_movie_layer_data_type( layer );
+
+        //the handle refers to the first node with this name and type
+        ae_node_handle_t handle;
+        if( ae_find_movie_composition_node_handle( movieComposition, name, type, &handle ) == AE_FALSE )
+        {
+            ++errors;
+
+            continue;
+        }
+
+        const aeMovieLayerData * handle_layer = ae_get_movie_composition_node_handle_layer_data( movieComposition, handle );
+
+        if( strcmp( ae_get_movie_layer_data_name( handle_layer ), name ) != 0 || ae_get_movie_layer_data_type( handle_layer ) != type || handle > index )
+        {
+            ++errors;
+        }
+
+        if( handle != index )
+        {
+            continue;
+        }
+
+        ae_time_t name_in;
+        ae_time_t name_out;
+        ae_get_movie_composition_node_in_out_time( movieComposition, name, type, &name_in, &name_out );
+
+        test_node_handle_compare_count = 0;
+
+        ae_time_t handle_in;
+        ae_time_t handle_out;
+        ae_get_movie_composition_node_handle_in_out_time( movieComposition, handle, &handle_in, &handle_out );
+
+        if( handle_in != name_in || handle_out != name_out )
+        {
+            ++errors;
+        }
+
+        ae_set_movie_composition_node_handle_enable( movieComposition, handle, AE_FALSE );
+
+        ae_bool_t handle_enable = ae_get_movie_composition_node_handle_enable( movieComposition, handle );
+
+        ae_float_t extra_opacity = ae_get_movie_composition_node_handle_extra_opacity( movieComposition, handle );
+
+        ae_set_movie_composition_node_handle_extra_opacity( movieComposition, handle, 0.25f );
+
+        ae_userdata_t userdata = ae_get_movie_composition_node_handle_userdata( movieComposition, handle );
+
+        ae_userdata_t marker = (ae_userdata_t)(ae_size_t)(TEST_NODE_HANDLE_MAX_NODES + index + 1U);
+
+        ae_set_movie_composition_node_handle_userdata( movieComposition, handle, marker );
+
+        //handles never touch a string
+        if( test_node_handle_compare_count != 0 )
+        {
+            ++errors;
+        }
+
+        ae_bool_t name_enable;
+        ae_get_movie_composition_node_enable( movieComposition, name, type, &name_enable );
+
+        ae_float_t name_extra_opacity;
+        ae_get_movie_composition_node_extra_opacity( movieComposition, name, type, &name_extra_opacity );
+
+        if( handle_enable != AE_FALSE || name_enable != AE_FALSE || name_extra_opacity != 0.25f || userdata != (ae_userdata_t)(ae_size_t)(index + 1U) )
+        {
+            ++errors;
+        }
+
+        ae_set_movie_composition_node_handle_enable( movieComposition, handle, AE_TRUE );
+        ae_set_movie_composition_node_handle_extra_opacity( movieComposition, handle, extra_opacity );
+
+        ae_bool_t rendered = __has_node_handle_mesh_userdata( movieComposition, userdata );
+        ae_bool_t rendered_marker = __has_node_handle_mesh_userdata( movieComposition, marker );
+
+        if( rendered != AE_FALSE )
+        {
+            ++errors;
+        }
+
+        ae_set_movie_composition_node_handle_userdata( movieComposition, handle, userdata );
+
+        if( rendered_marker != __has_node_handle_mesh_userdata( movieComposition, userdata ) )
+        {
+            ++errors;
+        }
+
+        //layers flagged incessantly ignore their range and sub composition nodes follow their own animation
+        if( rendered_marker == AE_FALSE || ae_is_movie_layer_data_incessantly( layer ) == AE_TRUE || __is_node_handle_top_layer( _compositionData, layer ) == AE_FALSE )
+        {
+            continue;
+        }
+
+        ++test_node_handle_moved_count;
+
+        //a node moved past the current time is gone after the next update, once restored it matches an untouched composition
+        ae_time_t moved_in = composition_time * 1.5f;
+        ae_time_t moved_out = composition_time * 1.75f;
+
+        ae_set_movie_composition_node_handle_in_out_time( movieComposition, handle, moved_in, moved_out );
+
+        ae_time_t snapped_in;
+        ae_time_t snapped_out;
+        ae_get_movie_composition_node_handle_in_out_time( movieComposition, handle, &snapped_in, &snapped_out );
+
+        ae_set_movie_composition_time( movieComposition, composition_time + frame_duration );
+
+        ae_bool_t rendered_moved = __has_node_handle_mesh_userdata( movieComposition, userdata );
+
+        ae_set_movie_composition_node_handle_in_out_time( movieComposition, handle, handle_in, handle_out );
+
+        ae_time_t restored_in;
+        ae_time_t restored_out;
+        ae_get_movie_composition_node_handle_in_out_time( movieComposition, handle, &restored_in, &restored_out );
+
+        ae_set_movie_composition_time( movieComposition, composition_time + frame_duration * 2.f );
+
+        ae_bool_t rendered_restored = __has_node_handle_mesh_userdata( movieComposition, userdata );
+        ae_bool_t rendered_reference = __has_node_handle_mesh_userdata( referenceComposition, userdata );
+
+        ae_set_movie_composition_time( movieComposition, composition_time );
+
+        if( snapped_in < moved_in - frame_duration || snapped_in > moved_in + frame_duration || snapped_out < snapped_in
+            || restored_in != handle_in || restored_out != handle_out
+            || rendered_moved != AE_FALSE || rendered_restored != rendered_reference )
+        {
+            ++errors;
+        }
+    }
+
+    ae_node_handle_t missing_handle;
+    if( ae_find_movie_composition_node_handle( movieComposition, "__test_node_handle_missing__", AE_MOVIE_LAYER_TYPE_NONE, &missing_handle ) == AE_TRUE || missing_handle != AE_MOVIE_NODE_HANDLE_INVALID )
+    {
+        ++errors;
+    }
+
+    //an invalid handle is refused in release builds too
+    ae_set_movie_composition_node_handle_enable( movieComposition, missing_handle, AE_FALSE );
+    ae_set_movie_composition_node_handle_extra_opacity( movieComposition, missing_handle, 0.5f );
+    ae_set_movie_composition_node_handle_userdata( movieComposition, missing_handle, AE_USERDATA_NULL );
+
+    ae_time_t missing_in = -1.f;
+    ae_time_t missing_out = -1.f;
+    ae_get_movie_composition_node_handle_in_out_time( movieComposition, missing_handle, &missing_in, &missing_out );
+
+    if( ae_get_movie_composition_node_handle_layer_data( movieComposition, missing_handle ) != AE_NULLPTR
+        || ae_get_movie_composition_node_handle_enable( movieComposition, missing_handle ) != AE_FALSE
+        || ae_get_movie_composition_node_handle_extra_opacity( movieComposition, missing_handle ) != 0.f
+        || ae_get_movie_composition_node_handle_userdata( movieComposition, missing_handle ) != AE_USERDATA_NULL
+        || missing_in != -1.f || missing_out != -1.f )
+    {
+        ++errors;
+    }
+
+    ae_delete_movie_composition( referenceComposition );
+    ae_delete_movie_composition( movieComposition );
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , &__counting_strncmp
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_node_handle_composition( movieData, movieCompositionData );
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "node handle: %u compositions, %u moved nodes, %u errors\n", composition_total, test_node_handle_moved_count, errors );
+
+    if( errors != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
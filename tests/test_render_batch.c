@@ -0,0 +1,476 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+static const ae_uint32_t test_render_batch_jumps = 50;
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+static const aeMovieResource * __get_draw_texture( const aeMovieRenderDraw * _draw )
+{
+    const aeMovieResource * resource = _draw->resource;
+
+    if( resource == AE_NULLPTR || resource->type == AE_MOVIE_RESOURCE_SOLID )
+    {
+        return AE_NULLPTR;
+    }
+
+    if( resource->type == AE_MOVIE_RESOURCE_IMAGE )
+    {
+        const aeMovieResourceImage * resource_image = (const aeMovieResourceImage *)resource;
+
+        if( resource_image->atlas_image != AE_NULLPTR )
+        {
+            return (const aeMovieResource *)resource_image->atlas_image;
+        }
+    }
+
+    return resource;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __is_draw_compatible( const aeMovieRenderDraw * _a, const aeMovieRenderDraw * _b )
+{
+    return __get_draw_texture( _a ) == __get_draw_texture( _b )
+        && _a->blend_mode == _b->blend_mode
+        && _a->camera_userdata == _b->camera_userdata
+        && _a->shader_userdata == _b->shader_userdata
+        && _a->track_matte_userdata == _b->track_matte_userdata
+        && _a->viewport == _b->viewport
+        && _a->vertex_base == _b->vertex_base ? AE_TRUE : AE_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __check_batches( const aeMovieRenderMeshes * _meshes, const aeMovieRenderBatches * _batches )
+{
+    ae_uint32_t errors = 0;
+
+    ae_uint32_t draw_index = 0;
+    ae_uint32_t geometry_draws = 0;
+    ae_uint32_t geometry_batches = 0;
+
+    const aeMovieRenderBatch * batch_previous = AE_NULLPTR;
+
+    ae_uint32_t batch_index = 0;
+    for( ; batch_index != _batches->batch_count; ++batch_index )
+    {
+        const aeMovieRenderBatch * batch = _batches->batches + batch_index;
+
+        if( batch->draw_offset != draw_index || batch->draw_count == 0 || draw_index + batch->draw_count > _meshes->draw_count )
+        {
+            return errors + 1;
+        }
+
+        const aeMovieRenderDraw * first = _meshes->draws + batch->draw_offset;
+
+        if( batch->texture != __get_draw_texture( first )
+            || batch->vertex_base != first->vertex_base
+            || batch->vertex_offset != first->vertex_offset
+            || batch->index_offset != first->index_offset )
+        {
+            ++errors;
+        }
+
+        ae_uint32_t vertex_count = 0;
+        ae_uint32_t index_count = 0;
+
+        ae_uint32_t index = 0;
+        for( ; index != batch->draw_count; ++index )
+        {
+            const aeMovieRenderDraw * draw = first + index;
+
+            if( draw->vertex_offset != batch->vertex_offset + vertex_count || draw->index_offset != batch->index_offset + index_count )
+            {
+                ++errors;
+            }
+
+            if( index != 0 && (draw->index_count == 0 || __is_draw_compatible( first, draw ) == AE_FALSE) )
+            {
+                ++errors;
+            }
+
+            vertex_count += draw->vertex_count;
+            index_count += draw->index_count;
+
+            if( draw->index_count != 0 )
+            {
+                ++geometry_draws;
+            }
+        }
+
+        if( batch->vertex_count != vertex_count || batch->index_count != index_count )
+        {
+            ++errors;
+        }
+
+        if( index_count != 0 )
+        {
+            ++geometry_batches;
+
+            //nothing left to merge: every geometry batch starts where its predecessor could not continue
+            if( batch_previous != AE_NULLPTR && __is_draw_compatible( _meshes->draws + batch_previous->draw_offset, first ) == AE_TRUE )
+            {
+                ++errors;
+            }
+
+            batch_previous = batch;
+        }
+        else
+        {
+            if( batch->draw_count != 1 )
+            {
+                ++errors;
+            }
+
+            batch_previous = AE_NULLPTR;
+        }
+
+        draw_index += batch->draw_count;
+    }
+
+    if( draw_index != _meshes->draw_count
+        || _batches->draw_call_count != geometry_batches
+        || _batches->draw_call_count + _batches->draw_call_saved != geometry_draws )
+    {
+        ++errors;
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __make_draw( aeMovieRenderMeshes * _meshes, const aeMovieResource * _resource, ae_blend_mode_t _blend, ae_uint32_t _vertexBase, ae_uint32_t _vertexCount )
+{
+    aeMovieRenderDraw * draw = _meshes->draws + _meshes->draw_count++;
+
+    memset( draw, 0, sizeof( aeMovieRenderDraw ) );
+
+    draw->layer_type = AE_MOVIE_LAYER_TYPE_IMAGE;
+    draw->blend_mode = _blend;
+    draw->resource = _resource;
+    draw->vertex_base = _vertexBase;
+    draw->vertex_offset = _meshes->vertex_count;
+    draw->vertex_count = _vertexCount;
+    draw->index_offset = _meshes->index_count;
+    draw->index_count = _vertexCount == 0 ? 0 : 6;
+
+    _meshes->vertex_count += draw->vertex_count;
+    _meshes->index_count += draw->index_count;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_render_batch_synthetic( const aeMovieInstance * _instance )
+{
+    aeMovieResourceImage atlas;
+    memset( &atlas, 0, sizeof( atlas ) );
+    atlas.type = AE_MOVIE_RESOURCE_IMAGE;
+
+    aeMovieResourceImage images[3];
+    memset( images, 0, sizeof( images ) );
+
+    ae_uint32_t index = 0;
+    for( ; index != 3; ++index )
+    {
+        images[index].type = AE_MOVIE_RESOURCE_IMAGE;
+        images[index].atlas_image = index == 2 ? AE_NULLPTR : &atlas;
+    }
+
+    aeMovieResourceSolid solids[2];
+    memset( solids, 0, sizeof( solids ) );
+    solids[0].type = AE_MOVIE_RESOURCE_SOLID;
+    solids[1].type = AE_MOVIE_RESOURCE_SOLID;
+
+    aeMovieRenderDraw draws[16];
+
+    aeMovieRenderMeshes meshes;
+    memset( &meshes, 0, sizeof( meshes ) );
+    meshes.draws = draws;
+
+    //batch 0: two images of one atlas
+    __make_draw( &meshes, (const aeMovieResource *)(images + 0), AE_MOVIE_BLEND_NORMAL, 0, 4 );
+    __make_draw( &meshes, (const aeMovieResource *)(images + 1), AE_MOVIE_BLEND_NORMAL, 0, 4 );
+    //batch 1: blend mode change
+    __make_draw( &meshes, (const aeMovieResource *)(images + 1), AE_MOVIE_BLEND_ADD, 0, 4 );
+    //batch 2: slot, stays alone and splits the run
+    __make_draw( &meshes, AE_NULLPTR, AE_MOVIE_BLEND_ADD, 0, 0 );
+    //batch 3: same state as batch 1 but after the slot
+    __make_draw( &meshes, (const aeMovieResource *)(images + 0), AE_MOVIE_BLEND_ADD, 0, 4 );
+    //batch 4: image outside the atlas
+    __make_draw( &meshes, (const aeMovieResource *)(images + 2), AE_MOVIE_BLEND_ADD, 0, 4 );
+    //batch 5: untextured solids merge
+    __make_draw( &meshes, (const aeMovieResource *)(solids + 0), AE_MOVIE_BLEND_ADD, 0, 4 );
+    __make_draw( &meshes, (const aeMovieResource *)(solids + 1), AE_MOVIE_BLEND_ADD, 0, 4 );
+    //batch 6: new vertex base
+    __make_draw( &meshes, (const aeMovieResource *)(solids + 1), AE_MOVIE_BLEND_ADD, 32, 4 );
+
+    ae_uint32_t expected_draws[] = {2, 1, 1, 1, 1, 2, 1};
+    ae_uint32_t expected_batch_count = sizeof( expected_draws ) / sizeof( expected_draws[0] );
+
+    aeMovieRenderBatches batches;
+    ae_initialize_movie_render_batches( _instance, &batches );
+
+    ae_uint32_t errors = 0;
+
+    if( ae_batch_movie_render_meshes( &meshes, &batches ) == AE_FALSE )
+    {
+        return 1;
+    }
+
+    errors += __check_batches( &meshes, &batches );
+
+    if( batches.batch_count != expected_batch_count || batches.draw_call_count != 6 || batches.draw_call_saved != 2 )
+    {
+        ++errors;
+    }
+    else
+    {
+        for( index = 0; index != expected_batch_count; ++index )
+        {
+            if( batches.batches[index].draw_count != expected_draws[index] )
+            {
+                ++errors;
+            }
+        }
+    }
+
+    ae_finalize_movie_render_batches( &batches );
+
+    if( errors != 0 )
+    {
+        printf( "render batch: synthetic draws batched wrong\n" );
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_render_batch_stats_t
+{
+    ae_uint32_t frames;
+    ae_uint32_t draws;
+    ae_uint32_t draw_calls;
+    ae_uint32_t saved;
+} test_render_batch_stats_t;
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __batch_composition( const aeMovieComposition * _composition, aeMovieRenderMeshes * _meshes, aeMovieRenderBatches * _batches, test_render_batch_stats_t * _stats )
+{
+    if( ae_compute_movie_meshes( _composition, _meshes ) == AE_FALSE )
+    {
+        return 1;
+    }
+
+    if( ae_batch_movie_render_meshes( _meshes, _batches ) == AE_FALSE )
+    {
+        return 1;
+    }
+
+    _stats->frames += 1;
+    _stats->draws += _batches->draw_call_count + _batches->draw_call_saved;
+    _stats->draw_calls += _batches->draw_call_count;
+    _stats->saved += _batches->draw_call_saved;
+
+    return __check_batches( _meshes, _batches );
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_render_batch( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, aeMovieRenderMeshes * _meshes, aeMovieRenderBatches * _batches )
+{
+    ae_uint32_t errors = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    test_render_batch_stats_t stats;
+    stats.frames = 0;
+    stats.draws = 0;
+    stats.draw_calls = 0;
+    stats.saved = 0;
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t step = 0;
+    for( ; step != 4000 && ae_is_play_movie_composition( movieComposition ) == AE_TRUE; ++step )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+
+        errors += __batch_composition( movieComposition, _meshes, _batches, &stats );
+    }
+
+    ae_time_t duration = ae_get_movie_composition_duration( movieComposition );
+
+    ae_uint32_t seed = 1;
+
+    ae_uint32_t jump = 0;
+    for( ; jump != test_render_batch_jumps; ++jump )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        ae_time_t time = duration * (ae_float_t)((seed >> 8) & 0xffff) / 65536.f;
+
+        ae_set_movie_composition_time( movieComposition, time );
+
+        errors += __batch_composition( movieComposition, _meshes, _batches, &stats );
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    if( errors != 0 )
+    {
+        printf( "render batch: '%s' %u frames batched wrong\n", ae_get_movie_composition_data_name( _compositionData ), errors );
+    }
+
+    if( stats.frames != 0 )
+    {
+        printf( "render batch: '%s' %.1f draws/frame, %.1f draw calls/frame, %.1f saved/frame\n"
+            , ae_get_movie_composition_data_name( _compositionData )
+            , (double)stats.draws / (double)stats.frames
+            , (double)stats.draw_calls / (double)stats.frames
+            , (double)stats.saved / (double)stats.frames
+        );
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t errors = __test_render_batch_synthetic( movieInstance );
+    ae_uint32_t composition_total = 0;
+
+    aeMovieRenderMeshes meshes;
+    ae_initialize_movie_render_meshes( movieInstance, &meshes );
+
+    aeMovieRenderBatches batches;
+    ae_initialize_movie_render_batches( movieInstance, &batches );
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_render_batch( movieData, movieCompositionData, &meshes, &batches );
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_finalize_movie_render_batches( &batches );
+    ae_finalize_movie_render_meshes( &meshes );
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "render batch: %u compositions, %u errors\n", composition_total, errors );
+
+    if( errors != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,414 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+static const ae_uint32_t test_render_geometry_revision_jumps = 50;
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_geometry_cache_t
+{
+    ae_bool_t valid;
+    ae_uint32_t revision;
+    ae_uint32_t vertex_count;
+
+    ae_vector3_t * positions;
+    ae_vector2_t * uvs;
+} test_geometry_cache_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_geometry_caches_t
+{
+    test_geometry_cache_t * caches;
+    ae_uint32_t count;
+} test_geometry_caches_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_geometry_revision_t
+{
+    test_geometry_caches_t mesh_caches;
+    test_geometry_caches_t track_matte_caches;
+
+    ae_vector3_t positions[AE_MOVIE_MAX_VERTICES];
+    ae_vector2_t uvs[AE_MOVIE_MAX_VERTICES];
+
+    ae_uint32_t meshes;
+    ae_uint32_t reused;
+    ae_uint32_t refreshed;
+    ae_uint32_t spurious;
+    ae_uint32_t errors;
+
+    ae_uint32_t track_mattes;
+    ae_uint32_t track_matte_refreshed;
+} test_geometry_revision_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __render_mesh_sink( const aeMovieRenderMeshEx * _render, ae_vector3_t ** _position, ae_vector2_t ** _uv, ae_userdata_t _ud )
+{
+    test_geometry_revision_t * test = (test_geometry_revision_t *)_ud;
+
+    if( _render->vertexCount > AE_MOVIE_MAX_VERTICES )
+    {
+        return AE_FALSE;
+    }
+
+    *_position = test->positions;
+    *_uv = test->uvs;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static test_geometry_cache_t * __get_geometry_cache( test_geometry_caches_t * _caches, ae_uint32_t _iterator )
+{
+    if( _iterator >= _caches->count )
+    {
+        ae_uint32_t cache_count = _iterator * 2 + 16;
+
+        _caches->caches = (test_geometry_cache_t *)realloc( _caches->caches, sizeof( test_geometry_cache_t ) * cache_count );
+
+        memset( _caches->caches + _caches->count, 0, sizeof( test_geometry_cache_t ) * (cache_count - _caches->count) );
+
+        _caches->count = cache_count;
+    }
+
+    return _caches->caches + _iterator;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __clear_geometry_caches( test_geometry_caches_t * _caches )
+{
+    ae_uint32_t index = 0;
+    for( ; index != _caches->count; ++index )
+    {
+        test_geometry_cache_t * cache = _caches->caches + index;
+
+        free( cache->positions );
+        free( cache->uvs );
+    }
+
+    free( _caches->caches );
+
+    _caches->caches = NULL;
+    _caches->count = 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __check_geometry_revision( test_geometry_revision_t * _test, test_geometry_cache_t * _cache, ae_uint32_t _revision, ae_uint32_t _vertexCount, const ae_vector3_t * _position, const ae_vector2_t * _uv )
+{
+    ae_size_t positions_size = sizeof( ae_vector3_t ) * _vertexCount;
+    ae_size_t uvs_size = sizeof( ae_vector2_t ) * _vertexCount;
+
+    if( _cache->valid == AE_TRUE && _cache->revision == _revision )
+    {
+        //the renderer would have skipped these vertices, they must be what it kept
+        if( _cache->vertex_count != _vertexCount
+            || memcmp( _cache->positions, _position, positions_size ) != 0
+            || memcmp( _cache->uvs, _uv, uvs_size ) != 0 )
+        {
+            ++_test->errors;
+        }
+
+        return AE_FALSE;
+    }
+
+    if( _cache->valid == AE_TRUE
+        && _cache->vertex_count == _vertexCount
+        && memcmp( _cache->positions, _position, positions_size ) == 0
+        && memcmp( _cache->uvs, _uv, uvs_size ) == 0 )
+    {
+        ++_test->spurious;
+    }
+
+    _cache->positions = (ae_vector3_t *)realloc( _cache->positions, positions_size );
+    _cache->uvs = (ae_vector2_t *)realloc( _cache->uvs, uvs_size );
+
+    memcpy( _cache->positions, _position, positions_size );
+    memcpy( _cache->uvs, _uv, uvs_size );
+
+    _cache->valid = AE_TRUE;
+    _cache->revision = _revision;
+    _cache->vertex_count = _vertexCount;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __check_geometry_revisions( const aeMovieComposition * _composition, test_geometry_revision_t * _test )
+{
+    ae_uint32_t iterator = 0;
+
+    aeMovieRenderMeshEx render;
+    while( ae_compute_movie_mesh_ex( _composition, &iterator, &render, &__render_mesh_sink, _test ) == AE_TRUE )
+    {
+        if( render.vertexCount == 0 || render.position == AE_NULLPTR )
+        {
+            continue;
+        }
+
+        ++_test->meshes;
+
+        test_geometry_cache_t * cache = __get_geometry_cache( &_test->mesh_caches, iterator );
+
+        if( __check_geometry_revision( _test, cache, render.geometry_revision, render.vertexCount, render.position, render.uv ) == AE_TRUE )
+        {
+            ++_test->refreshed;
+        }
+        else
+        {
+            ++_test->reused;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __track_matte_provider( const aeMovieTrackMatteProviderCallbackData * _callbackData, ae_userdataptr_t _tmd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    *_tmd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __track_matte_update( const aeMovieTrackMatteUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_geometry_revision_t * test = (test_geometry_revision_t *)_ud;
+
+    const aeMovieRenderMesh * mesh = _callbackData->mesh;
+
+    if( mesh->vertexCount == 0 )
+    {
+        return;
+    }
+
+    ++test->track_mattes;
+
+    test_geometry_cache_t * cache = __get_geometry_cache( &test->track_matte_caches, _callbackData->index );
+
+    //same node as the mesh queries, but the track matte pass may draw a sprite where they draw a mesh
+    if( __check_geometry_revision( test, cache, mesh->geometry_revision, mesh->vertexCount, mesh->position, mesh->uv ) == AE_TRUE )
+    {
+        ++test->track_matte_refreshed;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_geometry_revision( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, ae_bool_t _interpolate, test_geometry_revision_t * _test )
+{
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.track_matte_provider = &__track_matte_provider;
+    movieCompositionProviders.track_matte_update = &__track_matte_update;
+
+    _test->meshes = 0;
+    _test->reused = 0;
+    _test->refreshed = 0;
+    _test->spurious = 0;
+    _test->errors = 0;
+    _test->track_mattes = 0;
+    _test->track_matte_refreshed = 0;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, _interpolate, &movieCompositionProviders, _test );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t step = 0;
+    for( ; step != 4000 && ae_is_play_movie_composition( movieComposition ) == AE_TRUE; ++step )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+
+        __check_geometry_revisions( movieComposition, _test );
+    }
+
+    ae_time_t duration = ae_get_movie_composition_duration( movieComposition );
+
+    ae_uint32_t seed = 1;
+
+    ae_uint32_t jump = 0;
+    for( ; jump != test_render_geometry_revision_jumps; ++jump )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        ae_time_t time = duration * (ae_float_t)((seed >> 8) & 0xffff) / 65536.f;
+
+        ae_set_movie_composition_time( movieComposition, time );
+
+        __check_geometry_revisions( movieComposition, _test );
+
+        //same time again, nothing may move on either path
+        ae_uint32_t refreshed = _test->refreshed;
+        ae_uint32_t track_matte_refreshed = _test->track_matte_refreshed;
+
+        ae_set_movie_composition_time( movieComposition, time );
+
+        __check_geometry_revisions( movieComposition, _test );
+
+        if( _test->refreshed != refreshed || _test->track_matte_refreshed != track_matte_refreshed )
+        {
+            ++_test->errors;
+        }
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    __clear_geometry_caches( &_test->mesh_caches );
+    __clear_geometry_caches( &_test->track_matte_caches );
+
+    if( _test->errors != 0 )
+    {
+        printf( "geometry revision: '%s' %u meshes kept a revision with new vertices\n", ae_get_movie_composition_data_name( _compositionData ), _test->errors );
+    }
+
+    if( _test->meshes != 0 )
+    {
+        printf( "geometry revision: '%s' i%u %u meshes, %.1f%% reusable, %u track mattes, %u spurious refreshes\n"
+            , ae_get_movie_composition_data_name( _compositionData )
+            , _interpolate
+            , _test->meshes
+            , (double)_test->reused * 100.0 / (double)_test->meshes
+            , _test->track_mattes
+            , _test->spurious
+        );
+    }
+
+    return _test->errors;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    test_geometry_revision_t * test = (test_geometry_revision_t *)malloc( sizeof( test_geometry_revision_t ) );
+    test->mesh_caches.caches = NULL;
+    test->mesh_caches.count = 0;
+    test->track_matte_caches.caches = NULL;
+    test->track_matte_caches.count = 0;
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_geometry_revision( movieData, movieCompositionData, AE_FALSE, test );
+            errors += __test_geometry_revision( movieData, movieCompositionData, AE_TRUE, test );
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    free( test );
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "geometry revision: %u compositions, %u errors\n", composition_total, errors );
+
+    if( errors != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
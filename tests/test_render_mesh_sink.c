@@ -0,0 +1,347 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+static const ae_uint32_t test_render_mesh_sink_jumps = 50;
+static const ae_uint32_t test_render_mesh_sink_decline = 5;
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_render_mesh_sink_t
+{
+    ae_vector3_t * positions;
+    ae_vector2_t * uvs;
+
+    ae_uint32_t capacity;
+    ae_uint32_t size;
+    ae_uint32_t max_size;
+
+    ae_uint32_t requests;
+    ae_uint32_t declines;
+} test_render_mesh_sink_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __render_mesh_sink( const aeMovieRenderMeshEx * _render, ae_vector3_t ** _position, ae_vector2_t ** _uv, ae_userdata_t _ud )
+{
+    test_render_mesh_sink_t * sink = (test_render_mesh_sink_t *)_ud;
+
+    ++sink->requests;
+
+    if( sink->requests % test_render_mesh_sink_decline == 0 )
+    {
+        ++sink->declines;
+
+        return AE_FALSE;
+    }
+
+    //one buffer per frame, filled only with the meshes actually drawn
+    if( sink->size + _render->vertexCount > sink->capacity )
+    {
+        return AE_FALSE;
+    }
+
+    *_position = sink->positions + sink->size;
+    *_uv = sink->uvs + sink->size;
+
+    sink->size += _render->vertexCount;
+
+    if( sink->max_size < sink->size )
+    {
+        sink->max_size = sink->size;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __compare_render_mesh( const aeMovieRenderMesh * _mesh, const aeMovieRenderMeshEx * _ex, ae_bool_t _vertices )
+{
+    if( _mesh->layer_type != _ex->layer_type
+        || _mesh->blend_mode != _ex->blend_mode
+        || _mesh->resource != _ex->resource
+        || _mesh->vertexCount != _ex->vertexCount
+        || _mesh->indexCount != _ex->indexCount
+        || _mesh->uv_cache_userdata != _ex->uv_cache_userdata
+        || _mesh->color.r != _ex->color.r
+        || _mesh->color.g != _ex->color.g
+        || _mesh->color.b != _ex->color.b
+        || _mesh->opacity != _ex->opacity
+        || _mesh->camera_userdata != _ex->camera_userdata
+        || _mesh->track_matte_mode != _ex->track_matte_mode
+        || _mesh->track_matte_userdata != _ex->track_matte_userdata
+        || _mesh->viewport != _ex->viewport
+        || _mesh->shader_userdata != _ex->shader_userdata
+        || _mesh->element_userdata != _ex->element_userdata )
+    {
+        return 1;
+    }
+
+    if( _mesh->vertexCount == 0 )
+    {
+        return 0;
+    }
+
+    if( memcmp( _mesh->indices, _ex->indices, sizeof( ae_uint16_t ) * _mesh->indexCount ) != 0 )
+    {
+        return 1;
+    }
+
+    if( _vertices == AE_FALSE )
+    {
+        return (_ex->position == AE_NULLPTR && _ex->uv == AE_NULLPTR) ? 0 : 1;
+    }
+
+    if( _ex->position == AE_NULLPTR || _ex->uv == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    if( memcmp( _mesh->position, _ex->position, sizeof( ae_vector3_t ) * _mesh->vertexCount ) != 0
+        || memcmp( _mesh->uv, _ex->uv, sizeof( ae_vector2_t ) * _mesh->vertexCount ) != 0 )
+    {
+        return 1;
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __compare_composition_meshes( const aeMovieComposition * _composition, aeMovieRenderMesh * _mesh, test_render_mesh_sink_t * _sink )
+{
+    ae_uint32_t errors = 0;
+
+    _sink->size = 0;
+
+    ae_uint32_t mesh_iterator = 0;
+    ae_uint32_t ex_iterator = 0;
+    ae_uint32_t state_iterator = 0;
+
+    for( ;; )
+    {
+        ae_bool_t mesh_result = ae_compute_movie_mesh( _composition, &mesh_iterator, _mesh );
+
+        ae_uint32_t declines = _sink->declines;
+
+        aeMovieRenderMeshEx ex;
+        ae_bool_t ex_result = ae_compute_movie_mesh_ex( _composition, &ex_iterator, &ex, &__render_mesh_sink, _sink );
+
+        aeMovieRenderMeshEx state;
+        ae_bool_t state_result = ae_compute_movie_mesh_ex( _composition, &state_iterator, &state, (ae_movie_render_mesh_sink_t)AE_FUNCTION_NULL, AE_NULLPTR );
+
+        if( mesh_result != ex_result || mesh_result != state_result || mesh_iterator != ex_iterator || mesh_iterator != state_iterator )
+        {
+            return errors + 1;
+        }
+
+        if( mesh_result == AE_FALSE )
+        {
+            break;
+        }
+
+        errors += __compare_render_mesh( _mesh, &ex, declines == _sink->declines ? AE_TRUE : AE_FALSE );
+        errors += __compare_render_mesh( _mesh, &state, AE_FALSE );
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_render_mesh_sink( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, aeMovieRenderMesh * _mesh, test_render_mesh_sink_t * _sink )
+{
+    ae_uint32_t errors = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t step = 0;
+    for( ; step != 4000 && ae_is_play_movie_composition( movieComposition ) == AE_TRUE; ++step )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+
+        errors += __compare_composition_meshes( movieComposition, _mesh, _sink );
+    }
+
+    ae_time_t duration = ae_get_movie_composition_duration( movieComposition );
+
+    ae_uint32_t seed = 1;
+
+    ae_uint32_t jump = 0;
+    for( ; jump != test_render_mesh_sink_jumps; ++jump )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        ae_time_t time = duration * (ae_float_t)((seed >> 8) & 0xffff) / 65536.f;
+
+        ae_set_movie_composition_time( movieComposition, time );
+
+        errors += __compare_composition_meshes( movieComposition, _mesh, _sink );
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    if( errors != 0 )
+    {
+        printf( "render mesh sink: '%s' %u meshes differ\n", ae_get_movie_composition_data_name( _compositionData ), errors );
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieRenderMesh * mesh = (aeMovieRenderMesh *)malloc( sizeof( aeMovieRenderMesh ) );
+
+    test_render_mesh_sink_t sink;
+    sink.capacity = 64 * 1024;
+    sink.positions = (ae_vector3_t *)malloc( sizeof( ae_vector3_t ) * sink.capacity );
+    sink.uvs = (ae_vector2_t *)malloc( sizeof( ae_vector2_t ) * sink.capacity );
+    sink.size = 0;
+    sink.max_size = 0;
+    sink.requests = 0;
+    sink.declines = 0;
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_render_mesh_sink( movieData, movieCompositionData, mesh, &sink );
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "render mesh sink: %u compositions, %u meshes (%u declined), largest frame %u bytes of vertices vs %u bytes per aeMovieRenderMesh, %u errors\n"
+        , composition_total
+        , sink.requests
+        , sink.declines
+        , sink.max_size * (ae_uint32_t)(sizeof( ae_vector3_t ) + sizeof( ae_vector2_t ))
+        , (ae_uint32_t)sizeof( aeMovieRenderMesh )
+        , errors
+    );
+
+    free( mesh );
+    free( sink.positions );
+    free( sink.uvs );
+
+    if( errors != 0 || sink.requests == 0 || sink.declines == 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
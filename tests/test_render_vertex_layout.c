@@ -0,0 +1,455 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include <time.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+static const ae_uint32_t test_render_vertex_layout_jumps = 50;
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_render_vertex_t
+{
+    ae_float_t position[3];
+    ae_uint32_t color;
+    ae_float_t uv[2];
+    ae_uint32_t guard;
+} test_render_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define TEST_RENDER_VERTEX_GUARD 0xDEADBEEFU
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_render_vertex_buffer_t
+{
+    test_render_vertex_t * vertices;
+
+    ae_uint32_t capacity;
+    ae_uint32_t size;
+} test_render_vertex_buffer_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __render_vertex_buffer_sink( const aeMovieRenderMeshEx * _render, ae_voidptr_t * _vertices, ae_userdata_t _ud )
+{
+    test_render_vertex_buffer_t * buffer = (test_render_vertex_buffer_t *)_ud;
+
+    if( buffer->size + _render->vertexCount > buffer->capacity )
+    {
+        return AE_FALSE;
+    }
+
+    test_render_vertex_t * vertices = buffer->vertices + buffer->size;
+
+    ae_uint32_t index = 0;
+    for( ; index != _render->vertexCount; ++index )
+    {
+        vertices[index].guard = TEST_RENDER_VERTEX_GUARD;
+    }
+
+    *_vertices = vertices;
+
+    buffer->size += _render->vertexCount;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __pack_color_channel( ae_float_t _value )
+{
+    if( _value < 0.f )
+    {
+        _value = 0.f;
+    }
+    else if( _value > 1.f )
+    {
+        _value = 1.f;
+    }
+
+    return (ae_uint32_t)(_value * 255.f + 0.5f);
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __pack_color( const aeMovieRenderMesh * _mesh, const aeMovieRenderVertexLayout * _layout )
+{
+    ae_float_t a = _mesh->opacity < 1.f ? _mesh->opacity : 1.f;
+    ae_float_t m = _layout->color_premultiplied == AE_TRUE ? a : 1.f;
+
+    ae_uint32_t a8 = __pack_color_channel( a );
+    ae_uint32_t r8 = __pack_color_channel( (_mesh->color.r < 1.f ? _mesh->color.r : 1.f) * m );
+    ae_uint32_t g8 = __pack_color_channel( (_mesh->color.g < 1.f ? _mesh->color.g : 1.f) * m );
+    ae_uint32_t b8 = __pack_color_channel( (_mesh->color.b < 1.f ? _mesh->color.b : 1.f) * m );
+
+    if( _layout->color_format == AE_MOVIE_RENDER_COLOR_ABGR )
+    {
+        return (a8 << 24) | (b8 << 16) | (g8 << 8) | r8;
+    }
+
+    return (a8 << 24) | (r8 << 16) | (g8 << 8) | b8;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __compare_composition_layout( const aeMovieComposition * _composition, aeMovieRenderMesh * _mesh, const aeMovieRenderVertexLayout * _layout, test_render_vertex_buffer_t * _buffer )
+{
+    ae_uint32_t errors = 0;
+
+    _buffer->size = 0;
+
+    ae_uint32_t mesh_iterator = 0;
+    ae_uint32_t layout_iterator = 0;
+
+    for( ;; )
+    {
+        ae_bool_t mesh_result = ae_compute_movie_mesh( _composition, &mesh_iterator, _mesh );
+
+        ae_uint32_t vertex_begin = _buffer->size;
+
+        aeMovieRenderMeshEx ex;
+        ae_bool_t layout_result = ae_compute_movie_mesh_interleaved( _composition, &layout_iterator, &ex, _layout, &__render_vertex_buffer_sink, _buffer );
+
+        if( mesh_result != layout_result || mesh_iterator != layout_iterator )
+        {
+            return errors + 1;
+        }
+
+        if( mesh_result == AE_FALSE )
+        {
+            break;
+        }
+
+        if( _mesh->vertexCount != ex.vertexCount || ex.position != AE_NULLPTR || ex.uv != AE_NULLPTR )
+        {
+            ++errors;
+
+            continue;
+        }
+
+        if( _mesh->vertexCount == 0 )
+        {
+            continue;
+        }
+
+        if( _buffer->size - vertex_begin != _mesh->vertexCount )
+        {
+            ++errors;
+
+            continue;
+        }
+
+        ae_uint32_t color = __pack_color( _mesh, _layout );
+
+        const test_render_vertex_t * vertices = _buffer->vertices + vertex_begin;
+
+        ae_uint32_t index = 0;
+        for( ; index != _mesh->vertexCount; ++index )
+        {
+            const test_render_vertex_t * v = vertices + index;
+
+            if( memcmp( v->position, _mesh->position[index], sizeof( ae_vector3_t ) ) != 0
+                || memcmp( v->uv, _mesh->uv[index], sizeof( ae_vector2_t ) ) != 0
+                || v->color != color
+                || v->guard != TEST_RENDER_VERTEX_GUARD )
+            {
+                ++errors;
+
+                break;
+            }
+        }
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __test_render_vertex_layout( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, aeMovieRenderMesh * _mesh, const aeMovieRenderVertexLayout * _layouts, test_render_vertex_buffer_t * _buffer )
+{
+    ae_uint32_t errors = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return 1;
+    }
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t step = 0;
+    for( ; step != 4000 && ae_is_play_movie_composition( movieComposition ) == AE_TRUE; ++step )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+
+        errors += __compare_composition_layout( movieComposition, _mesh, _layouts + step % 2, _buffer );
+    }
+
+    ae_time_t duration = ae_get_movie_composition_duration( movieComposition );
+
+    ae_uint32_t seed = 1;
+
+    ae_uint32_t jump = 0;
+    for( ; jump != test_render_vertex_layout_jumps; ++jump )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        ae_time_t time = duration * (ae_float_t)((seed >> 8) & 0xffff) / 65536.f;
+
+        ae_set_movie_composition_time( movieComposition, time );
+
+        errors += __compare_composition_layout( movieComposition, _mesh, _layouts + jump % 2, _buffer );
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    if( errors != 0 )
+    {
+        printf( "render vertex layout: '%s' %u meshes differ\n", ae_get_movie_composition_data_name( _compositionData ), errors );
+    }
+
+    return errors;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __measure_render_vertex_layout( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, aeMovieRenderMesh * _mesh, const aeMovieRenderVertexLayout * _layout, test_render_vertex_buffer_t * _buffer )
+{
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    ae_play_movie_composition( movieComposition, 0.f );
+    ae_set_movie_composition_loop( movieComposition, AE_TRUE );
+
+    ae_uint32_t frame_count = 200;
+
+    clock_t copy_time = 0;
+    clock_t interleaved_time = 0;
+
+    ae_uint32_t checksum = 0;
+
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count; ++frame )
+    {
+        ae_update_movie_composition( movieComposition, 0.0137f );
+
+        //what integrations do today: compute into aeMovieRenderMesh, then interleave by hand
+        clock_t copy_begin = clock();
+
+        _buffer->size = 0;
+
+        ae_uint32_t mesh_iterator = 0;
+        while( ae_compute_movie_mesh( movieComposition, &mesh_iterator, _mesh ) == AE_TRUE )
+        {
+            if( _buffer->size + _mesh->vertexCount > _buffer->capacity )
+            {
+                continue;
+            }
+
+            ae_uint32_t color = __pack_color( _mesh, _layout );
+
+            test_render_vertex_t * vertices = _buffer->vertices + _buffer->size;
+
+            ae_uint32_t index = 0;
+            for( ; index != _mesh->vertexCount; ++index )
+            {
+                test_render_vertex_t * v = vertices + index;
+
+                v->position[0] = _mesh->position[index][0];
+                v->position[1] = _mesh->position[index][1];
+                v->position[2] = _mesh->position[index][2];
+                v->color = color;
+                v->uv[0] = _mesh->uv[index][0];
+                v->uv[1] = _mesh->uv[index][1];
+            }
+
+            _buffer->size += _mesh->vertexCount;
+        }
+
+        clock_t copy_end = clock();
+
+        checksum += _buffer->size;
+
+        clock_t interleaved_begin = clock();
+
+        _buffer->size = 0;
+
+        aeMovieRenderMeshEx ex;
+
+        ae_uint32_t layout_iterator = 0;
+        while( ae_compute_movie_mesh_interleaved( movieComposition, &layout_iterator, &ex, _layout, &__render_vertex_buffer_sink, _buffer ) == AE_TRUE )
+        {
+        }
+
+        clock_t interleaved_end = clock();
+
+        checksum += _buffer->size;
+
+        copy_time += copy_end - copy_begin;
+        interleaved_time += interleaved_end - interleaved_begin;
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    double copy_us = (double)copy_time * 1000000.0 / (double)CLOCKS_PER_SEC / (double)frame_count;
+    double interleaved_us = (double)interleaved_time * 1000000.0 / (double)CLOCKS_PER_SEC / (double)frame_count;
+
+    printf( "render vertex layout: '%s' compute and interleave %.2f us/frame, interleaved %.2f us/frame (%u)\n"
+        , ae_get_movie_composition_data_name( _compositionData )
+        , copy_us
+        , interleaved_us
+        , checksum
+    );
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieRenderVertexLayout layouts[2];
+    layouts[0].stride = sizeof( test_render_vertex_t );
+    layouts[0].position_offset = (ae_uint32_t)offsetof( test_render_vertex_t, position );
+    layouts[0].uv_offset = (ae_uint32_t)offsetof( test_render_vertex_t, uv );
+    layouts[0].color_offset = (ae_uint32_t)offsetof( test_render_vertex_t, color );
+    layouts[0].color_format = AE_MOVIE_RENDER_COLOR_ARGB;
+    layouts[0].color_premultiplied = AE_FALSE;
+
+    layouts[1] = layouts[0];
+    layouts[1].color_format = AE_MOVIE_RENDER_COLOR_ABGR;
+    layouts[1].color_premultiplied = AE_TRUE;
+
+    aeMovieRenderMesh * mesh = (aeMovieRenderMesh *)malloc( sizeof( aeMovieRenderMesh ) );
+
+    test_render_vertex_buffer_t buffer;
+    buffer.capacity = 64 * 1024;
+    buffer.vertices = (test_render_vertex_t *)malloc( sizeof( test_render_vertex_t ) * buffer.capacity );
+    buffer.size = 0;
+
+    ae_uint32_t errors = 0;
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            errors += __test_render_vertex_layout( movieData, movieCompositionData, mesh, layouts, &buffer );
+
+            if( ae_is_movie_composition_data_master( movieCompositionData ) == AE_TRUE )
+            {
+                __measure_render_vertex_layout( movieData, movieCompositionData, mesh, layouts + 1, &buffer );
+            }
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "render vertex layout: %u compositions, %u errors\n", composition_total, errors );
+
+    free( mesh );
+    free( buffer.vertices );
+
+    if( errors != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,377 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const ae_char_t * test_example_file_path = "examples/resources/Unicorn/Unicorn.aem";
+static const ae_char_t * test_example_composition_name = "Unicorn";
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __hash_movie_composition_meshes( const aeMovieComposition * _composition )
+{
+    ae_uint32_t hash = 2166136261U;
+
+    ae_uint32_t iterator = 0;
+    aeMovieRenderMesh movieRenderMesh;
+    while( ae_compute_movie_mesh( _composition, &iterator, &movieRenderMesh ) == AE_TRUE )
+    {
+        const ae_uint8_t * it_byte = (const ae_uint8_t *)movieRenderMesh.position;
+        const ae_uint8_t * it_byte_end = it_byte + sizeof( ae_vector3_t ) * movieRenderMesh.vertexCount;
+        for( ; it_byte != it_byte_end; ++it_byte )
+        {
+            hash = (hash ^ *it_byte) * 16777619U;
+        }
+
+        hash = (hash ^ (ae_uint32_t)(movieRenderMesh.opacity * 255.f)) * 16777619U;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static aeMovieData * __load_movie_data( const aeMovieInstance * _instance, const ae_char_t * _path )
+{
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    FILE * f = fopen( _path, "rb" );
+
+    if( f == NULL )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( _instance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    fclose( f );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return AE_NULLPTR;
+    }
+
+    return movieData;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __play_movie_composition_data( const aeMovieData * _movieData, ae_uint32_t * _hashes, ae_uint32_t _count, double * _us )
+{
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( _movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, movieCompositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_time_t duration = ae_get_movie_composition_data_duration( movieCompositionData );
+
+    clock_t clock_begin = clock();
+
+    ae_uint32_t index = 0;
+    for( ; index != _count; ++index )
+    {
+        ae_set_movie_composition_time( movieComposition, duration * (ae_time_t)index / (ae_time_t)_count );
+
+        _hashes[index] = __hash_movie_composition_meshes( movieComposition );
+    }
+
+    clock_t clock_end = clock();
+
+    *_us = (double)(clock_end - clock_begin) * 1000000.0 / (double)CLOCKS_PER_SEC / (double)_count;
+
+    ae_delete_movie_composition( movieComposition );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __count_movie_composition_matrix_skips( const aeMovieData * _movieData, ae_uint32_t * _skipCount )
+{
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( _movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_uint32_t frame_count = ae_get_movie_composition_data_frame_count( movieCompositionData );
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    //a rebuild is skipped only while every property of a node sits in a constant block
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count; ++frame )
+    {
+        ae_set_movie_composition_time( movieComposition, (ae_time_t)frame * frame_duration );
+
+        __hash_movie_composition_meshes( movieComposition );
+    }
+
+    *_skipCount = ae_get_movie_composition_matrix_skip_count( movieComposition );
+
+    ae_delete_movie_composition( movieComposition );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __bake_movie_data_with_live_composition( aeMovieData * _movieData )
+{
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( _movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, movieCompositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+    const aeMovieCompositionTemplate * movieCompositionTemplate = ae_create_movie_composition_template( _movieData, movieCompositionData, AE_TRUE );
+
+    if( movieComposition == AE_NULLPTR || movieCompositionTemplate == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_time_t duration = ae_get_movie_composition_data_duration( movieCompositionData );
+
+    ae_set_movie_composition_time( movieComposition, duration * 0.5f );
+
+    //node cursors of the live composition must keep walking the timelines they started on
+    ae_size_t used = 0;
+    if( ae_bake_movie_composition_data( _movieData, movieCompositionData, (ae_size_t)~0U, &used ) == AE_TRUE || used != 0 )
+    {
+        printf( "timeline bake: baked under a live composition\n" );
+
+        return AE_FALSE;
+    }
+
+    ae_uint32_t index = 0;
+    for( ; index != 64; ++index )
+    {
+        ae_set_movie_composition_time( movieComposition, duration * (ae_time_t)index / 64.f );
+
+        __hash_movie_composition_meshes( movieComposition );
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    if( ae_bake_movie_composition_data( _movieData, movieCompositionData, (ae_size_t)~0U, &used ) == AE_TRUE || used != 0 )
+    {
+        printf( "timeline bake: baked under a live composition template\n" );
+
+        return AE_FALSE;
+    }
+
+    ae_delete_movie_composition_template( movieCompositionTemplate );
+
+    if( ae_bake_movie_composition_data( _movieData, movieCompositionData, (ae_size_t)~0U, &used ) == AE_FALSE || used == 0 )
+    {
+        printf( "timeline bake: bake refused after every composition was deleted\n" );
+
+        return AE_FALSE;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+    AE_UNUSED( argv );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    char full_example_file_path[256];
+    sprintf( full_example_file_path, "%s/../%s"
+        , argv[1]
+        , test_example_file_path
+    );
+
+    aeMovieData * movieDataCompressed = __load_movie_data( movieInstance, full_example_file_path );
+    aeMovieData * movieDataBaked = __load_movie_data( movieInstance, full_example_file_path );
+    aeMovieData * movieDataPartial = __load_movie_data( movieInstance, full_example_file_path );
+    aeMovieData * movieDataLive = __load_movie_data( movieInstance, full_example_file_path );
+
+    if( movieDataCompressed == AE_NULLPTR || movieDataBaked == AE_NULLPTR || movieDataPartial == AE_NULLPTR || movieDataLive == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __bake_movie_data_with_live_composition( movieDataLive ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    const aeMovieCompositionData * compositionDataBaked = ae_get_movie_composition_data( movieDataBaked, test_example_composition_name );
+    const aeMovieCompositionData * compositionDataPartial = ae_get_movie_composition_data( movieDataPartial, test_example_composition_name );
+
+    if( compositionDataBaked == AE_NULLPTR || compositionDataPartial == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_size_t baked_used = 0;
+    if( ae_bake_movie_composition_data( movieDataBaked, compositionDataBaked, (ae_size_t)~0U, &baked_used ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_size_t partial_budget = baked_used / 2;
+    ae_size_t partial_used = 0;
+    if( ae_bake_movie_composition_data( movieDataPartial, compositionDataPartial, partial_budget, &partial_used ) == AE_TRUE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( partial_used > partial_budget )
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf( "timeline bake: %u bytes baked, partial %u of %u bytes\n", (ae_uint32_t)baked_used, (ae_uint32_t)partial_used, (ae_uint32_t)partial_budget );
+
+    ae_uint32_t sample_count = 1024;
+
+    ae_uint32_t * hashes_compressed = (ae_uint32_t *)malloc( sizeof( ae_uint32_t ) * sample_count );
+    ae_uint32_t * hashes_baked = (ae_uint32_t *)malloc( sizeof( ae_uint32_t ) * sample_count );
+    ae_uint32_t * hashes_partial = (ae_uint32_t *)malloc( sizeof( ae_uint32_t ) * sample_count );
+
+    double us_compressed;
+    double us_baked;
+    double us_partial;
+
+    if( __play_movie_composition_data( movieDataCompressed, hashes_compressed, sample_count, &us_compressed ) == AE_FALSE ||
+        __play_movie_composition_data( movieDataBaked, hashes_baked, sample_count, &us_baked ) == AE_FALSE ||
+        __play_movie_composition_data( movieDataPartial, hashes_partial, sample_count, &us_partial ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( memcmp( hashes_compressed, hashes_baked, sizeof( ae_uint32_t ) * sample_count ) != 0 )
+    {
+        printf( "timeline bake: baked timelines mismatch\n" );
+
+        return EXIT_FAILURE;
+    }
+
+    if( memcmp( hashes_compressed, hashes_partial, sizeof( ae_uint32_t ) * sample_count ) != 0 )
+    {
+        printf( "timeline bake: partially baked timelines mismatch\n" );
+
+        return EXIT_FAILURE;
+    }
+
+    printf( "timeline bake: compressed %.3f us/sample, baked %.3f us/sample\n", us_compressed, us_baked );
+
+    ae_uint32_t skips_compressed;
+    ae_uint32_t skips_baked;
+
+    if( __count_movie_composition_matrix_skips( movieDataCompressed, &skips_compressed ) == AE_FALSE ||
+        __count_movie_composition_matrix_skips( movieDataBaked, &skips_baked ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    //held segments stay constant blocks after the bake
+    if( skips_compressed == 0 || skips_baked != skips_compressed )
+    {
+        printf( "timeline bake: %u rebuilds skipped compressed, %u baked\n", skips_compressed, skips_baked );
+
+        return EXIT_FAILURE;
+    }
+
+    printf( "timeline bake: %u rebuilds skipped on held segments\n", skips_baked );
+
+    free( hashes_compressed );
+    free( hashes_baked );
+    free( hashes_partial );
+
+    ae_delete_movie_data( movieDataCompressed );
+    ae_delete_movie_data( movieDataBaked );
+    ae_delete_movie_data( movieDataPartial );
+    ae_delete_movie_data( movieDataLive );
+
+    ae_delete_movie_instance( movieInstance );
+
+    return EXIT_SUCCESS;
+}
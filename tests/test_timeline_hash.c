@@ -0,0 +1,452 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_hashkey = "3f9a0c7e51b2d84a6e0f3c9b7a5d1e2c8b4f6a09";
+
+#define TEST_TIMELINE_HASH_FRAME_COUNT 91U
+#define TEST_TIMELINE_HASH_STREAM_MAX 4096U
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    if( _data != AE_USERDATA_NULL )
+    {
+        ae_size_t * copied = (ae_size_t *)_data;
+
+        *copied += _size;
+    }
+
+    memcpy( _dst, _src, _size );
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_buffer( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    const ae_uint8_t * buffer = (const ae_uint8_t *)_data;
+
+    memcpy( _buff, buffer + _carriage, _size );
+
+    return _size;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_stream_writer_t
+{
+    ae_uint8_t buffer[TEST_TIMELINE_HASH_STREAM_MAX];
+    ae_size_t size;
+
+    ae_uint32_t hashmask[5];
+} test_stream_writer_t;
+//////////////////////////////////////////////////////////////////////////
+static void __make_hashmask( const ae_char_t * _hashkey, ae_uint32_t * _hashmask )
+{
+    ae_uint32_t index = 0;
+    for( ; index != 5; ++index )
+    {
+        _hashmask[index] = 0;
+    }
+
+    if( _hashkey == AE_HASHKEY_EMPTY )
+    {
+        return;
+    }
+
+    //same nibble order the instance decodes the key with
+    for( index = 0; index != 40; ++index )
+    {
+        ae_char_t hash_char = _hashkey[index];
+
+        ae_uint32_t v = (hash_char > '9') ? (ae_uint32_t)(hash_char - 'a' + 10) : (ae_uint32_t)(hash_char - '0');
+
+        _hashmask[index / 8] += v << ((index % 8) << 2);
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_bytes( test_stream_writer_t * _writer, const void * _data, ae_size_t _size )
+{
+    memcpy( _writer->buffer + _writer->size, _data, _size );
+
+    _writer->size += _size;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_u8( test_stream_writer_t * _writer, ae_uint8_t _value )
+{
+    __write_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_u32( test_stream_writer_t * _writer, ae_uint32_t _value )
+{
+    __write_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_f32( test_stream_writer_t * _writer, ae_float_t _value )
+{
+    __write_bytes( _writer, &_value, sizeof( _value ) );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_string( test_stream_writer_t * _writer, const ae_char_t * _value )
+{
+    ae_size_t size = strlen( _value );
+
+    __write_u8( _writer, (ae_uint8_t)size );
+    __write_bytes( _writer, _value, size );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_timeline( test_stream_writer_t * _writer, ae_uint8_t _iterator, const ae_uint32_t * _words, ae_uint32_t _count )
+{
+    __write_u32( _writer, _count * 4U );
+    __write_u8( _writer, _iterator );
+
+    //word i of a timeline is masked with word (iterator + i) of the key, period of five words
+    ae_uint32_t index = 0;
+    for( ; index != _count; ++index )
+    {
+        __write_u32( _writer, _words[index] ^ _writer->hashmask[(_iterator + index) % 5U] );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __float_word( ae_float_t _value )
+{
+    ae_uint32_t word;
+    memcpy( &word, &_value, sizeof( word ) );
+
+    return word;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __make_linear_blocks( ae_uint32_t * _words, ae_uint32_t _blockFrames, ae_float_t _step )
+{
+    ae_uint32_t count = 0;
+
+    ae_uint32_t frame = 0;
+    for( ; frame != TEST_TIMELINE_HASH_FRAME_COUNT; frame += _blockFrames )
+    {
+        _words[count++] = (1U << 24U) | _blockFrames;
+        _words[count++] = __float_word( 1.f / (ae_float_t)(_blockFrames - 1U) );
+        _words[count++] = __float_word( (ae_float_t)frame * _step );
+        _words[count++] = __float_word( (ae_float_t)(frame + _blockFrames - 1U) * _step );
+    }
+
+    return count;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __write_movie_stream( test_stream_writer_t * _writer, const ae_char_t * _hashkey )
+{
+    _writer->size = 0;
+
+    __make_hashmask( _hashkey, _writer->hashmask );
+
+    __write_bytes( _writer, "AEM1", 4 );
+    __write_u32( _writer, ae_get_movie_sdk_major_version() );
+    __write_u32( _writer, ae_get_movie_sdk_minor_version() );
+    __write_u32( _writer, _writer->hashmask[0] ^ _writer->hashmask[1] ^ _writer->hashmask[2] ^ _writer->hashmask[3] ^ _writer->hashmask[4] );
+
+    __write_string( _writer, "Hash" );
+
+    //common store, atlases, resources
+    __write_u8( _writer, 0U );
+    __write_u8( _writer, 0U );
+    __write_u8( _writer, 0U );
+
+    //one master composition with a camera and no layers
+    __write_u8( _writer, 1U );
+
+    __write_string( _writer, "Hash" );
+    __write_u8( _writer, 1U );
+
+    ae_float_t frame_duration = 1.f / 30.f;
+
+    __write_f32( _writer, 1024.f );
+    __write_f32( _writer, 768.f );
+    __write_f32( _writer, frame_duration * (ae_float_t)TEST_TIMELINE_HASH_FRAME_COUNT );
+    __write_f32( _writer, frame_duration );
+    __write_f32( _writer, 1.f / frame_duration );
+
+    __write_u8( _writer, 5U );
+    __write_u8( _writer, 1U );
+    __write_string( _writer, "Camera" );
+    __write_f32( _writer, 1000.f );
+    __write_f32( _writer, 45.f );
+
+    //target and position x y animate, target and position z are immutable, the quaternion is identity
+    __write_u32( _writer, 0x00000004U | 0x00000040U );
+    __write_u32( _writer, 0x00001000U | 0x00002000U | 0x00004000U | 0x00008000U );
+
+    ae_uint32_t words[256];
+    ae_uint32_t count;
+
+    //enough blocks for a seek table
+    count = __make_linear_blocks( words, 7U, 10.f );
+    __write_timeline( _writer, 3U, words, count );
+
+    //constant, byte-indexed and raw blocks
+    count = 0;
+    words[count++] = (0U << 24U) | 30U;
+    words[count++] = __float_word( 5.f );
+    words[count++] = (2U << 24U) | 31U;
+    words[count++] = __float_word( 5.f );
+    words[count++] = __float_word( 65.f );
+
+    ae_uint32_t frame = 0;
+    words[count++] = (3U << 24U) | 30U;
+    for( ; frame != 30U; ++frame )
+    {
+        words[count++] = __float_word( 65.f - (ae_float_t)frame * 3.f );
+    }
+
+    __write_timeline( _writer, 7U, words, count );
+
+    __write_f32( _writer, 0.f );
+
+    //single block, shorter than the mask period
+    count = __make_linear_blocks( words, TEST_TIMELINE_HASH_FRAME_COUNT, -8.f );
+    __write_timeline( _writer, 1U, words, count );
+
+    count = 0;
+    words[count++] = (3U << 24U) | TEST_TIMELINE_HASH_FRAME_COUNT;
+    for( frame = 0; frame != TEST_TIMELINE_HASH_FRAME_COUNT; ++frame )
+    {
+        words[count++] = __float_word( (ae_float_t)(frame * frame) * 0.25f );
+    }
+
+    __write_timeline( _writer, 4U, words, count );
+
+    __write_f32( _writer, -1000.f );
+
+    //flag terminator, no layers
+    __write_u8( _writer, 0U );
+    __write_u8( _writer, 0U );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_camera_t
+{
+    ae_float_t * samples;
+    ae_uint32_t sample_count;
+} test_camera_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_camera_provider( const aeMovieCameraProviderCallbackData * _callbackData, ae_userdataptr_t _cd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _callbackData );
+
+    *_cd = _ud;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_camera_update( const aeMovieCameraUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_camera_t * camera = (test_camera_t *)_ud;
+
+    ae_float_t * sample = camera->samples + camera->sample_count * 6U;
+
+    sample[0] = _callbackData->target[0];
+    sample[1] = _callbackData->target[1];
+    sample[2] = _callbackData->target[2];
+    sample[3] = _callbackData->position[0];
+    sample[4] = _callbackData->position[1];
+    sample[5] = _callbackData->position[2];
+
+    ++camera->sample_count;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __play_movie_camera( const aeMovieInstance * _instance, aeMovieStream * _stream, ae_float_t * _samples, ae_uint32_t _count )
+{
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, _stream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( _stream );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        printf( "timeline hash: load failed %s\n", ae_get_movie_result_string_info( load_movie_data_result ) );
+
+        return AE_FALSE;
+    }
+
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, 0 );
+
+    test_camera_t camera;
+    camera.samples = _samples;
+    camera.sample_count = 0;
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.camera_provider = &__movie_camera_provider;
+    movieCompositionProviders.camera_update = &__movie_camera_update;
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_TRUE, &movieCompositionProviders, &camera );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t index = 0;
+    for( ; index != _count; ++index )
+    {
+        ae_update_movie_composition( movieComposition, index == 0 ? 0.f : frame_duration * 0.5f );
+    }
+
+    ae_delete_movie_composition( movieComposition );
+
+    ae_delete_movie_data( movieData );
+
+    if( camera.sample_count != _count )
+    {
+        printf( "timeline hash: %u camera samples of %u\n", camera.sample_count, _count );
+
+        return AE_FALSE;
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+    AE_UNUSED( argv );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    const aeMovieInstance * movieInstanceHashed = ae_create_movie_instance( test_hashkey
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR || movieInstanceHashed == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    static test_stream_writer_t writer;
+    static test_stream_writer_t writerHashed;
+
+    __write_movie_stream( &writer, AE_HASHKEY_EMPTY );
+    __write_movie_stream( &writerHashed, test_hashkey );
+
+    ae_uint32_t sample_count = TEST_TIMELINE_HASH_FRAME_COUNT * 2U;
+
+    ae_float_t * samples = (ae_float_t *)malloc( sizeof( ae_float_t ) * 6U * sample_count );
+    ae_float_t * samples_hashed = (ae_float_t *)malloc( sizeof( ae_float_t ) * 6U * sample_count );
+
+    if( __play_movie_camera( movieInstance, ae_create_movie_stream_memory( movieInstance, writer.buffer, &__memory_copy, AE_NULLPTR ), samples, sample_count ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint8_t * buffer = (ae_uint8_t *)malloc( writerHashed.size + 3U );
+
+    //any buffer alignment, every byte goes through the stream copy callback, timelines included
+    ae_uint32_t offset = 0;
+    for( ; offset != 4U; ++offset )
+    {
+        memcpy( buffer + offset, writerHashed.buffer, writerHashed.size );
+
+        ae_size_t copied = 0;
+
+        if( __play_movie_camera( movieInstanceHashed, ae_create_movie_stream_memory( movieInstanceHashed, buffer + offset, &__memory_copy, &copied ), samples_hashed, sample_count ) == AE_FALSE )
+        {
+            return EXIT_FAILURE;
+        }
+
+        if( copied != writerHashed.size )
+        {
+            printf( "timeline hash: memory stream copied %u of %u bytes\n", (ae_uint32_t)copied, (ae_uint32_t)writerHashed.size );
+
+            return EXIT_FAILURE;
+        }
+
+        if( memcmp( samples, samples_hashed, sizeof( ae_float_t ) * 6U * sample_count ) != 0 )
+        {
+            printf( "timeline hash: memory stream at offset %u mismatch\n", offset );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    //read streams always stage the timeline before unhashing it
+    if( __play_movie_camera( movieInstanceHashed, ae_create_movie_stream( movieInstanceHashed, &__read_buffer, &__memory_copy, writerHashed.buffer ), samples_hashed, sample_count ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( memcmp( samples, samples_hashed, sizeof( ae_float_t ) * 6U * sample_count ) != 0 )
+    {
+        printf( "timeline hash: read stream mismatch\n" );
+
+        return EXIT_FAILURE;
+    }
+
+    //a key mismatch is refused before any timeline is read
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+    aeMovieStream * movieStream = ae_create_movie_stream_memory( movieInstance, writerHashed.buffer, &__memory_copy, AE_NULLPTR );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+    ae_delete_movie_data( movieData );
+
+    if( load_movie_data_result != AE_RESULT_INVALID_HASH )
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf( "timeline hash: %u camera samples match\n", sample_count );
+
+    free( buffer );
+    free( samples );
+    free( samples_hashed );
+
+    ae_delete_movie_instance( movieInstance );
+    ae_delete_movie_instance( movieInstanceHashed );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,213 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const ae_char_t * test_example_file_path = "examples/resources/Unicorn/Unicorn.aem";
+static const ae_char_t * test_example_composition_name = "Unicorn";
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __hash_movie_composition_meshes( const aeMovieComposition * _composition )
+{
+    ae_uint32_t hash = 2166136261U;
+
+    ae_uint32_t iterator = 0;
+    aeMovieRenderMesh movieRenderMesh;
+    while( ae_compute_movie_mesh( _composition, &iterator, &movieRenderMesh ) == AE_TRUE )
+    {
+        const ae_uint8_t * it_byte = (const ae_uint8_t *)movieRenderMesh.position;
+        const ae_uint8_t * it_byte_end = it_byte + sizeof( ae_vector3_t ) * movieRenderMesh.vertexCount;
+        for( ; it_byte != it_byte_end; ++it_byte )
+        {
+            hash = (hash ^ *it_byte) * 16777619U;
+        }
+
+        hash = (hash ^ (ae_uint32_t)(movieRenderMesh.opacity * 255.f)) * 16777619U;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static double __bench_movie_composition_seek( const aeMovieComposition * _composition, ae_time_t _frameDuration, ae_uint32_t _begin, ae_uint32_t _end, ae_uint32_t _repeat )
+{
+    clock_t clock_begin = clock();
+
+    ae_uint32_t repeat = 0;
+    for( ; repeat != _repeat; ++repeat )
+    {
+        ae_uint32_t frame = _begin;
+        for( ; frame != _end; ++frame )
+        {
+            ae_set_movie_composition_time( _composition, (ae_time_t)frame * _frameDuration );
+        }
+    }
+
+    clock_t clock_end = clock();
+
+    double sample_count = (double)((_end - _begin) * _repeat);
+
+    double us = (double)(clock_end - clock_begin) * 1000000.0 / (double)CLOCKS_PER_SEC;
+
+    return us / sample_count;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+    AE_UNUSED( argv );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+    char full_example_file_path[256];
+    sprintf( full_example_file_path, "%s/../%s"
+        , argv[1]
+        , test_example_file_path
+    );
+
+    FILE * f = fopen( full_example_file_path, "rb" );
+
+    if( f == NULL )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return EXIT_FAILURE;
+    }
+
+    fclose( f );
+
+    const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data( movieData, test_example_composition_name );
+
+    if( movieCompositionData == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( movieData, movieCompositionData, AE_FALSE, &movieCompositionProviders, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t frame_count = ae_get_movie_composition_data_frame_count( movieCompositionData );
+    ae_time_t frame_duration = ae_get_movie_composition_data_frame_duration( movieCompositionData );
+
+    if( frame_count < 8 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t * frame_hashes = (ae_uint32_t *)malloc( sizeof( ae_uint32_t ) * frame_count );
+
+    ae_uint32_t frame = 0;
+    for( ; frame != frame_count; ++frame )
+    {
+        ae_set_movie_composition_time( movieComposition, (ae_time_t)frame * frame_duration );
+
+        frame_hashes[frame] = __hash_movie_composition_meshes( movieComposition );
+    }
+
+    ae_uint32_t frame_reverse = frame_count;
+    for( ; frame_reverse != 0; --frame_reverse )
+    {
+        ae_set_movie_composition_time( movieComposition, (ae_time_t)(frame_reverse - 1) * frame_duration );
+
+        if( frame_hashes[frame_reverse - 1] != __hash_movie_composition_meshes( movieComposition ) )
+        {
+            printf( "timeline seek: frame %u mismatch\n", frame_reverse - 1 );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    free( frame_hashes );
+
+    ae_uint32_t window = frame_count / 8;
+
+    double us_begin = __bench_movie_composition_seek( movieComposition, frame_duration, 0, window, 32 );
+    double us_end = __bench_movie_composition_seek( movieComposition, frame_duration, frame_count - window, frame_count, 32 );
+
+    printf( "timeline seek: frames [0, %u) %.3f us/sample\n", window, us_begin );
+    printf( "timeline seek: frames [%u, %u) %.3f us/sample\n", frame_count - window, frame_count, us_end );
+
+    ae_delete_movie_composition( movieComposition );
+
+    ae_delete_movie_data( movieData );
+
+    ae_delete_movie_instance( movieInstance );
+
+    return EXIT_SUCCESS;
+}
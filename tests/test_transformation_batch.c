@@ -0,0 +1,320 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+//the batch builds the local matrix in closed form, the scalar path through its specialised helpers,
+//both agree up to float rounding and the sign of zero
+static const ae_float_t test_transformation_batch_epsilon = 0.0001f;
+
+static const ae_char_t * test_trace_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static FILE * test_trace_file;
+static ae_bool_t test_trace_compare;
+static ae_uint32_t test_trace_value_count;
+static ae_uint32_t test_trace_mismatch_count;
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __trace_value( ae_float_t _value )
+{
+    ++test_trace_value_count;
+
+    if( test_trace_compare == AE_FALSE )
+    {
+        fwrite( &_value, sizeof( ae_float_t ), 1, test_trace_file );
+
+        return;
+    }
+
+    ae_float_t scalar_value;
+    if( fread( &scalar_value, sizeof( ae_float_t ), 1, test_trace_file ) != 1 )
+    {
+        ++test_trace_mismatch_count;
+
+        return;
+    }
+
+    ae_float_t scale = 1.f;
+
+    if( fabsf( scalar_value ) > scale )
+    {
+        scale = fabsf( scalar_value );
+    }
+
+    if( fabsf( _value - scalar_value ) > test_transformation_batch_epsilon * scale )
+    {
+        if( test_trace_mismatch_count < 16U )
+        {
+            printf( "transformation batch: value %u batched %.9g scalar %.9g\n", test_trace_value_count, _value, scalar_value );
+        }
+
+        ++test_trace_mismatch_count;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_node_update( const aeMovieNodeUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    __trace_value( (ae_float_t)_callbackData->index );
+
+    const ae_float_t * it_matrix = _callbackData->matrix;
+    const ae_float_t * it_matrix_end = it_matrix + 12;
+    for( ; it_matrix != it_matrix_end; ++it_matrix )
+    {
+        __trace_value( *it_matrix );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __step_movie_composition( const aeMovieComposition * _composition, ae_time_t _timing )
+{
+    ae_update_movie_composition( _composition, _timing );
+
+    ae_uint32_t iterator = 0;
+    aeMovieRenderMesh movieRenderMesh;
+    while( ae_compute_movie_mesh( _composition, &iterator, &movieRenderMesh ) == AE_TRUE )
+    {
+        __trace_value( (ae_float_t)movieRenderMesh.vertexCount );
+
+        const ae_float_t * it_position = movieRenderMesh.position[0];
+        const ae_float_t * it_position_end = it_position + 3U * movieRenderMesh.vertexCount;
+        for( ; it_position != it_position_end; ++it_position )
+        {
+            __trace_value( *it_position );
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __trace_movie_composition_play( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, const aeMovieCompositionProviders * _providers )
+{
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, _providers, AE_NULLPTR );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_time_t duration = ae_get_movie_composition_data_duration( _compositionData );
+    ae_time_t timing = ae_get_movie_composition_data_frame_duration( _compositionData ) * 0.37f;
+
+    ae_uint32_t step_count = (ae_uint32_t)(duration / timing) + 1U;
+
+    //fractional steps keep most nodes interpolated, the loop pass reuses cached local frames
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_uint32_t step = 0;
+    for( ; step != step_count; ++step )
+    {
+        __step_movie_composition( movieComposition, timing );
+    }
+
+    ae_set_movie_composition_loop( movieComposition, AE_TRUE );
+    ae_play_movie_composition( movieComposition, duration * 0.25f );
+
+    for( step = 0; step != step_count * 2U; ++step )
+    {
+        __step_movie_composition( movieComposition, timing );
+    }
+
+    ae_set_movie_composition_time( movieComposition, duration * 0.5f );
+
+    __step_movie_composition( movieComposition, 0.f );
+
+    ae_delete_movie_composition( movieComposition );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static aeMovieData * __load_movie_data( const aeMovieInstance * _instance, const ae_char_t * _path )
+{
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    FILE * f = fopen( _path, "rb" );
+
+    if( f == NULL )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( _instance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    fclose( f );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return AE_NULLPTR;
+    }
+
+    return movieData;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __trace_movie_data_play( const aeMovieInstance * _instance, const ae_char_t * _testsPath, const aeMovieCompositionProviders * _providers )
+{
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_trace_file_paths ) / sizeof( test_trace_file_paths[0] ); ++file_index )
+    {
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , _testsPath
+            , test_trace_file_paths[file_index]
+        );
+
+        aeMovieData * movieData = __load_movie_data( _instance, full_example_file_path );
+
+        if( movieData == AE_NULLPTR )
+        {
+            return AE_FALSE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            if( __trace_movie_composition_play( movieData, movieCompositionData, _providers ) == AE_FALSE )
+            {
+                return AE_FALSE;
+            }
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    //dump writes the trace of the scalar build, compare checks the batched build against it
+    if( argc < 4 )
+    {
+        printf( "transformation batch: usage <tests> dump|compare <trace>\n" );
+
+        return EXIT_FAILURE;
+    }
+
+    test_trace_compare = (strcmp( argv[2], "compare" ) == 0) ? AE_TRUE : AE_FALSE;
+
+    test_trace_file = fopen( argv[3], test_trace_compare == AE_TRUE ? "rb" : "wb" );
+
+    if( test_trace_file == NULL )
+    {
+        return EXIT_FAILURE;
+    }
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+    movieCompositionProviders.node_update = &__movie_node_update;
+
+    if( __trace_movie_data_play( movieInstance, argv[1], &movieCompositionProviders ) == AE_FALSE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    if( test_trace_compare == AE_TRUE )
+    {
+        ae_float_t scalar_tail;
+        if( fread( &scalar_tail, sizeof( ae_float_t ), 1, test_trace_file ) == 1 )
+        {
+            printf( "transformation batch: scalar trace is longer\n" );
+
+            ++test_trace_mismatch_count;
+        }
+    }
+
+    fclose( test_trace_file );
+
+    printf( "transformation batch: %s %u values, %u mismatches\n", argv[2], test_trace_value_count, test_trace_mismatch_count );
+
+    if( test_trace_mismatch_count != 0U )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
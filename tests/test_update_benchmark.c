@@ -0,0 +1,265 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+static const ae_uint32_t test_update_benchmark_instance_count = 64;
+static const ae_uint32_t test_update_benchmark_frame_count = 200;
+static const ae_uint32_t test_update_benchmark_repeat = 3;
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t test_update_benchmark_checksum;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_node_update( const aeMovieNodeUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    test_update_benchmark_checksum += _callbackData->index;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __benchmark_composition_update( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, double * _update, double * _mesh, ae_uint32_t * _meshCount )
+{
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+    movieCompositionProviders.node_update = &__movie_node_update;
+
+    const aeMovieComposition * compositions[64];
+
+    ae_uint32_t instance_index = 0;
+    for( ; instance_index != test_update_benchmark_instance_count; ++instance_index )
+    {
+        const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, &movieCompositionProviders, AE_NULLPTR );
+
+        if( movieComposition == AE_NULLPTR )
+        {
+            return AE_FALSE;
+        }
+
+        ae_set_movie_composition_loop( movieComposition, AE_TRUE );
+        ae_play_movie_composition( movieComposition, 0.f );
+
+        compositions[instance_index] = movieComposition;
+    }
+
+    clock_t update_clock = 0;
+    clock_t mesh_clock = 0;
+
+    ae_uint32_t mesh_count = 0;
+
+    ae_uint32_t frame = 0;
+    for( ; frame != test_update_benchmark_frame_count; ++frame )
+    {
+        clock_t update_begin = clock();
+
+        for( instance_index = 0; instance_index != test_update_benchmark_instance_count; ++instance_index )
+        {
+            ae_update_movie_composition( compositions[instance_index], 1.f / 60.f );
+        }
+
+        clock_t update_end = clock();
+
+        for( instance_index = 0; instance_index != test_update_benchmark_instance_count; ++instance_index )
+        {
+            ae_uint32_t mesh_iterator = 0;
+
+            aeMovieRenderMesh mesh;
+            while( ae_compute_movie_mesh( compositions[instance_index], &mesh_iterator, &mesh ) == AE_TRUE )
+            {
+                ++mesh_count;
+            }
+        }
+
+        clock_t mesh_end = clock();
+
+        update_clock += update_end - update_begin;
+        mesh_clock += mesh_end - update_end;
+    }
+
+    for( instance_index = 0; instance_index != test_update_benchmark_instance_count; ++instance_index )
+    {
+        ae_delete_movie_composition( compositions[instance_index] );
+    }
+
+    double frames = (double)test_update_benchmark_frame_count;
+
+    *_update = (double)update_clock * 1000000.0 / (double)CLOCKS_PER_SEC / frames;
+    *_mesh = (double)mesh_clock * 1000000.0 / (double)CLOCKS_PER_SEC / frames;
+    *_meshCount = mesh_count;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    ae_uint32_t composition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        aeMovieDataProviders data_providers;
+        ae_clear_movie_data_providers( &data_providers );
+
+        aeMovieData * movieData = ae_create_movie_data( movieInstance, &data_providers, AE_USERDATA_NULL );
+
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        FILE * f = fopen( full_example_file_path, "rb" );
+
+        if( f == NULL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        aeMovieStream * movieStream = ae_create_movie_stream( movieInstance, &__read_file, &__memory_copy, f );
+
+        ae_uint32_t load_major_version;
+        ae_uint32_t load_minor_version;
+        ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+        ae_delete_movie_stream( movieStream );
+
+        fclose( f );
+
+        if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            if( ae_is_movie_composition_data_master( movieCompositionData ) == AE_FALSE )
+            {
+                continue;
+            }
+
+            double best_update = 0.0;
+            double best_mesh = 0.0;
+            ae_uint32_t mesh_count = 0;
+
+            ae_uint32_t repeat = 0;
+            for( ; repeat != test_update_benchmark_repeat; ++repeat )
+            {
+                double update_us;
+                double mesh_us;
+
+                if( __benchmark_composition_update( movieData, movieCompositionData, &update_us, &mesh_us, &mesh_count ) == AE_FALSE )
+                {
+                    return EXIT_FAILURE;
+                }
+
+                if( repeat == 0 || best_update > update_us )
+                {
+                    best_update = update_us;
+                }
+
+                if( repeat == 0 || best_mesh > mesh_us )
+                {
+                    best_mesh = mesh_us;
+                }
+            }
+
+            printf( "update benchmark: '%s' %u instances, update %.2f us/frame, meshes %.2f us/frame (%u meshes)\n"
+                , ae_get_movie_composition_data_name( movieCompositionData )
+                , test_update_benchmark_instance_count
+                , best_update
+                , best_mesh
+                , mesh_count
+            );
+
+            ++composition_total;
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    ae_delete_movie_instance( movieInstance );
+
+    printf( "update benchmark: %u compositions, checksum %u\n", composition_total, test_update_benchmark_checksum );
+
+    return EXIT_SUCCESS;
+}
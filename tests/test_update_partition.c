@@ -0,0 +1,403 @@
+#include "movie/movie.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const ae_char_t * test_example_file_paths[] = {
+    "examples/resources/Bridge/Bridge.aem",
+    "examples/resources/Knight/Knight.aem",
+    "examples/resources/Peacock/Peacock.aem",
+    "examples/resources/Unicorn/Unicorn.aem"
+};
+
+#define TEST_UPDATE_PARTITION_MAX_NODES 4096U
+#define TEST_UPDATE_PARTITION_MAX_SUBCOMPOSITIONS 256U
+#define TEST_UPDATE_PARTITION_OWNER_NONE (~0U)
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc( ae_userdata_t _userdata, ae_size_t _size ) {
+    AE_UNUSED( _userdata );
+    return malloc( _size );
+}
+
+AE_CALLBACK ae_voidptr_t stdlib_movie_alloc_n( ae_userdata_t _userdata, ae_size_t _size, ae_size_t _count ) {
+    AE_UNUSED( _userdata );
+    ae_size_t total = _size * _count;
+    return malloc( total );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+AE_CALLBACK ae_void_t stdlib_movie_free_n( ae_userdata_t _data, ae_constvoidptr_t _ptr ) {
+    AE_UNUSED( _data );
+    free( (ae_voidptr_t)_ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_size_t __read_file( ae_voidptr_t _buff, ae_size_t _carriage, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _carriage );
+
+    FILE * f = (FILE *)_data;
+
+    ae_size_t s = fread( _buff, 1, _size, f );
+
+    return s;
+}
+
+AE_CALLBACK ae_void_t __memory_copy( ae_constvoidptr_t _src, ae_voidptr_t _dst, ae_size_t _size, ae_userdata_t _data )
+{
+    AE_UNUSED( _data );
+
+    memcpy( _dst, _src, _size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_update_partition_t
+{
+    //owner of every update index, 0 is the main composition, k + 1 the sub composition k
+    ae_uint32_t owners[TEST_UPDATE_PARTITION_MAX_NODES];
+
+    const aeMovieSubComposition * subcompositions[TEST_UPDATE_PARTITION_MAX_SUBCOMPOSITIONS];
+    ae_uint32_t subcomposition_count;
+
+    //update indices reported by one ae_update_movie_composition
+    ae_uint32_t updates[TEST_UPDATE_PARTITION_MAX_NODES];
+    ae_uint32_t update_count;
+
+    ae_uint32_t errors;
+} test_update_partition_t;
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __movie_node_provider( const aeMovieNodeProviderCallbackData * _callbackData, ae_userdataptr_t _nd, ae_userdata_t _ud )
+{
+    AE_UNUSED( _ud );
+
+    *_nd = (ae_userdata_t)(ae_size_t)(_callbackData->index + 1U);
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_void_t __movie_node_update( const aeMovieNodeUpdateCallbackData * _callbackData, ae_userdata_t _ud )
+{
+    test_update_partition_t * partition = (test_update_partition_t *)_ud;
+
+    if( _callbackData->index >= TEST_UPDATE_PARTITION_MAX_NODES || partition->update_count == TEST_UPDATE_PARTITION_MAX_NODES )
+    {
+        ++partition->errors;
+
+        return;
+    }
+
+    partition->updates[partition->update_count++] = _callbackData->index;
+}
+//////////////////////////////////////////////////////////////////////////
+AE_CALLBACK ae_bool_t __visit_sub_composition( const aeMovieComposition * _composition, ae_uint32_t _index, const ae_char_t * _name, const aeMovieSubComposition * _subcomposition, ae_userdata_t _ud )
+{
+    AE_UNUSED( _composition );
+    AE_UNUSED( _index );
+    AE_UNUSED( _name );
+
+    test_update_partition_t * partition = (test_update_partition_t *)_ud;
+
+    if( partition->subcomposition_count == TEST_UPDATE_PARTITION_MAX_SUBCOMPOSITIONS )
+    {
+        ++partition->errors;
+
+        return AE_FALSE;
+    }
+
+    partition->subcompositions[partition->subcomposition_count++] = _subcomposition;
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_uint32_t __find_sub_composition_owner( const test_update_partition_t * _partition, const aeMovieSubComposition * _subcomposition )
+{
+    ae_uint32_t index = 0;
+    for( ; index != _partition->subcomposition_count; ++index )
+    {
+        if( _partition->subcompositions[index] == _subcomposition )
+        {
+            return index + 1U;
+        }
+    }
+
+    return TEST_UPDATE_PARTITION_OWNER_NONE;
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __check_sub_composition_updates( test_update_partition_t * _partition, ae_uint32_t _owner )
+{
+    ae_uint32_t index = 0;
+    for( ; index != _partition->update_count; ++index )
+    {
+        ae_uint32_t update = _partition->updates[index];
+
+        //one partition is walked in depth order
+        if( index != 0 && _partition->updates[index - 1] >= update )
+        {
+            ++_partition->errors;
+        }
+
+        //a node is updated by its own sub composition only
+        if( _partition->owners[update] != TEST_UPDATE_PARTITION_OWNER_NONE && _partition->owners[update] != _owner )
+        {
+            ++_partition->errors;
+        }
+
+        _partition->owners[update] = _owner;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_void_t __check_composition_updates( test_update_partition_t * _partition )
+{
+    ae_uint32_t previous_owner = 0U;
+    ae_uint32_t previous_update = 0U;
+
+    ae_uint32_t index = 0;
+    for( ; index != _partition->update_count; ++index )
+    {
+        ae_uint32_t update = _partition->updates[index];
+
+        ae_uint32_t owner = _partition->owners[update];
+
+        //nodes no sub composition reported belong to the main composition
+        if( owner == TEST_UPDATE_PARTITION_OWNER_NONE )
+        {
+            owner = 0U;
+        }
+
+        //the main composition goes first, then every sub composition in order, each in depth order
+        if( owner < previous_owner || (index != 0 && owner == previous_owner && update <= previous_update) )
+        {
+            ++_partition->errors;
+        }
+
+        previous_owner = owner;
+        previous_update = update;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static ae_bool_t __test_update_partition_composition( const aeMovieData * _movieData, const aeMovieCompositionData * _compositionData, aeMovieCompositionProviders * _providers, test_update_partition_t * _partition, ae_uint32_t * _subcompositionTotal )
+{
+    const aeMovieComposition * movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, _providers, _partition );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    _partition->subcomposition_count = 0;
+
+    ae_visit_movie_sub_composition( movieComposition, &__visit_sub_composition, _partition );
+
+    ae_uint32_t subcomposition_count = _partition->subcomposition_count;
+
+    ae_delete_movie_composition( movieComposition );
+
+    ae_uint32_t index = 0;
+    for( ; index != TEST_UPDATE_PARTITION_MAX_NODES; ++index )
+    {
+        _partition->owners[index] = TEST_UPDATE_PARTITION_OWNER_NONE;
+    }
+
+    //a sub composition played alone reports only its own nodes
+    ae_uint32_t subcomposition_index = 0;
+    for( ; subcomposition_index != subcomposition_count; ++subcomposition_index )
+    {
+        movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, _providers, _partition );
+
+        if( movieComposition == AE_NULLPTR )
+        {
+            return AE_FALSE;
+        }
+
+        _partition->subcomposition_count = 0;
+
+        ae_visit_movie_sub_composition( movieComposition, &__visit_sub_composition, _partition );
+
+        const aeMovieSubComposition * subcomposition = _partition->subcompositions[subcomposition_index];
+
+        const aeMovieCompositionData * subcompositionData = ae_get_movie_sub_composition_composition_data( subcomposition );
+
+        ae_time_t duration = ae_get_movie_composition_data_duration( subcompositionData );
+        ae_time_t timing = ae_get_movie_composition_data_frame_duration( subcompositionData ) * 0.5f;
+
+        ae_play_movie_sub_composition( movieComposition, subcomposition, 0.f );
+
+        ae_uint32_t owner = __find_sub_composition_owner( _partition, subcomposition );
+
+        ae_uint32_t owner_update_count = 0;
+
+        ae_time_t time = 0.f;
+        for( ; time < duration + timing; time += timing )
+        {
+            _partition->update_count = 0;
+
+            ae_update_movie_composition( movieComposition, timing );
+
+            __check_sub_composition_updates( _partition, owner );
+
+            owner_update_count += _partition->update_count;
+        }
+
+        //every sub composition of the examples has animated nodes
+        if( owner_update_count == 0 )
+        {
+            ++_partition->errors;
+        }
+
+        ae_delete_movie_composition( movieComposition );
+    }
+
+    *_subcompositionTotal += subcomposition_count;
+
+    //the main composition walks its own nodes, then every sub composition range
+    movieComposition = ae_create_movie_composition( _movieData, _compositionData, AE_TRUE, _providers, _partition );
+
+    if( movieComposition == AE_NULLPTR )
+    {
+        return AE_FALSE;
+    }
+
+    ae_time_t duration = ae_get_movie_composition_data_duration( _compositionData );
+    ae_time_t timing = ae_get_movie_composition_data_frame_duration( _compositionData ) * 0.5f;
+
+    ae_play_movie_composition( movieComposition, 0.f );
+
+    ae_time_t time = 0.f;
+    for( ; time < duration + timing; time += timing )
+    {
+        _partition->update_count = 0;
+
+        ae_update_movie_composition( movieComposition, timing );
+
+        __check_composition_updates( _partition );
+    }
+
+    //skipping to the end walks the same ranges
+    ae_play_movie_composition( movieComposition, duration * 0.25f );
+
+    _partition->update_count = 0;
+
+    ae_interrupt_movie_composition( movieComposition, AE_TRUE );
+
+    __check_composition_updates( _partition );
+
+    _partition->update_count = 0;
+
+    ae_update_movie_composition( movieComposition, timing );
+
+    __check_composition_updates( _partition );
+
+    ae_delete_movie_composition( movieComposition );
+
+    return AE_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static aeMovieData * __load_movie_data( const aeMovieInstance * _instance, const ae_char_t * _path )
+{
+    aeMovieDataProviders data_providers;
+    ae_clear_movie_data_providers( &data_providers );
+
+    aeMovieData * movieData = ae_create_movie_data( _instance, &data_providers, AE_USERDATA_NULL );
+
+    FILE * f = fopen( _path, "rb" );
+
+    if( f == NULL )
+    {
+        return AE_NULLPTR;
+    }
+
+    aeMovieStream * movieStream = ae_create_movie_stream( _instance, &__read_file, &__memory_copy, f );
+
+    ae_uint32_t load_major_version;
+    ae_uint32_t load_minor_version;
+    ae_result_t load_movie_data_result = ae_load_movie_data( movieData, movieStream, &load_major_version, &load_minor_version );
+
+    ae_delete_movie_stream( movieStream );
+
+    fclose( f );
+
+    if( load_movie_data_result != AE_RESULT_SUCCESSFUL )
+    {
+        return AE_NULLPTR;
+    }
+
+    return movieData;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    AE_UNUSED( argc );
+
+    const aeMovieInstance * movieInstance = ae_create_movie_instance( AE_HASHKEY_EMPTY
+        , &stdlib_movie_alloc
+        , &stdlib_movie_alloc_n
+        , &stdlib_movie_free
+        , &stdlib_movie_free_n
+        , (ae_movie_strncmp_t)AE_FUNCTION_NULL
+        , (ae_movie_logger_t)AE_FUNCTION_NULL
+        , AE_NULLPTR );
+
+    if( movieInstance == AE_NULLPTR )
+    {
+        return EXIT_FAILURE;
+    }
+
+    aeMovieCompositionProviders movieCompositionProviders;
+    ae_initialize_movie_composition_providers( &movieCompositionProviders );
+
+    movieCompositionProviders.node_provider = &__movie_node_provider;
+    movieCompositionProviders.node_update = &__movie_node_update;
+
+    static test_update_partition_t partition;
+    partition.errors = 0;
+
+    ae_uint32_t subcomposition_total = 0;
+
+    ae_uint32_t file_index = 0;
+    for( ; file_index != sizeof( test_example_file_paths ) / sizeof( test_example_file_paths[0] ); ++file_index )
+    {
+        char full_example_file_path[256];
+        sprintf( full_example_file_path, "%s/../%s"
+            , argv[1]
+            , test_example_file_paths[file_index]
+        );
+
+        aeMovieData * movieData = __load_movie_data( movieInstance, full_example_file_path );
+
+        if( movieData == AE_NULLPTR )
+        {
+            return EXIT_FAILURE;
+        }
+
+        ae_uint32_t composition_count = ae_get_movie_composition_data_count( movieData );
+
+        ae_uint32_t composition_index = 0;
+        for( ; composition_index != composition_count; ++composition_index )
+        {
+            const aeMovieCompositionData * movieCompositionData = ae_get_movie_composition_data_by_index( movieData, composition_index );
+
+            if( __test_update_partition_composition( movieData, movieCompositionData, &movieCompositionProviders, &partition, &subcomposition_total ) == AE_FALSE )
+            {
+                return EXIT_FAILURE;
+            }
+        }
+
+        ae_delete_movie_data( movieData );
+    }
+
+    printf( "update partition: %u sub compositions, %u errors\n", subcomposition_total, partition.errors );
+
+    ae_delete_movie_instance( movieInstance );
+
+    if( partition.errors != 0 || subcomposition_total == 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,17 @@
+execute_process(COMMAND ${TEST_SCALAR} ${TEST_SOURCE_DIR} dump ${TEST_TRACE}
+    OUTPUT_VARIABLE scalar_output
+    RESULT_VARIABLE scalar_result)
+
+if(NOT scalar_result EQUAL 0)
+    message(FATAL_ERROR "transformation batch: scalar trace failed\n${scalar_output}")
+endif()
+
+execute_process(COMMAND ${TEST_BATCH} ${TEST_SOURCE_DIR} compare ${TEST_TRACE}
+    OUTPUT_VARIABLE batch_output
+    RESULT_VARIABLE batch_result)
+
+if(NOT batch_result EQUAL 0)
+    message(FATAL_ERROR "transformation batch: batched trace differs from the scalar path\n${batch_output}")
+endif()
+
+message(STATUS "${batch_output}")